@@ -90,7 +90,8 @@ void AVSyncManager::EnableSenderAVSync()
         }
     }
 
-    sourceMemory_ = CreateAVTransSharedMemory("sourceSharedMemory", sizeof(uint32_t) + sizeof(int64_t));
+    // version 2 layout, the engines given this region must be built with the same av sync utils
+    sourceMemory_ = CreateAVTransSharedMemory("sourceSharedMemory", AV_SYNC_FRAME_INFO_MEM_SIZE);
     AVTransControlCenter::GetInstance().SetParam2Engines(sourceMemory_);
 }
 
@@ -126,8 +127,8 @@ void AVSyncManager::HandleAvSyncMessage(const std::shared_ptr<AVTransMessage> &m
 
 void AVSyncManager::EnableReceiverAVSync(const std::string &groupInfo)
 {
-    size_t size = (sizeof(uint32_t) + sizeof(int64_t)) * MAX_CLOCK_UNIT_COUNT;
-    sinkMemory_ = CreateAVTransSharedMemory("sinkSharedMemory", size);
+    // version 2 layout, the engines given this region must be built with the same av sync utils
+    sinkMemory_ = CreateAVTransSharedMemory("sinkSharedMemory", AV_SYNC_CLOCK_RING_MEM_SIZE);
 
     AVTransControlCenter::GetInstance().SetParam2Engines(sinkMemory_);
     AVTransControlCenter::GetInstance().SetParam2Engines(AVTransTag::START_AV_SYNC, groupInfo);
@@ -104,6 +104,17 @@ public:
     {
         return false;
     }
+
+    int32_t GetOutputStatistics(std::string &statistics) override
+    {
+        (void) statistics;
+        return DH_AVT_SUCCESS;
+    }
+
+    int32_t ResetOutputStatistics() override
+    {
+        return DH_AVT_SUCCESS;
+    }
 };
 class SenderEngineTest : public IAVSenderEngine {
 public:
@@ -16,6 +16,7 @@
 #ifndef OHOS_AV_RECEIVER_ENGINE_H
 #define OHOS_AV_RECEIVER_ENGINE_H
 
+#include "av_sync_utils.h"
 #include "av_trans_buffer.h"
 #include "av_trans_constants.h"
 #include "av_trans_control_center_callback.h"
@@ -65,6 +66,8 @@ public:
     bool StartDumpMediaData() override;
     bool StopDumpMediaData() override;
     bool ReStartDumpMediaData() override;
+    int32_t GetOutputStatistics(std::string &statistics) override;
+    int32_t ResetOutputStatistics() override;
 
     // interfaces from ISoftbusChannelListener
     void OnChannelEvent(const AVTransEvent &event) override;
@@ -78,6 +81,8 @@ private:
     int32_t InitControlCenter();
     int32_t PreparePipeline(const std::string &configParam);
     int32_t HandleOutputBuffer(std::shared_ptr<AVBuffer> &hisBuffer);
+    int32_t WriteOutputRing(const std::shared_ptr<AVBuffer> &hisBuffer);
+    void ReleaseOutputRing();
 
     void RegRespFunMap();
     void SetVideoWidth(const std::string &value);
@@ -96,7 +101,9 @@ private:
     void SetStartAvSync(const std::string &value);
     void SetStopAvSync(const std::string &value);
     void SetSharedMemoryFd(const std::string &value);
+    void SetAdaptiveLatency(const std::string &value);
     void SetEngineReady(const std::string &value);
+    void SetOutputSharedRing(const std::string &value);
     void SetParameterInner(AVTransTag tag, const std::string &value);
 
     StateId GetCurrentState()
@@ -130,6 +137,12 @@ private:
     std::shared_ptr<OHOS::Media::Pipeline::AudioDecoderFilter> audioDecoder_ = nullptr;
     std::shared_ptr<OHOS::Media::Pipeline::VideoDecoderFilter> videoDecoder_ = nullptr;
 
+    /* Frames go to the consumer mapped ring instead of OnDataAvailable once it is set */
+    std::mutex outputRingMtx_;
+    AVTransMappedMemory outputRing_;
+    AVFrameRingGeometry outputRingGeometry_;
+    std::atomic<bool> isOutputRingEnabled_ = false;
+
     using SetParaFunc = void (AVReceiverEngine::*)(const std::string &value);
     std::map<AVTransTag, SetParaFunc> funcMap_;
 };
@@ -226,6 +226,7 @@ int32_t AVReceiverEngine::Release()
     }
     SoftbusChannelAdapter::GetInstance().CloseSoftbusChannel(sessionName_, peerDevId_);
     SoftbusChannelAdapter::GetInstance().UnRegisterChannelListener(sessionName_, peerDevId_);
+    ReleaseOutputRing();
     isInitialized_ = false;
     pipeline_ = nullptr;
     dhFwkKit_ = nullptr;
@@ -274,9 +275,15 @@ void AVReceiverEngine::SetParameterInner(AVTransTag tag, const std::string &valu
         case AVTransTag::SHARED_MEMORY_FD:
             SetSharedMemoryFd(value);
             break;
+        case AVTransTag::ADAPTIVE_LATENCY:
+            SetAdaptiveLatency(value);
+            break;
         case AVTransTag::ENGINE_READY:
             SetEngineReady(value);
             break;
+        case AVTransTag::OUTPUT_SHARED_RING:
+            SetOutputSharedRing(value);
+            break;
         default:
             break;
     }
@@ -314,7 +321,9 @@ int32_t AVReceiverEngine::SetParameter(AVTransTag tag, const std::string &value)
         case AVTransTag::START_AV_SYNC:
         case AVTransTag::STOP_AV_SYNC:
         case AVTransTag::SHARED_MEMORY_FD:
+        case AVTransTag::ADAPTIVE_LATENCY:
         case AVTransTag::ENGINE_READY:
+        case AVTransTag::OUTPUT_SHARED_RING:
             SetParameterInner(tag, value);
             break;
         default:
@@ -342,7 +351,9 @@ void AVReceiverEngine::RegRespFunMap()
     funcMap_[AVTransTag::START_AV_SYNC] = &AVReceiverEngine::SetStartAvSync;
     funcMap_[AVTransTag::STOP_AV_SYNC] = &AVReceiverEngine::SetStopAvSync;
     funcMap_[AVTransTag::SHARED_MEMORY_FD] = &AVReceiverEngine::SetSharedMemoryFd;
+    funcMap_[AVTransTag::ADAPTIVE_LATENCY] = &AVReceiverEngine::SetAdaptiveLatency;
     funcMap_[AVTransTag::ENGINE_READY] = &AVReceiverEngine::SetEngineReady;
+    funcMap_[AVTransTag::OUTPUT_SHARED_RING] = &AVReceiverEngine::SetOutputSharedRing;
 }
 
 void AVReceiverEngine::SetVideoWidth(const std::string &value)
@@ -525,12 +536,57 @@ void AVReceiverEngine::SetSharedMemoryFd(const std::string &value)
     AVTRANS_LOGI("SetParameter USER_SHARED_MEMORY_FD success, shared memory info = %{public}s", value.c_str());
 }
 
+void AVReceiverEngine::SetAdaptiveLatency(const std::string &value)
+{
+    if (avOutput_ == nullptr) {
+        AVTRANS_LOGE("avOutput_ is nullptr.");
+        return;
+    }
+    avOutput_->SetParameter(static_cast<int32_t>(TAG_ADAPTIVE_LATENCY), value);
+    AVTRANS_LOGI("SetParameter ADAPTIVE_LATENCY success, adaptive latency = %{public}s", value.c_str());
+}
+
 void AVReceiverEngine::SetEngineReady(const std::string &value)
 {
     int32_t ret = PreparePipeline(value);
     TRUE_LOG_MSG(ret != DH_AVT_SUCCESS, "SetParameter ENGINE_READY failed");
 }
 
+void AVReceiverEngine::SetOutputSharedRing(const std::string &value)
+{
+    ReleaseOutputRing();
+    if (value.empty()) {
+        AVTRANS_LOGI("SetParameter OUTPUT_SHARED_RING success, output ring disabled.");
+        return;
+    }
+    AVTransSharedMemory memory = UnmarshalSharedMemory(value);
+    std::lock_guard<std::mutex> lock(outputRingMtx_);
+    int32_t ret = MapAVTransSharedMemory(memory, outputRing_);
+    TRUE_RETURN(ret != DH_AVT_SUCCESS, "map output ring failed, ret=%{public}" PRId32, ret);
+    ret = CheckFrameRingMemory(outputRing_, outputRingGeometry_);
+    if (ret != DH_AVT_SUCCESS) {
+        AVTRANS_LOGE("invalid output ring, ret=%{public}" PRId32, ret);
+        UnmapAVTransSharedMemory(outputRing_);
+        return;
+    }
+    isOutputRingEnabled_ = true;
+    AVTRANS_LOGI("SetParameter OUTPUT_SHARED_RING success, shared memory info = %{public}s", value.c_str());
+}
+
+void AVReceiverEngine::ReleaseOutputRing()
+{
+    std::lock_guard<std::mutex> lock(outputRingMtx_);
+    isOutputRingEnabled_ = false;
+    AVFrameRingStatistics stats;
+    if (GetFrameRingStatistics(outputRing_, stats) == DH_AVT_SUCCESS) {
+        AVTRANS_LOGI("output ring statistics, write=%{public}" PRIu64 ", read=%{public}" PRIu64 ", overflow="
+            "%{public}" PRIu64 ", avg latency=%{public}" PRId64 "ns, max latency=%{public}" PRId64 "ns",
+            stats.writeCount, stats.readCount, stats.overflowCount, stats.avgLatencyNs, stats.maxLatencyNs);
+    }
+    UnmapAVTransSharedMemory(outputRing_);
+    outputRingGeometry_ = AVFrameRingGeometry();
+}
+
 int32_t AVReceiverEngine::SendMessage(const std::shared_ptr<AVTransMessage> &message)
 {
     TRUE_RETURN_V_MSG_E(message == nullptr, ERR_DH_AVT_INVALID_PARAM, "input message is nullptr.");
@@ -579,6 +635,27 @@ bool AVReceiverEngine::ReStartDumpMediaData()
     return true;
 }
 
+int32_t AVReceiverEngine::GetOutputStatistics(std::string &statistics)
+{
+    TRUE_RETURN_V_MSG_E(avOutput_ == nullptr, ERR_DH_AVT_NULL_POINTER, "avOutput_ is nullptr.");
+    Plugin::Any value;
+    ErrorCode ret = avOutput_->GetParameter(static_cast<int32_t>(TAG_OUTPUT_STATISTICS), value);
+    TRUE_RETURN_V_MSG_E(ret != ErrorCode::SUCCESS, ERR_DH_AVT_NOT_EXISTED, "get output statistics failed.");
+    TRUE_RETURN_V_MSG_E(!Plugin::Any::IsSameTypeWith<std::string>(value), ERR_DH_AVT_INVALID_PARAM_TYPE,
+        "output statistics type is invalid.");
+    statistics = Plugin::AnyCast<std::string>(value);
+    return DH_AVT_SUCCESS;
+}
+
+int32_t AVReceiverEngine::ResetOutputStatistics()
+{
+    TRUE_RETURN_V_MSG_E(avOutput_ == nullptr, ERR_DH_AVT_NULL_POINTER, "avOutput_ is nullptr.");
+    ErrorCode ret = avOutput_->SetParameter(static_cast<int32_t>(TAG_OUTPUT_STATISTICS), std::string(""));
+    TRUE_RETURN_V_MSG_E(ret != ErrorCode::SUCCESS, ERR_DH_AVT_SET_PARAM_FAILED, "reset output statistics failed.");
+    AVTRANS_LOGI("Reset output statistics success.");
+    return DH_AVT_SUCCESS;
+}
+
 int32_t AVReceiverEngine::HandleOutputBuffer(std::shared_ptr<AVBuffer> &hisBuffer)
 {
     StateId currentState = GetCurrentState();
@@ -586,6 +663,11 @@ int32_t AVReceiverEngine::HandleOutputBuffer(std::shared_ptr<AVBuffer> &hisBuffe
     TRUE_RETURN_V_MSG_E(isErrState, ERR_DH_AVT_OUTPUT_DATA_FAILED,
         "current state=%{public}" PRId32 " is invalid.", currentState);
 
+    if (isOutputRingEnabled_.load()) {
+        SetCurrentState(StateId::PLAYING);
+        return WriteOutputRing(hisBuffer);
+    }
+
     std::shared_ptr<AVTransBuffer> transBuffer = HiSBuffer2TransBuffer(hisBuffer);
     TRUE_RETURN_V(transBuffer == nullptr, ERR_DH_AVT_OUTPUT_DATA_FAILED);
 
@@ -594,6 +676,52 @@ int32_t AVReceiverEngine::HandleOutputBuffer(std::shared_ptr<AVBuffer> &hisBuffe
     return receiverCallback_->OnDataAvailable(transBuffer);
 }
 
+int32_t AVReceiverEngine::WriteOutputRing(const std::shared_ptr<AVBuffer> &hisBuffer)
+{
+    TRUE_RETURN_V((hisBuffer == nullptr) || hisBuffer->IsEmpty(), ERR_DH_AVT_OUTPUT_DATA_FAILED);
+    auto memory = hisBuffer->GetMemory();
+    TRUE_RETURN_V(memory == nullptr, ERR_DH_AVT_OUTPUT_DATA_FAILED);
+    auto hisMeta = hisBuffer->GetBufferMeta();
+    TRUE_RETURN_V(hisMeta == nullptr, ERR_DH_AVT_OUTPUT_DATA_FAILED);
+
+    AVFrameRingInfo info;
+    info.dataSize = static_cast<uint32_t>(memory->GetSize());
+    info.pts = static_cast<int64_t>(hisBuffer->pts);
+    if (hisMeta->GetType() == BufferMetaType::AUDIO) {
+        auto hisAMeta = ReinterpretCastPointer<AVTransAudioBufferMeta>(hisMeta);
+        TRUE_RETURN_V(hisAMeta == nullptr, ERR_DH_AVT_OUTPUT_DATA_FAILED);
+        info.metaType = static_cast<uint32_t>(MetaType::AUDIO);
+        info.dataType = static_cast<uint32_t>(hisAMeta->dataType_);
+        info.format = static_cast<uint32_t>(hisAMeta->format_);
+        info.sampleRate = hisAMeta->sampleRate_;
+    } else {
+        auto hisVMeta = ReinterpretCastPointer<AVTransVideoBufferMeta>(hisMeta);
+        TRUE_RETURN_V(hisVMeta == nullptr, ERR_DH_AVT_OUTPUT_DATA_FAILED);
+        info.metaType = static_cast<uint32_t>(MetaType::VIDEO);
+        info.dataType = static_cast<uint32_t>(hisVMeta->dataType_);
+        info.format = static_cast<uint32_t>(hisVMeta->format_);
+        info.width = hisVMeta->width_;
+        info.height = hisVMeta->height_;
+        info.pts = hisVMeta->pts_;
+    }
+
+    bool isNotify = false;
+    {
+        std::lock_guard<std::mutex> lock(outputRingMtx_);
+        int32_t ret = WriteFrameToRing(outputRing_, outputRingGeometry_, info, memory->GetReadOnlyData(), isNotify);
+        if (ret == ERR_DH_AVT_SHARED_RING_FULL) {
+            AVTRANS_LOGD("output ring is full, drop frame pts=%{public}" PRId64, info.pts);
+            return ret;
+        }
+        TRUE_RETURN_V_MSG_E(ret != DH_AVT_SUCCESS, ret, "write output ring failed, ret=%{public}" PRId32, ret);
+    }
+    // only a ring the consumer has drained needs a wake up, it keeps reading until the ring is empty
+    if (isNotify && (receiverCallback_ != nullptr)) {
+        receiverCallback_->OnReceiverEvent(AVTransEvent{EventType::EVENT_OUTPUT_RING_DATA, "", peerDevId_});
+    }
+    return DH_AVT_SUCCESS;
+}
+
 void AVReceiverEngine::OnChannelEvent(const AVTransEvent &event)
 {
     AVTRANS_LOGI("OnChannelEvent enter. event type:%{public}" PRId32, event.type);
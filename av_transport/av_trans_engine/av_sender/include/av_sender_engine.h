@@ -94,6 +94,7 @@ private:
     void SetAudioSampleFormat(const std::string &value);
     void SetAudioFrameSize(const std::string &value);
     void SetSharedMemoryFd(const std::string &value);
+    void SetSendBatching(const std::string &value);
     void SetEngineReady(const std::string &value);
     void SetEnginePause(const std::string &value);
     void SetEngineResume(const std::string &value);
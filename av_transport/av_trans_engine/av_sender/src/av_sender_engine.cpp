@@ -241,6 +241,9 @@ void AVSenderEngine::SetParameterInner(AVTransTag tag, const std::string &value)
         case AVTransTag::SHARED_MEMORY_FD:
             SetSharedMemoryFd(value);
             break;
+        case AVTransTag::SEND_BATCHING:
+            SetSendBatching(value);
+            break;
         case AVTransTag::ENGINE_READY:
             SetEngineReady(value);
             break;
@@ -287,6 +290,7 @@ int32_t AVSenderEngine::SetParameter(AVTransTag tag, const std::string &value)
         case AVTransTag::AUDIO_SAMPLE_FORMAT:
         case AVTransTag::AUDIO_FRAME_SIZE:
         case AVTransTag::SHARED_MEMORY_FD:
+        case AVTransTag::SEND_BATCHING:
         case AVTransTag::ENGINE_READY:
         case AVTransTag::ENGINE_PAUSE:
         case AVTransTag::ENGINE_RESUME:
@@ -315,6 +319,7 @@ void AVSenderEngine::RegRespFunMap()
     funcMap_[AVTransTag::AUDIO_SAMPLE_FORMAT] = &AVSenderEngine::SetAudioSampleFormat;
     funcMap_[AVTransTag::AUDIO_FRAME_SIZE] = &AVSenderEngine::SetAudioFrameSize;
     funcMap_[AVTransTag::SHARED_MEMORY_FD] = &AVSenderEngine::SetSharedMemoryFd;
+    funcMap_[AVTransTag::SEND_BATCHING] = &AVSenderEngine::SetSendBatching;
     funcMap_[AVTransTag::ENGINE_READY] = &AVSenderEngine::SetEngineReady;
     funcMap_[AVTransTag::ENGINE_PAUSE] = &AVSenderEngine::SetEnginePause;
     funcMap_[AVTransTag::ENGINE_RESUME] = &AVSenderEngine::SetEngineResume;
@@ -495,6 +500,16 @@ void AVSenderEngine::SetSharedMemoryFd(const std::string &value)
     AVTRANS_LOGI("SetParameter USER_SHARED_MEMORY_FD success, shared memory info = %{public}s", value.c_str());
 }
 
+void AVSenderEngine::SetSendBatching(const std::string &value)
+{
+    if (avOutput_ == nullptr) {
+        AVTRANS_LOGE("avOutput_ is nullptr.");
+        return;
+    }
+    avOutput_->SetParameter(static_cast<int32_t>(TAG_SEND_BATCHING), value);
+    AVTRANS_LOGI("SetParameter SEND_BATCHING success, send batching = %{public}s", value.c_str());
+}
+
 void AVSenderEngine::SetEngineReady(const std::string &value)
 {
     int32_t ret = PreparePipeline(value);
@@ -17,6 +17,7 @@
 #include "av_transport_input_filter.h"
 #include "av_trans_log.h"
 #include "av_trans_constants.h"
+#include "av_trans_utils.h"
 #include "pipeline/filters/common/plugin_utils.h"
 #include "pipeline/factory/filter_factory.h"
 #include "plugin/common/plugin_attr_desc.h"
@@ -563,7 +564,7 @@ ErrorCode AVInputFilter::PushData(const std::string& inPort, const AVBufferPtr&
     auto tempBuffer = std::make_shared<AVBuffer>(Plugin::BufferMetaType::VIDEO);
     tempBuffer->pts = buffer->pts;
     tempBuffer->flag = buffer->flag;
-    tempBuffer->AllocMemory(nullptr, bufSize);
+    tempBuffer->AllocMemory(GetAVTransPoolAllocator(), bufSize);
     tempBuffer->GetMemory()->Write(buffer->GetMemory()->GetReadOnlyData(), bufSize);
     tempBuffer->UpdateBufferMeta(*(buffer->GetBufferMeta()->Clone()));
 
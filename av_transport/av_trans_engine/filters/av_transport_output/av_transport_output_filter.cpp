@@ -17,6 +17,7 @@
 #include "av_transport_output_filter.h"
 #include "av_trans_log.h"
 #include "av_trans_constants.h"
+#include "av_trans_utils.h"
 #include "pipeline/filters/common/plugin_utils.h"
 #include "pipeline/factory/filter_factory.h"
 #include "plugin/common/plugin_attr_desc.h"
@@ -50,6 +51,15 @@ ErrorCode AVOutputFilter::SetParameter(int32_t key, const Any& value)
         AVTRANS_LOGE("This key is invalid!");
         return ErrorCode::ERROR_INVALID_PARAMETER_VALUE;
     }
+    if (tag == TAG_OUTPUT_STATISTICS) {
+        // a reset command rather than a setting, so it is not cached for the plugin created later
+        std::lock_guard<std::mutex> lock(outputFilterMutex_);
+        if (plugin_ == nullptr) {
+            AVTRANS_LOGE("plugin is nullptr!");
+            return ErrorCode::ERROR_NULL_POINTER;
+        }
+        return TranslatePluginStatus(plugin_->SetParameter(tag, value));
+    }
     if (plugin_ != nullptr) {
         plugin_->SetParameter(static_cast<Plugin::Tag>(key), value);
     }
@@ -67,6 +77,21 @@ ErrorCode AVOutputFilter::GetParameter(int32_t key, Any& value)
         AVTRANS_LOGE("This key is invalid!");
         return ErrorCode::ERROR_INVALID_PARAMETER_VALUE;
     }
+    if (tag == TAG_OUTPUT_STATISTICS) {
+        std::lock_guard<std::mutex> lock(outputFilterMutex_);
+        if (plugin_ == nullptr) {
+            AVTRANS_LOGE("plugin is nullptr!");
+            return ErrorCode::ERROR_NULL_POINTER;
+        }
+        return TranslatePluginStatus(plugin_->GetParameter(tag, value));
+    }
+    if (tag == TAG_ADAPTIVE_LATENCY) {
+        // the plugin reports the current adaptive target, the cached json is only the last setting
+        std::lock_guard<std::mutex> lock(outputFilterMutex_);
+        if (plugin_ != nullptr) {
+            return TranslatePluginStatus(plugin_->GetParameter(tag, value));
+        }
+    }
     {
         std::lock_guard<std::mutex> lock(paramsMapMutex_);
         value = paramsMap_[tag];
@@ -324,6 +349,12 @@ ErrorCode AVOutputFilter::SetPluginParams()
     if (paramsMap_.find(Tag::SECTION_VIDEO_SPECIFIC_START) != paramsMap_.end()) {
         plugin_->SetParameter(Tag::SECTION_VIDEO_SPECIFIC_START, paramsMap_[Tag::SECTION_VIDEO_SPECIFIC_START]);
     }
+    if (paramsMap_.find(TAG_ADAPTIVE_LATENCY) != paramsMap_.end()) {
+        plugin_->SetParameter(TAG_ADAPTIVE_LATENCY, paramsMap_[TAG_ADAPTIVE_LATENCY]);
+    }
+    if (paramsMap_.find(TAG_SEND_BATCHING) != paramsMap_.end()) {
+        plugin_->SetParameter(TAG_SEND_BATCHING, paramsMap_[TAG_SEND_BATCHING]);
+    }
     return ErrorCode::SUCCESS;
 }
 
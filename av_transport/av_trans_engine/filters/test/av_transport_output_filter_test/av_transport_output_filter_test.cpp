@@ -16,6 +16,7 @@
 #include "av_transport_output_filter_test.h"
 
 #include "av_trans_constants.h"
+#include "av_trans_utils.h"
 #include "pipeline/filters/common/plugin_utils.h"
 #include "pipeline/factory/filter_factory.h"
 #include "plugin/common/plugin_attr_desc.h"
@@ -68,6 +69,20 @@ HWTEST_F(AvTransportOutputFilterTest, SetParameter_002, testing::ext::TestSize.L
     EXPECT_EQ(ErrorCode::SUCCESS, ret);
 }
 
+HWTEST_F(AvTransportOutputFilterTest, SetParameter_003, testing::ext::TestSize.Level1)
+{
+    ASSERT_TRUE(avOutputTest_ != nullptr);
+    int32_t key = static_cast<int32_t>(TAG_OUTPUT_STATISTICS);
+    Any value = std::string("");
+    avOutputTest_->plugin_ = nullptr;
+    EXPECT_EQ(ErrorCode::ERROR_NULL_POINTER, avOutputTest_->SetParameter(key, value));
+
+    avOutputTest_->plugin_ =
+        PluginManager::Instance().CreateGenericPlugin<AvTransOutput, AvTransOutputPlugin>("AVTransDaudioOutputPlugin");
+    EXPECT_NE(ErrorCode::SUCCESS, avOutputTest_->SetParameter(key, value));
+    EXPECT_EQ(avOutputTest_->paramsMap_.end(), avOutputTest_->paramsMap_.find(TAG_OUTPUT_STATISTICS));
+}
+
 HWTEST_F(AvTransportOutputFilterTest, GetParameter_001, testing::ext::TestSize.Level1)
 {
     ASSERT_TRUE(avOutputTest_ != nullptr);
@@ -86,6 +101,22 @@ HWTEST_F(AvTransportOutputFilterTest, GetParameter_002, testing::ext::TestSize.L
     EXPECT_EQ(ErrorCode::SUCCESS, ret);
 }
 
+HWTEST_F(AvTransportOutputFilterTest, GetParameter_003, testing::ext::TestSize.Level1)
+{
+    ASSERT_TRUE(avOutputTest_ != nullptr);
+    int32_t key = static_cast<int32_t>(TAG_ADAPTIVE_LATENCY);
+    std::string param = "{\"enable\":true,\"minLatencyMs\":20,\"maxLatencyMs\":200}";
+    avOutputTest_->plugin_ = nullptr;
+    EXPECT_EQ(ErrorCode::SUCCESS, avOutputTest_->SetParameter(key, Any(param)));
+    Any value;
+    EXPECT_EQ(ErrorCode::SUCCESS, avOutputTest_->GetParameter(key, value));
+    EXPECT_EQ(param, Plugin::AnyCast<std::string>(value));
+
+    avOutputTest_->plugin_ =
+        PluginManager::Instance().CreateGenericPlugin<AvTransOutput, AvTransOutputPlugin>("AVTransDaudioOutputPlugin");
+    EXPECT_NE(ErrorCode::SUCCESS, avOutputTest_->GetParameter(key, value));
+}
+
 HWTEST_F(AvTransportOutputFilterTest, Prepare_001, testing::ext::TestSize.Level1)
 {
     ASSERT_TRUE(avOutputTest_ != nullptr);
@@ -57,6 +57,8 @@ DaudioInputPlugin::DaudioInputPlugin(std::string name)
 DaudioInputPlugin::~DaudioInputPlugin()
 {
     AVTRANS_LOGI("DaudioInputPlugin dtor.");
+    std::lock_guard<std::mutex> lock(tagMapMutex_);
+    UnmapAVTransSharedMemory(sharedMemoryMap_);
 }
 
 Status DaudioInputPlugin::Init()
@@ -84,8 +86,9 @@ Status DaudioInputPlugin::Reset()
 Status DaudioInputPlugin::Pause()
 {
     AVTRANS_LOGI("Pause enter.");
+    std::lock_guard<std::mutex> lock(tagMapMutex_);
     if ((sharedMemory_.fd > 0) && (sharedMemory_.size > 0) && !sharedMemory_.name.empty()) {
-        ResetSharedMemory(sharedMemory_);
+        ResetSharedMemory(sharedMemoryMap_);
     }
     return Status::OK;
 }
@@ -115,6 +118,11 @@ Status DaudioInputPlugin::SetParameter(Tag tag, const ValueType &value)
     tagMap_.insert(std::make_pair(tag, value));
     if (tag == Plugin::Tag::USER_SHARED_MEMORY_FD) {
         sharedMemory_ = UnmarshalSharedMemory(Media::Plugin::AnyCast<std::string>(value));
+        if (IsInValidSharedMemory(sharedMemory_)) {
+            UnmapAVTransSharedMemory(sharedMemoryMap_);
+        } else {
+            MapAVTransSharedMemory(sharedMemory_, sharedMemoryMap_);
+        }
     }
     return Status::OK;
 }
@@ -144,7 +152,7 @@ Status DaudioInputPlugin::PushData(const std::string &inPort, std::shared_ptr<Pl
         Plugin::AnyCast<uint32_t>(buffer->GetBufferMeta()->GetMeta(Tag::USER_FRAME_NUMBER)));
 
     if ((sharedMemory_.fd > 0) && (sharedMemory_.size > 0) && !sharedMemory_.name.empty()) {
-        WriteFrameInfoToMemory(sharedMemory_, frameNumber_.load(), buffer->pts);
+        WriteFrameInfoToMemory(sharedMemoryMap_, frameNumber_.load(), buffer->pts);
     }
 
     return Status::OK;
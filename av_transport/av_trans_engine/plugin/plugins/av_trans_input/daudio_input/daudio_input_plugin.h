@@ -64,6 +64,7 @@ private:
     std::mutex tagMapMutex_;
     std::map<Tag, ValueType> tagMap_;
     AVTransSharedMemory sharedMemory_ = AVTransSharedMemory{ 0, 0, "" };
+    AVTransMappedMemory sharedMemoryMap_;
 };
 } // namespace DistributedHardware
 } // namespace OHOS
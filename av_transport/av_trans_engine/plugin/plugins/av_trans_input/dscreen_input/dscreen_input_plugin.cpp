@@ -54,6 +54,8 @@ DscreenInputPlugin::DscreenInputPlugin(std::string name)
 DscreenInputPlugin::~DscreenInputPlugin()
 {
     AVTRANS_LOGI("dtor.");
+    std::lock_guard<std::mutex> lock(paramsMapMutex_);
+    UnmapAVTransSharedMemory(sharedMemoryMap_);
 }
 
 Status DscreenInputPlugin::Init()
@@ -107,6 +109,11 @@ Status DscreenInputPlugin::SetParameter(Tag tag, const ValueType &value)
     paramsMap_.insert(std::pair<Tag, ValueType>(tag, value));
     if (tag == Plugin::Tag::USER_SHARED_MEMORY_FD) {
         sharedMemory_ = UnmarshalSharedMemory(Media::Plugin::AnyCast<std::string>(value));
+        if (IsInValidSharedMemory(sharedMemory_)) {
+            UnmapAVTransSharedMemory(sharedMemoryMap_);
+        } else {
+            MapAVTransSharedMemory(sharedMemory_, sharedMemoryMap_);
+        }
     }
     return Status::OK;
 }
@@ -138,7 +145,7 @@ Status DscreenInputPlugin::PushData(const std::string& inPort, std::shared_ptr<B
     if ((sharedMemory_.fd > 0) && (sharedMemory_.size > 0) && !sharedMemory_.name.empty()) {
         int64_t audioTimestamp = 0;
         uint32_t audioFrameNum = 0;
-        int32_t ret = ReadFrameInfoFromMemory(sharedMemory_, audioFrameNum, audioTimestamp);
+        int32_t ret = ReadFrameInfoFromMemory(sharedMemoryMap_, audioFrameNum, audioTimestamp);
         if ((ret == DH_AVT_SUCCESS) && (audioFrameNum > 0) && (audioTimestamp > 0)) {
             bufferMeta->SetMeta(Tag::MEDIA_START_TIME, audioTimestamp);
             bufferMeta->SetMeta(Tag::AUDIO_SAMPLE_PER_FRAME, audioFrameNum);
@@ -60,6 +60,7 @@ private:
     std::mutex paramsMapMutex_;
     std::map<Tag, ValueType> paramsMap_;
     AVTransSharedMemory sharedMemory_ = AVTransSharedMemory{ 0, 0, "" };
+    AVTransMappedMemory sharedMemoryMap_;
 };
 
 } // namespace DistributedHardware
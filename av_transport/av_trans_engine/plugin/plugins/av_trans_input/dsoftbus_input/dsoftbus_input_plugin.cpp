@@ -15,6 +15,7 @@
 
 #include "dsoftbus_input_plugin.h"
 
+#include <cinttypes>
 #include <unistd.h>
 #include <sys/types.h>
 #include <sys/stat.h>
@@ -122,6 +123,7 @@ Status DsoftbusInputPlugin::Reset()
     paramsMap_.clear();
     if (bufferPopTask_) {
         isrunning_.store(false);
+        WakeUpHandleData();
         bufferPopTask_->Stop();
         bufferPopTask_.reset();
     }
@@ -139,12 +141,16 @@ Status DsoftbusInputPlugin::Start()
         AVTRANS_LOGE("The state is wrong.");
         return Status::ERROR_WRONG_STATE;
     }
+    int64_t startTime = GetCurrentTime();
     DataQueueClear(dataQueue_);
     isrunning_.store(true);
     if (bufferPopTask_) {
         bufferPopTask_->Start();
     }
     SetCurrentState(State::RUNNING);
+    int64_t costMs = (GetCurrentTime() - startTime) / NS_ONE_MS;
+    AVTRANS_LOGI("Start success, cost %{public}" PRId64 " ms.", costMs);
+    TRUE_LOG_MSG(costMs > PLUGIN_STATE_CHANGE_MAX_COST_MS, "Start cost exceeds the bound.");
     return Status::OK;
 }
 
@@ -155,12 +161,17 @@ Status DsoftbusInputPlugin::Stop()
         AVTRANS_LOGE("The state is wrong.");
         return Status::ERROR_WRONG_STATE;
     }
+    int64_t startTime = GetCurrentTime();
     SetCurrentState(State::PREPARED);
     isrunning_.store(false);
+    WakeUpHandleData();
     if (bufferPopTask_) {
         bufferPopTask_->Stop();
     }
     DataQueueClear(dataQueue_);
+    int64_t costMs = (GetCurrentTime() - startTime) / NS_ONE_MS;
+    AVTRANS_LOGI("Stop success, cost %{public}" PRId64 " ms.", costMs);
+    TRUE_LOG_MSG(costMs > PLUGIN_STATE_CHANGE_MAX_COST_MS, "Stop cost exceeds the bound.");
     return Status::OK;
 }
 
@@ -226,6 +237,9 @@ Status DsoftbusInputPlugin::SetDataCallback(AVDataCallback callback)
 void DsoftbusInputPlugin::OnChannelEvent(const AVTransEvent &event)
 {
     AVTRANS_LOGI("OnChannelEvent enter, event type: %{public}d", event.type);
+    if (event.type == EventType::EVENT_CHANNEL_OPENED) {
+        SendExtHeaderCapability();
+    }
     if (eventsCb_ == nullptr) {
         AVTRANS_LOGE("OnChannelEvent failed, event callback is nullptr.");
         return;
@@ -250,44 +264,182 @@ void DsoftbusInputPlugin::OnChannelEvent(const AVTransEvent &event)
 
 void DsoftbusInputPlugin::OnStreamReceived(const StreamData *data, const StreamData *ext)
 {
-    if (ext == nullptr) {
-        AVTRANS_LOGE("ext is nullptr.");
+    AVTransVideoBatchMeta batchMeta;
+    if (UnmarshalBatchExt(ext, batchMeta)) {
+        TRUE_RETURN((data == nullptr || data->buf == nullptr || data->bufLen <= 0), "batch data is nullptr.");
+        EnqueueBatch(batchMeta, static_cast<uint32_t>(data->bufLen),
+            [this, data](uint32_t offset, uint32_t len, const std::shared_ptr<AVTransVideoBufferMeta> &meta) {
+                StreamData frame = {data->buf + offset, static_cast<int>(len)};
+                return CreateBuffer(&frame, meta);
+            });
+        return;
+    }
+    auto meta = std::make_shared<AVTransVideoBufferMeta>();
+    if (!UnmarshalExt(ext, meta)) {
         return;
     }
+    auto buffer = CreateBuffer(data, meta);
+    if (buffer != nullptr) {
+        DataEnqueue(buffer);
+    }
+}
+
+StreamPayloadAllocator DsoftbusInputPlugin::GetStreamPayloadAllocator()
+{
+    return [](uint32_t size) { return AVTransBufferPool::GetInstance().Acquire(size); };
+}
+
+void DsoftbusInputPlugin::OnStreamPayloadReceived(std::shared_ptr<uint8_t> payload, uint32_t size,
+    const StreamData *ext)
+{
+    AVTransVideoBatchMeta batchMeta;
+    if (UnmarshalBatchExt(ext, batchMeta)) {
+        TRUE_RETURN((payload == nullptr), "batch payload is nullptr.");
+        // every frame aliases the batch block, which goes back to the pool with the last frame released
+        EnqueueBatch(batchMeta, size,
+            [this, &payload](uint32_t offset, uint32_t len, const std::shared_ptr<AVTransVideoBufferMeta> &meta) {
+                return WrapPayloadBuffer(std::shared_ptr<uint8_t>(payload, payload.get() + offset), len, meta);
+            });
+        return;
+    }
+    auto meta = std::make_shared<AVTransVideoBufferMeta>();
+    if (!UnmarshalExt(ext, meta)) {
+        return;
+    }
+    auto buffer = WrapPayloadBuffer(std::move(payload), size, meta);
+    if (buffer != nullptr) {
+        DataEnqueue(buffer);
+    }
+}
+
+bool DsoftbusInputPlugin::UnmarshalBatchExt(const StreamData *ext, AVTransVideoBatchMeta &batchMeta)
+{
+    if (ext == nullptr || ext->buf == nullptr || ext->bufLen <= 0) {
+        return false;
+    }
+    const uint8_t *extBuf = reinterpret_cast<const uint8_t *>(ext->buf);
+    if (!AVTransVideoBatchMeta::IsBatchVideoMeta(extBuf, static_cast<uint32_t>(ext->bufLen))) {
+        return false;
+    }
+    if (!batchMeta.Unmarshal(extBuf, static_cast<uint32_t>(ext->bufLen))) {
+        AVTRANS_LOGE("Unmarshal batch ext header failed.");
+        return false;
+    }
+    return true;
+}
+
+void DsoftbusInputPlugin::EnqueueBatch(const AVTransVideoBatchMeta &batchMeta, uint32_t dataLen,
+    const BatchFrameCreator &creator)
+{
+    if (batchMeta.GetPayloadLen() != dataLen) {
+        AVTRANS_LOGE("Batch payload len %{public}u mismatch data len %{public}u.", batchMeta.GetPayloadLen(), dataLen);
+        return;
+    }
+    uint32_t offset = 0;
+    for (uint32_t i = 0; i < batchMeta.GetFrameNum(); i++) {
+        auto meta = std::make_shared<AVTransVideoBufferMeta>();
+        uint32_t len = 0;
+        if (!batchMeta.GetFrame(i, *meta, len)) {
+            AVTRANS_LOGE("Unmarshal batch frame %{public}u failed.", i);
+            return;
+        }
+        if (offset > dataLen || len > dataLen - offset) {
+            AVTRANS_LOGE("Batch frame %{public}u len %{public}u exceeds data len %{public}u.", i, len, dataLen);
+            return;
+        }
+        auto buffer = creator(offset, len, meta);
+        if (buffer != nullptr) {
+            DataEnqueue(buffer);
+        }
+        offset += len;
+    }
+}
+
+bool DsoftbusInputPlugin::UnmarshalExt(const StreamData *ext, std::shared_ptr<AVTransVideoBufferMeta> &meta)
+{
+    if (ext == nullptr || ext->buf == nullptr || ext->bufLen <= 0) {
+        AVTRANS_LOGE("ext is nullptr.");
+        return false;
+    }
+    const uint8_t *extBuf = reinterpret_cast<const uint8_t *>(ext->buf);
+    if (AVTransVideoBufferMeta::IsBinaryVideoMeta(extBuf, static_cast<uint32_t>(ext->bufLen))) {
+        if (!meta->UnmarshalVideoMetaBinary(extBuf, static_cast<uint32_t>(ext->bufLen))) {
+            AVTRANS_LOGE("Unmarshal binary ext header failed.");
+            return false;
+        }
+        return true;
+    }
+    return UnmarshalJsonExt(ext, meta);
+}
+
+bool DsoftbusInputPlugin::UnmarshalJsonExt(const StreamData *ext, std::shared_ptr<AVTransVideoBufferMeta> &meta)
+{
     std::string message(reinterpret_cast<const char *>(ext->buf), ext->bufLen);
     AVTRANS_LOGI("Receive message : %{public}s", message.c_str());
     cJSON *resMsg = cJSON_Parse(message.c_str());
     if (resMsg == nullptr) {
         AVTRANS_LOGE("The resMsg parse failed.");
-        return;
+        return false;
     }
     if (!IsUInt32(resMsg, AVT_DATA_META_TYPE)) {
         AVTRANS_LOGE("Invalid data type.");
         cJSON_Delete(resMsg);
-        return;
+        return false;
     }
     cJSON *typeItem = cJSON_GetObjectItem(resMsg, AVT_DATA_META_TYPE.c_str());
-    if (typeItem == NULL || !cJSON_IsNumber(typeItem)) {
+    if (typeItem == NULL || !cJSON_IsNumber(typeItem) ||
+        static_cast<uint32_t>(typeItem->valueint) != static_cast<uint32_t>(BufferMetaType::VIDEO)) {
         cJSON_Delete(resMsg);
-        return;
+        return false;
     }
-    uint32_t metaType = static_cast<uint32_t>(typeItem->valueint);
-    auto buffer = CreateBuffer(metaType, data, resMsg);
-    if (buffer != nullptr) {
-        DataEnqueue(buffer);
+    cJSON *paramItem = cJSON_GetObjectItem(resMsg, AVT_DATA_PARAM.c_str());
+    if (paramItem == NULL || !cJSON_IsString(paramItem)) {
+        cJSON_Delete(resMsg);
+        return false;
+    }
+    if (!meta->UnmarshalVideoMeta(std::string(paramItem->valuestring))) {
+        AVTRANS_LOGE("Unmarshal video buffer eta failed.");
+        cJSON_Delete(resMsg);
+        return false;
     }
     cJSON_Delete(resMsg);
+    return true;
 }
 
-std::shared_ptr<Buffer> DsoftbusInputPlugin::CreateBuffer(uint32_t metaType,
-    const StreamData *data, const cJSON *resMsg)
+void DsoftbusInputPlugin::SendExtHeaderCapability()
+{
+    cJSON *capMsg = cJSON_CreateObject();
+    if (capMsg == nullptr) {
+        return;
+    }
+    cJSON_AddNumberToObject(capMsg, AVT_DATA_EXT_VERSION.c_str(), AVT_EXT_HEADER_VERSION_BATCH);
+    char *str = cJSON_PrintUnformatted(capMsg);
+    if (str == nullptr) {
+        cJSON_Delete(capMsg);
+        return;
+    }
+    std::string capStr = std::string(str);
+    cJSON_free(str);
+    cJSON_Delete(capMsg);
+
+    char version = static_cast<char>(AVT_EXT_HEADER_VERSION_BATCH);
+    StreamData data = {&version, sizeof(version)};
+    StreamData ext = {const_cast<char *>(capStr.c_str()), capStr.length()};
+    int32_t ret = SoftbusChannelAdapter::GetInstance().SendStreamData(sessionName_, peerDevId_, &data, &ext);
+    if (ret != DH_AVT_SUCCESS) {
+        AVTRANS_LOGE("Send ext header capability failed, peer keeps json ext.");
+    }
+}
+
+std::shared_ptr<Buffer> DsoftbusInputPlugin::CreateBuffer(const StreamData *data,
+    const std::shared_ptr<AVTransVideoBufferMeta> &meta)
 {
     if (data == nullptr) {
         AVTRANS_LOGE("data is nullptr.");
         return nullptr;
     }
-    auto buffer = Buffer::CreateDefaultBuffer(static_cast<BufferMetaType>(metaType), data->bufLen);
-    auto bufData = buffer->GetMemory();
+    auto buffer = std::make_shared<Buffer>(BufferMetaType::VIDEO);
+    auto bufData = buffer->AllocMemory(GetAVTransPoolAllocator(), data->bufLen);
     if (bufData == nullptr) {
         AVTRANS_LOGE("bufferData is nullptr.");
         return nullptr;
@@ -297,24 +449,38 @@ std::shared_ptr<Buffer> DsoftbusInputPlugin::CreateBuffer(uint32_t metaType,
         AVTRANS_LOGE("write buffer data failed.");
         return buffer;
     }
-    cJSON *paramItem = cJSON_GetObjectItem(resMsg, AVT_DATA_PARAM.c_str());
-    if (paramItem == NULL || !cJSON_IsString(paramItem)) {
+    SetBufferMeta(buffer, meta);
+    return buffer;
+}
+
+std::shared_ptr<Buffer> DsoftbusInputPlugin::WrapPayloadBuffer(std::shared_ptr<uint8_t> payload, uint32_t size,
+    const std::shared_ptr<AVTransVideoBufferMeta> &meta)
+{
+    if (payload == nullptr || size == 0) {
+        AVTRANS_LOGE("payload is nullptr.");
         return nullptr;
     }
-    auto meta = std::make_shared<AVTransVideoBufferMeta>();
-    if (!meta->UnmarshalVideoMeta(std::string(paramItem->valuestring))) {
-        AVTRANS_LOGE("Unmarshal video buffer eta failed.");
+    // the buffer holds the pooled payload, it goes back to the pool when the last reference is released
+    auto buffer = std::make_shared<Buffer>(BufferMetaType::VIDEO);
+    if (buffer->WrapMemoryPtr(std::move(payload), size, size) == nullptr) {
+        AVTRANS_LOGE("wrap payload memory failed.");
         return nullptr;
     }
+    SetBufferMeta(buffer, meta);
+    return buffer;
+}
+
+void DsoftbusInputPlugin::SetBufferMeta(std::shared_ptr<Buffer> &buffer,
+    const std::shared_ptr<AVTransVideoBufferMeta> &meta)
+{
     buffer->pts = meta->pts_;
     buffer->GetBufferMeta()->SetMeta(Tag::USER_FRAME_NUMBER, meta->frameNum_);
     if ((meta->extFrameNum_ > 0) && (meta->extPts_ > 0)) {
         buffer->GetBufferMeta()->SetMeta(Tag::MEDIA_START_TIME, meta->extPts_);
         buffer->GetBufferMeta()->SetMeta(Tag::AUDIO_SAMPLE_PER_FRAME, meta->extFrameNum_);
     }
-    AVTRANS_LOGI("buffer pts: %{public}ld, bufferLen: %{public}zu, frameNumber: %{public}zu",
+    AVTRANS_LOGD("buffer pts: %{public}ld, bufferLen: %{public}zu, frameNumber: %{public}u",
         buffer->pts, buffer->GetMemory()->GetSize(), meta->frameNum_);
-    return buffer;
 }
 
 void DsoftbusInputPlugin::DataEnqueue(std::shared_ptr<Buffer> &buffer)
@@ -349,16 +515,14 @@ void DsoftbusInputPlugin::HandleData()
 {
     AVTRANS_LOGI("HandleData enter.");
     while (isrunning_) {
-        if (GetCurrentState() != State::RUNNING) {
-            continue;
-        }
         std::shared_ptr<Buffer> buffer;
         {
             std::unique_lock<std::mutex> lock(dataQueueMtx_);
-            dataCond_.wait_for(lock, std::chrono::milliseconds(PLUGIN_TASK_WAIT_TIME),
-                [this]() { return !dataQueue_.empty(); });
-            if (dataQueue_.empty()) {
-                continue;
+            dataCond_.wait(lock, [this]() {
+                return !isrunning_ || (GetCurrentState() == State::RUNNING && !dataQueue_.empty());
+            });
+            if (!isrunning_) {
+                break;
             }
             buffer = dataQueue_.front();
             dataQueue_.pop();
@@ -372,6 +536,12 @@ void DsoftbusInputPlugin::HandleData()
     AVTRANS_LOGI("HandleData end.");
 }
 
+void DsoftbusInputPlugin::WakeUpHandleData()
+{
+    std::lock_guard<std::mutex> lock(dataQueueMtx_);
+    dataCond_.notify_all();
+}
+
 void DsoftbusInputPlugin::DataQueueClear(std::queue<std::shared_ptr<Buffer>> &queue)
 {
     std::lock_guard<std::mutex> lock(dataQueueMtx_);
@@ -45,6 +45,9 @@ namespace DistributedHardware {
 using namespace Media::Plugin;
 
 using AVDataCallback = std::function<void(std::shared_ptr<Buffer>)>;
+// creates the buffer of one frame at [offset, offset + len) of a batch payload
+using BatchFrameCreator = std::function<std::shared_ptr<Buffer>(uint32_t offset, uint32_t len,
+    const std::shared_ptr<AVTransVideoBufferMeta> &meta)>;
 
 class DsoftbusInputPlugin : public AvTransInputPlugin,
                             public ISoftbusChannelListener,
@@ -74,12 +77,23 @@ public:
     // interface from ISoftbusChannelListener
     void OnChannelEvent(const AVTransEvent &event) override;
     void OnStreamReceived(const StreamData *data, const StreamData *ext) override;
+    StreamPayloadAllocator GetStreamPayloadAllocator() override;
+    void OnStreamPayloadReceived(std::shared_ptr<uint8_t> payload, uint32_t size, const StreamData *ext) override;
 
 private:
     void HandleData();
+    void WakeUpHandleData();
     void DataEnqueue(std::shared_ptr<Buffer> &buffer);
     void DataQueueClear(std::queue<std::shared_ptr<Buffer>> &queue);
-    std::shared_ptr<Buffer> CreateBuffer(uint32_t metaType, const StreamData *data, const cJSON *resMsg);
+    std::shared_ptr<Buffer> CreateBuffer(const StreamData *data, const std::shared_ptr<AVTransVideoBufferMeta> &meta);
+    std::shared_ptr<Buffer> WrapPayloadBuffer(std::shared_ptr<uint8_t> payload, uint32_t size,
+        const std::shared_ptr<AVTransVideoBufferMeta> &meta);
+    void SetBufferMeta(std::shared_ptr<Buffer> &buffer, const std::shared_ptr<AVTransVideoBufferMeta> &meta);
+    bool UnmarshalExt(const StreamData *ext, std::shared_ptr<AVTransVideoBufferMeta> &meta);
+    bool UnmarshalBatchExt(const StreamData *ext, AVTransVideoBatchMeta &batchMeta);
+    void EnqueueBatch(const AVTransVideoBatchMeta &batchMeta, uint32_t dataLen, const BatchFrameCreator &creator);
+    bool UnmarshalJsonExt(const StreamData *ext, std::shared_ptr<AVTransVideoBufferMeta> &meta);
+    void SendExtHeaderCapability();
     State GetCurrentState()
     {
         std::lock_guard<std::mutex> lock(stateMutex_);
@@ -88,8 +102,11 @@ private:
 
     void SetCurrentState(State state)
     {
-        std::lock_guard<std::mutex> lock(stateMutex_);
-        state_ = state;
+        {
+            std::lock_guard<std::mutex> lock(stateMutex_);
+            state_ = state;
+        }
+        WakeUpHandleData();
     }
 
 private:
@@ -15,6 +15,8 @@
 
 #include "dsoftbus_input_audio_plugin.h"
 
+#include <cinttypes>
+
 #include "foundation/utils/constants.h"
 #include "plugin/common/share_memory.h"
 #include "plugin/common/plugin_caps_builder.h"
@@ -112,6 +114,7 @@ Status DsoftbusInputAudioPlugin::Reset()
     }
     if (bufferPopTask_) {
         isrunning_.store(false);
+        WakeUpHandleData();
         bufferPopTask_->Stop();
         bufferPopTask_.reset();
     }
@@ -129,12 +132,16 @@ Status DsoftbusInputAudioPlugin::Start()
         AVTRANS_LOGE("The state is wrong.");
         return Status::ERROR_WRONG_STATE;
     }
+    int64_t startTime = GetCurrentTime();
     DataQueueClear(dataQueue_);
     isrunning_.store(true);
     if (bufferPopTask_) {
         bufferPopTask_->Start();
     }
     SetCurrentState(State::RUNNING);
+    int64_t costMs = (GetCurrentTime() - startTime) / NS_ONE_MS;
+    AVTRANS_LOGI("Start success, cost %{public}" PRId64 " ms.", costMs);
+    TRUE_LOG_MSG(costMs > PLUGIN_STATE_CHANGE_MAX_COST_MS, "Start cost exceeds the bound.");
     return Status::OK;
 }
 
@@ -145,12 +152,17 @@ Status DsoftbusInputAudioPlugin::Stop()
         AVTRANS_LOGE("The state is wrong.");
         return Status::ERROR_WRONG_STATE;
     }
+    int64_t startTime = GetCurrentTime();
     SetCurrentState(State::PREPARED);
     isrunning_.store(false);
+    WakeUpHandleData();
     DataQueueClear(dataQueue_);
     if (bufferPopTask_) {
         bufferPopTask_->Stop();
     }
+    int64_t costMs = (GetCurrentTime() - startTime) / NS_ONE_MS;
+    AVTRANS_LOGI("Stop success, cost %{public}" PRId64 " ms.", costMs);
+    TRUE_LOG_MSG(costMs > PLUGIN_STATE_CHANGE_MAX_COST_MS, "Stop cost exceeds the bound.");
     return Status::OK;
 }
 
@@ -269,8 +281,12 @@ std::shared_ptr<Buffer> DsoftbusInputAudioPlugin::CreateBuffer(uint32_t metaType
         AVTRANS_LOGE("data is nullptr.");
         return nullptr;
     }
-    auto buffer = Buffer::CreateDefaultBuffer(static_cast<BufferMetaType>(metaType), data->bufLen);
-    auto bufData = buffer->GetMemory();
+    auto buffer = std::make_shared<Buffer>(static_cast<BufferMetaType>(metaType));
+    auto bufData = buffer->AllocMemory(GetAVTransPoolAllocator(), data->bufLen);
+    if (bufData == nullptr) {
+        AVTRANS_LOGE("bufferData is nullptr.");
+        return nullptr;
+    }
 
     auto writeSize = bufData->Write(reinterpret_cast<const uint8_t *>(data->buf), data->bufLen, 0);
     if (static_cast<ssize_t>(writeSize) != data->bufLen) {
@@ -306,16 +322,14 @@ void DsoftbusInputAudioPlugin::HandleData()
 {
     AVTRANS_LOGI("HandleData enter.");
     while (isrunning_) {
-        if (GetCurrentState() != State::RUNNING) {
-            continue;
-        }
         std::shared_ptr<Buffer> buffer;
         {
             std::unique_lock<std::mutex> lock(dataQueueMtx_);
-            dataCond_.wait_for(lock, std::chrono::milliseconds(PLUGIN_TASK_WAIT_TIME),
-                [this]() { return !dataQueue_.empty(); });
-            if (dataQueue_.empty()) {
-                continue;
+            dataCond_.wait(lock, [this]() {
+                return !isrunning_ || (GetCurrentState() == State::RUNNING && !dataQueue_.empty());
+            });
+            if (!isrunning_) {
+                break;
             }
             buffer = dataQueue_.front();
             dataQueue_.pop();
@@ -329,6 +343,12 @@ void DsoftbusInputAudioPlugin::HandleData()
     AVTRANS_LOGI("HandleData end.");
 }
 
+void DsoftbusInputAudioPlugin::WakeUpHandleData()
+{
+    std::lock_guard<std::mutex> lock(dataQueueMtx_);
+    dataCond_.notify_all();
+}
+
 void DsoftbusInputAudioPlugin::DataQueueClear(std::queue<std::shared_ptr<Buffer>> &queue)
 {
     std::lock_guard<std::mutex> lock(dataQueueMtx_);
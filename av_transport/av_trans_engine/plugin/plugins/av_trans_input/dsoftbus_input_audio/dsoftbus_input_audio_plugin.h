@@ -71,6 +71,7 @@ public:
 
 private:
     void HandleData();
+    void WakeUpHandleData();
     void DataEnqueue(std::shared_ptr<Buffer> &buffer);
     void DataQueueClear(std::queue<std::shared_ptr<Buffer>> &queue);
     std::shared_ptr<Buffer> CreateBuffer(uint32_t metaType, const StreamData *data, const cJSON *resMsg);
@@ -82,8 +83,11 @@ private:
 
     void SetCurrentState(State state)
     {
-        std::lock_guard<std::mutex> lock(stateMutex_);
-        state_ = state;
+        {
+            std::lock_guard<std::mutex> lock(stateMutex_);
+            state_ = state;
+        }
+        WakeUpHandleData();
     }
 
 private:
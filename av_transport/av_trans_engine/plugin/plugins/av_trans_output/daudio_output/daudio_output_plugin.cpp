@@ -15,6 +15,9 @@
 
 #include "daudio_output_plugin.h"
 
+#include <cinttypes>
+
+#include "av_trans_utils.h"
 #include "foundation/utils/constants.h"
 #include "plugin/common/plugin_caps_builder.h"
 #include "plugin/factory/plugin_factory.h"
@@ -59,6 +62,8 @@ DaudioOutputPlugin::DaudioOutputPlugin(std::string name)
 DaudioOutputPlugin::~DaudioOutputPlugin()
 {
     AVTRANS_LOGI("dtor.");
+    std::unique_lock<std::mutex> lock(sharedMemMtx_);
+    UnmapAVTransSharedMemory(sharedMemoryMap_);
 }
 
 Status DaudioOutputPlugin::Init()
@@ -135,6 +140,7 @@ Status DaudioOutputPlugin::Reset()
     eventcallback_ = nullptr;
     if (sendPlayTask_) {
         isrunning_.store(false);
+        WakeUpHandleData();
         sendPlayTask_->Stop();
         sendPlayTask_.reset();
     }
@@ -153,6 +159,9 @@ Status DaudioOutputPlugin::Reset()
 
 Status DaudioOutputPlugin::GetParameter(Tag tag, ValueType &value)
 {
+    // output statistics are collected by the output controller, which only the video output runs
+    TRUE_RETURN_V_MSG_E(tag == TAG_OUTPUT_STATISTICS, Status::ERROR_UNIMPLEMENTED,
+        "Output statistics are not supported by audio output.");
     std::lock_guard<std::mutex> lock(paramsMapMutex_);
     auto iter = paramsMap_.find(tag);
     if (iter != paramsMap_.end()) {
@@ -164,11 +173,18 @@ Status DaudioOutputPlugin::GetParameter(Tag tag, ValueType &value)
 
 Status DaudioOutputPlugin::SetParameter(Tag tag, const ValueType &value)
 {
+    TRUE_RETURN_V_MSG_E(tag == TAG_OUTPUT_STATISTICS, Status::ERROR_UNIMPLEMENTED,
+        "Output statistics are not supported by audio output.");
     std::lock_guard<std::mutex> mutexLock(paramsMapMutex_);
     paramsMap_.insert(std::make_pair(tag, value));
     if (tag == Plugin::Tag::USER_SHARED_MEMORY_FD) {
         std::unique_lock<std::mutex> lock(sharedMemMtx_);
         sharedMemory_ = UnmarshalSharedMemory(Media::Plugin::AnyCast<std::string>(value));
+        if (IsInValidSharedMemory(sharedMemory_)) {
+            UnmapAVTransSharedMemory(sharedMemoryMap_);
+        } else {
+            MapAVTransSharedMemory(sharedMemory_, sharedMemoryMap_);
+        }
     }
     if (tag == Plugin::Tag::USER_AV_SYNC_GROUP_INFO) {
         std::string groupInfo = Media::Plugin::AnyCast<std::string>(value);
@@ -185,12 +201,16 @@ Status DaudioOutputPlugin::Start()
         AVTRANS_LOGE("The state is wrong.");
         return Status::ERROR_WRONG_STATE;
     }
+    int64_t startTime = GetCurrentTime();
     DataQueueClear(outputBuffer_);
     isrunning_.store(true);
     if (sendPlayTask_) {
         sendPlayTask_->Start();
     }
     SetCurrentState(State::RUNNING);
+    int64_t costMs = (GetCurrentTime() - startTime) / NS_ONE_MS;
+    AVTRANS_LOGI("Start success, cost %{public}" PRId64 " ms.", costMs);
+    TRUE_LOG_MSG(costMs > PLUGIN_STATE_CHANGE_MAX_COST_MS, "Start cost exceeds the bound.");
     return Status::OK;
 }
 
@@ -201,12 +221,17 @@ Status DaudioOutputPlugin::Stop()
         AVTRANS_LOGE("The state is wrong.");
         return Status::ERROR_WRONG_STATE;
     }
+    int64_t startTime = GetCurrentTime();
     SetCurrentState(State::PREPARED);
     isrunning_.store(false);
+    WakeUpHandleData();
     if (sendPlayTask_) {
         sendPlayTask_->Stop();
     }
     DataQueueClear(outputBuffer_);
+    int64_t costMs = (GetCurrentTime() - startTime) / NS_ONE_MS;
+    AVTRANS_LOGI("Stop success, cost %{public}" PRId64 " ms.", costMs);
+    TRUE_LOG_MSG(costMs > PLUGIN_STATE_CHANGE_MAX_COST_MS, "Stop cost exceeds the bound.");
     return Status::OK;
 }
 
@@ -263,16 +288,14 @@ void DaudioOutputPlugin::HandleData()
 {
     AVTRANS_LOGI("HandleData enter.");
     while (isrunning_) {
-        if (GetCurrentState() != State::RUNNING) {
-            continue;
-        }
         std::shared_ptr<Plugin::Buffer> buffer;
         {
             std::unique_lock<std::mutex> lock(dataQueueMtx_);
-            dataCond_.wait_for(lock, std::chrono::milliseconds(PLUGIN_TASK_WAIT_TIME),
-                [this]() { return !outputBuffer_.empty(); });
-            if (outputBuffer_.empty()) {
-                continue;
+            dataCond_.wait(lock, [this]() {
+                return !isrunning_ || (GetCurrentState() == State::RUNNING && !outputBuffer_.empty());
+            });
+            if (!isrunning_) {
+                break;
             }
             buffer = outputBuffer_.front();
             outputBuffer_.pop();
@@ -287,6 +310,12 @@ void DaudioOutputPlugin::HandleData()
     AVTRANS_LOGI("HandleData end.");
 }
 
+void DaudioOutputPlugin::WakeUpHandleData()
+{
+    std::lock_guard<std::mutex> lock(dataQueueMtx_);
+    dataCond_.notify_all();
+}
+
 void DaudioOutputPlugin::WriteMasterClockToMemory(const std::shared_ptr<Plugin::Buffer> &buffer)
 {
     std::unique_lock<std::mutex> lock(sharedMemMtx_);
@@ -312,7 +341,7 @@ void DaudioOutputPlugin::WriteMasterClockToMemory(const std::shared_ptr<Plugin::
     uint32_t frameNum = Plugin::AnyCast<uint32_t>(buffer->GetBufferMeta()->GetMeta(Tag::USER_FRAME_NUMBER));
     int64_t pts = Plugin::AnyCast<int64_t>(buffer->GetBufferMeta()->GetMeta(Tag::USER_FRAME_PTS));
     AVSyncClockUnit clockUnit = AVSyncClockUnit{ smIndex_, frameNum, pts };
-    int32_t ret = WriteClockUnitToMemory(sharedMemory_, clockUnit);
+    int32_t ret = WriteClockUnitToMemory(sharedMemoryMap_, clockUnit);
     if (ret == DH_AVT_SUCCESS) {
         smIndex_ = clockUnit.index;
     }
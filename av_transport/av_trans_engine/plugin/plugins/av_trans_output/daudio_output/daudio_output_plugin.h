@@ -66,6 +66,7 @@ private:
     Status StartOutputQueue();
     Status ControlFrameRate(const int64_t timestamp);
     void HandleData();
+    void WakeUpHandleData();
     void DataQueueClear(std::queue<std::shared_ptr<Buffer>> &q);
     void RampleInit(uint32_t channels, uint32_t sampleRate, uint32_t channelLayout);
     void WriteMasterClockToMemory(const std::shared_ptr<Plugin::Buffer> &buffer);
@@ -77,8 +78,11 @@ private:
 
     void SetCurrentState(State state)
     {
-        std::lock_guard<std::mutex> lock(stateMutex_);
-        state_ = state;
+        {
+            std::lock_guard<std::mutex> lock(stateMutex_);
+            state_ = state;
+        }
+        WakeUpHandleData();
     }
 private:
     std::condition_variable dataCond_;
@@ -97,6 +101,7 @@ private:
     std::mutex sharedMemMtx_;
     std::atomic<bool> isrunning_ = false;
     AVTransSharedMemory sharedMemory_ = AVTransSharedMemory{ 0, 0, "" };
+    AVTransMappedMemory sharedMemoryMap_;
 };
 } // namespace DistributedHardware
 } // namespace OHOS
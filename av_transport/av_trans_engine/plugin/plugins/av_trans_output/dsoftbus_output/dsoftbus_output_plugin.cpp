@@ -14,6 +14,8 @@
  */
 #include "dsoftbus_output_plugin.h"
 
+#include <cinttypes>
+#include <securec.h>
 #include <unistd.h>
 #include <sys/types.h>
 #include <sys/stat.h>
@@ -112,6 +114,8 @@ Status DsoftbusOutputPlugin::Reset()
         bufferPopTask_.reset();
     }
     DataQueueClear(dataQueue_);
+    ClearBatch();
+    extHeaderVersion_.store(AVT_EXT_HEADER_VERSION_JSON);
     eventsCb_ = nullptr;
     SoftbusChannelAdapter::GetInstance().UnRegisterChannelListener(sessionName_, peerDevId_);
     SetCurrentState(State::INITIALIZED);
@@ -131,6 +135,7 @@ Status DsoftbusOutputPlugin::Start()
         return Status::ERROR_INVALID_OPERATION;
     }
     DataQueueClear(dataQueue_);
+    ClearBatch();
     if (bufferPopTask_) {
         bufferPopTask_->Start();
     }
@@ -150,12 +155,18 @@ Status DsoftbusOutputPlugin::Stop()
         bufferPopTask_->Stop();
     }
     DataQueueClear(dataQueue_);
+    ClearBatch();
     CloseSoftbusChannel();
+    extHeaderVersion_.store(AVT_EXT_HEADER_VERSION_JSON);
     return Status::OK;
 }
 
 Status DsoftbusOutputPlugin::GetParameter(Tag tag, ValueType &value)
 {
+    if (tag == TAG_SEND_BATCHING) {
+        value = GetBatchParameter();
+        return Status::OK;
+    }
     std::lock_guard<std::mutex> lock(paramMapMutex_);
     auto res = paramsMap_.find(tag);
     if (res != paramsMap_.end()) {
@@ -167,6 +178,12 @@ Status DsoftbusOutputPlugin::GetParameter(Tag tag, ValueType &value)
 
 Status DsoftbusOutputPlugin::SetParameter(Tag tag, const ValueType &value)
 {
+    if (tag == TAG_SEND_BATCHING) {
+        TRUE_RETURN_V_MSG_E(!Plugin::Any::IsSameTypeWith<std::string>(value), Status::ERROR_INVALID_PARAMETER,
+            "Send batching parameter type is invalid.");
+        SetBatchParameter(Plugin::AnyCast<std::string>(value));
+        return Status::OK;
+    }
     std::lock_guard<std::mutex> lock(paramMapMutex_);
     if (tag == Tag::MEDIA_DESCRIPTION) {
         ParseChannelDescription(Plugin::AnyCast<std::string>(value), ownerName_, peerDevId_);
@@ -244,7 +261,26 @@ void DsoftbusOutputPlugin::OnChannelEvent(const AVTransEvent &event)
 void DsoftbusOutputPlugin::OnStreamReceived(const StreamData *data, const StreamData *ext)
 {
     (void)data;
-    (void)ext;
+    if (ext == nullptr || ext->buf == nullptr || ext->bufLen <= 0) {
+        return;
+    }
+    // the only stream the receiver sends back is its ext header capability announcement
+    std::string message(reinterpret_cast<const char *>(ext->buf), ext->bufLen);
+    cJSON *capMsg = cJSON_Parse(message.c_str());
+    if (capMsg == nullptr) {
+        AVTRANS_LOGE("The capMsg parse failed.");
+        return;
+    }
+    cJSON *versionItem = cJSON_GetObjectItem(capMsg, AVT_DATA_EXT_VERSION.c_str());
+    if (versionItem == nullptr || !IsUInt32(capMsg, AVT_DATA_EXT_VERSION)) {
+        cJSON_Delete(capMsg);
+        return;
+    }
+    uint32_t peerVersion = static_cast<uint32_t>(versionItem->valueint);
+    cJSON_Delete(capMsg);
+    uint8_t version = static_cast<uint8_t>(std::min<uint32_t>(peerVersion, AVT_EXT_HEADER_VERSION_BATCH));
+    extHeaderVersion_.store(version);
+    AVTRANS_LOGI("Peer ext header version: %{public}u, use version: %{public}u.", peerVersion, version);
 }
 
 Status DsoftbusOutputPlugin::PushData(const std::string &inPort, std::shared_ptr<Buffer> buffer, int32_t offset)
@@ -282,77 +318,264 @@ void DsoftbusOutputPlugin::FeedChannelData()
 {
     while (GetCurrentState() == State::RUNNING) {
         std::shared_ptr<Buffer> buffer;
+        bool isQueueEmpty = true;
         {
             std::unique_lock<std::mutex> lock(dataQueueMtx_);
-            dataCond_.wait_for(lock, std::chrono::milliseconds(PLUGIN_TASK_WAIT_TIME),
+            dataCond_.wait_for(lock, std::chrono::nanoseconds(GetFeedWaitTime()),
                 [this]() { return !dataQueue_.empty(); });
             if (GetCurrentState() != State::RUNNING) {
                 return;
             }
-            if (dataQueue_.empty()) {
-                continue;
+            if (!dataQueue_.empty()) {
+                buffer = dataQueue_.front();
+                dataQueue_.pop();
             }
-            buffer = dataQueue_.front();
-            dataQueue_.pop();
+            isQueueEmpty = dataQueue_.empty();
         }
-        if (buffer == nullptr) {
-            AVTRANS_LOGE("Data is null");
-            continue;
+        if (buffer != nullptr) {
+            FeedBuffer(buffer);
+        }
+        if (!batchFrames_.empty() && IsBatchDue(isQueueEmpty)) {
+            SendBatchToSoftbus();
         }
+    }
+}
+
+int64_t DsoftbusOutputPlugin::GetFeedWaitTime()
+{
+    if (batchFrames_.empty()) {
+        return PLUGIN_TASK_WAIT_TIME * NS_ONE_MS;
+    }
+    int64_t waitTime = batchDeadline_ - GetCurrentTime();
+    return (waitTime > 0) ? waitTime : 0;
+}
+
+void DsoftbusOutputPlugin::FeedBuffer(std::shared_ptr<Buffer> &buffer)
+{
+    if (!IsBatchable(buffer)) {
+        // frames leave in push order, so the pending batch goes first
+        SendBatchToSoftbus();
         SendDataToSoftbus(buffer);
+        return;
+    }
+    uint32_t size = static_cast<uint32_t>(buffer->GetMemory()->GetSize());
+    if ((batchFrames_.size() >= AVT_BATCH_MAX_FRAME_NUM) || (batchBytes_ + size > batchMaxBytes_.load())) {
+        SendBatchToSoftbus();
+    }
+    if (batchFrames_.empty()) {
+        batchDeadline_ = GetCurrentTime() + batchMaxDelayMs_.load() * NS_ONE_MS;
     }
+    batchFrames_.push_back(buffer);
+    batchBytes_ += size;
 }
 
-void DsoftbusOutputPlugin::SendDataToSoftbus(std::shared_ptr<Buffer> &buffer)
+bool DsoftbusOutputPlugin::IsBatchable(const std::shared_ptr<Buffer> &buffer)
 {
+    if (!batchEnabled_.load() || (extHeaderVersion_.load() < AVT_EXT_HEADER_VERSION_BATCH)) {
+        return false;
+    }
     if (buffer == nullptr || buffer->GetBufferMeta() == nullptr || buffer->GetMemory() == nullptr) {
-        AVTRANS_LOGE("buffer or getbuffermeta or getmemory is nullptr.");
+        return false;
+    }
+    // the batch header carries video metas only; audio is sent by DsoftbusOutputAudioPlugin with its own meta
+    // and a frame every few ms, where batching would add latency the audio sync is sensitive to
+    return (buffer->GetBufferMeta()->GetType() == BufferMetaType::VIDEO) &&
+        (buffer->GetMemory()->GetSize() <= batchMaxBytes_.load());
+}
+
+bool DsoftbusOutputPlugin::IsBatchDue(bool isQueueEmpty)
+{
+    if (!batchEnabled_.load()) {
+        return true;
+    }
+    // without a delay a frame never waits for company, only a backlog that is already queued gets merged
+    if (batchMaxDelayMs_.load() == 0) {
+        return isQueueEmpty;
+    }
+    return GetCurrentTime() >= batchDeadline_;
+}
+
+void DsoftbusOutputPlugin::SendBatchToSoftbus()
+{
+    if (batchFrames_.size() <= 1) {
+        if (!batchFrames_.empty()) {
+            SendDataToSoftbus(batchFrames_.front());
+        }
+        ClearBatch();
         return;
     }
-    cJSON *jsonObj = cJSON_CreateObject();
-    if (jsonObj == nullptr) {
+    // softbus takes one data block per send, gather the payloads once into a pooled block
+    auto payload = AVTransBufferPool::GetInstance().Acquire(batchBytes_);
+    if (payload == nullptr) {
+        AVTRANS_LOGE("Acquire batch payload failed, send frames one by one.");
+        for (auto &buffer : batchFrames_) {
+            SendDataToSoftbus(buffer);
+        }
+        ClearBatch();
         return;
     }
+    AVTransVideoBatchMeta batchMeta;
+    uint32_t offset = 0;
+    for (auto &buffer : batchFrames_) {
+        AVTransVideoBufferMeta meta;
+        if (!BuildVideoMeta(buffer, meta)) {
+            continue;
+        }
+        auto bufferData = buffer->GetMemory();
+        uint32_t size = static_cast<uint32_t>(bufferData->GetSize());
+        if (memcpy_s(payload.get() + offset, batchBytes_ - offset, bufferData->GetReadOnlyData(), size) != EOK) {
+            AVTRANS_LOGE("Copy frame into batch failed.");
+            continue;
+        }
+        if (!batchMeta.AddFrame(meta, size)) {
+            continue;
+        }
+        offset += size;
+    }
+    uint32_t frameNum = batchMeta.GetFrameNum();
+    ClearBatch();
+    if (frameNum == 0) {
+        return;
+    }
+    const std::vector<uint8_t> &extBuf = batchMeta.Marshal();
+    StreamData data = {reinterpret_cast<char *>(payload.get()), offset};
+    StreamData ext = {reinterpret_cast<char *>(const_cast<uint8_t *>(extBuf.data())), extBuf.size()};
+    int32_t ret = SoftbusChannelAdapter::GetInstance().SendStreamData(sessionName_, peerDevId_, &data, &ext);
+    if (ret != DH_AVT_SUCCESS) {
+        AVTRANS_LOGE("Send batch to softbus failed, frameNum: %{public}u.", frameNum);
+        return;
+    }
+    sendCalls_++;
+    sentFrames_ += frameNum;
+}
+
+void DsoftbusOutputPlugin::ClearBatch()
+{
+    batchFrames_.clear();
+    batchBytes_ = 0;
+    batchDeadline_ = 0;
+}
+
+void DsoftbusOutputPlugin::SetBatchParameter(const std::string &jsonStr)
+{
+    cJSON *paramJson = cJSON_Parse(jsonStr.c_str());
+    TRUE_RETURN((paramJson == nullptr), "Parse send batching parameter failed.");
+    cJSON *enableObj = cJSON_GetObjectItem(paramJson, KEY_BATCH_ENABLE.c_str());
+    cJSON *delayObj = cJSON_GetObjectItem(paramJson, KEY_BATCH_MAX_DELAY.c_str());
+    cJSON *bytesObj = cJSON_GetObjectItem(paramJson, KEY_BATCH_MAX_BYTES.c_str());
+    if (!cJSON_IsBool(enableObj)) {
+        AVTRANS_LOGE("Send batching parameter enable is invalid.");
+        cJSON_Delete(paramJson);
+        return;
+    }
+    if (cJSON_IsNumber(delayObj) && delayObj->valueint >= 0) {
+        batchMaxDelayMs_.store(static_cast<int64_t>(delayObj->valueint));
+    }
+    if (cJSON_IsNumber(bytesObj) && bytesObj->valueint > 0) {
+        batchMaxBytes_.store(static_cast<uint32_t>(bytesObj->valueint));
+    }
+    batchEnabled_.store(cJSON_IsTrue(enableObj));
+    cJSON_Delete(paramJson);
+    AVTRANS_LOGI("Send batching enable: %{public}d, maxDelayMs: %{public}" PRId64 ", maxBytes: %{public}u.",
+        batchEnabled_.load(), batchMaxDelayMs_.load(), batchMaxBytes_.load());
+}
+
+std::string DsoftbusOutputPlugin::GetBatchParameter()
+{
+    cJSON *paramJson = cJSON_CreateObject();
+    TRUE_RETURN_V_MSG_E((paramJson == nullptr), "", "Create send batching parameter json failed.");
+    cJSON_AddBoolToObject(paramJson, KEY_BATCH_ENABLE.c_str(), batchEnabled_.load());
+    cJSON_AddNumberToObject(paramJson, KEY_BATCH_MAX_DELAY.c_str(), static_cast<double>(batchMaxDelayMs_.load()));
+    cJSON_AddNumberToObject(paramJson, KEY_BATCH_MAX_BYTES.c_str(), static_cast<double>(batchMaxBytes_.load()));
+    cJSON_AddNumberToObject(paramJson, KEY_BATCH_SENT_FRAMES.c_str(), static_cast<double>(sentFrames_.load()));
+    cJSON_AddNumberToObject(paramJson, KEY_BATCH_SEND_CALLS.c_str(), static_cast<double>(sendCalls_.load()));
+    char *str = cJSON_PrintUnformatted(paramJson);
+    if (str == nullptr) {
+        cJSON_Delete(paramJson);
+        return "";
+    }
+    std::string jsonStr(str);
+    cJSON_free(str);
+    cJSON_Delete(paramJson);
+    return jsonStr;
+}
+
+bool DsoftbusOutputPlugin::BuildVideoMeta(std::shared_ptr<Buffer> &buffer, AVTransVideoBufferMeta &meta)
+{
+    if (buffer == nullptr || buffer->GetBufferMeta() == nullptr || buffer->GetMemory() == nullptr) {
+        AVTRANS_LOGE("buffer or getbuffermeta or getmemory is nullptr.");
+        return false;
+    }
     auto bufferMeta = buffer->GetBufferMeta();
-    BufferMetaType metaType = bufferMeta->GetType();
-    cJSON_AddNumberToObject(jsonObj, AVT_DATA_META_TYPE.c_str(), static_cast<uint32_t>(metaType));
-    if (metaType != BufferMetaType::VIDEO) {
+    if (bufferMeta->GetType() != BufferMetaType::VIDEO) {
         AVTRANS_LOGE("metaType is wrong");
-        cJSON_Delete(jsonObj);
-        return;
+        return false;
     }
-    auto hisAMeta = std::make_shared<AVTransVideoBufferMeta>();
-    hisAMeta->frameNum_ = Plugin::AnyCast<uint32_t>(buffer->GetBufferMeta()->GetMeta(Tag::USER_FRAME_NUMBER));
-    hisAMeta->pts_ = buffer->pts;
-    AVTRANS_LOGI("buffer pts: %{public}ld, bufferLen: %{public}zu, frameNumber: %{public}u",
-        hisAMeta->pts_, buffer->GetMemory()->GetSize(), hisAMeta->frameNum_);
+    meta.frameNum_ = Plugin::AnyCast<uint32_t>(bufferMeta->GetMeta(Tag::USER_FRAME_NUMBER));
+    meta.pts_ = buffer->pts;
+    AVTRANS_LOGD("buffer pts: %{public}ld, bufferLen: %{public}zu, frameNumber: %{public}u",
+        meta.pts_, buffer->GetMemory()->GetSize(), meta.frameNum_);
     if (bufferMeta->IsExist(Tag::MEDIA_START_TIME)) {
-        hisAMeta->extPts_ = Plugin::AnyCast<int64_t>(bufferMeta->GetMeta(Tag::MEDIA_START_TIME));
+        meta.extPts_ = Plugin::AnyCast<int64_t>(bufferMeta->GetMeta(Tag::MEDIA_START_TIME));
     }
     if (bufferMeta->IsExist(Tag::AUDIO_SAMPLE_PER_FRAME)) {
-        hisAMeta->extFrameNum_ = Plugin::AnyCast<uint32_t>(bufferMeta->GetMeta(Tag::AUDIO_SAMPLE_PER_FRAME));
+        meta.extFrameNum_ = Plugin::AnyCast<uint32_t>(bufferMeta->GetMeta(Tag::AUDIO_SAMPLE_PER_FRAME));
     }
-    cJSON_AddStringToObject(jsonObj, AVT_DATA_PARAM.c_str(), hisAMeta->MarshalVideoMeta().c_str());
+    return true;
+}
 
-    char *str = cJSON_PrintUnformatted(jsonObj);
-    if (str == nullptr) {
-        cJSON_Delete(jsonObj);
+void DsoftbusOutputPlugin::SendDataToSoftbus(std::shared_ptr<Buffer> &buffer)
+{
+    AVTransVideoBufferMeta hisAMeta;
+    if (!BuildVideoMeta(buffer, hisAMeta)) {
         return;
     }
-    std::string jsonStr = std::string(str);
-    AVTRANS_LOGI("jsonStr->bufLen %{public}zu, jsonStR: %{public}s", jsonStr.length(), jsonStr.c_str());
-
     auto bufferData = buffer->GetMemory();
     StreamData data = {reinterpret_cast<char *>(const_cast<uint8_t*>(bufferData->GetReadOnlyData())),
         bufferData->GetSize()};
-    StreamData ext = {const_cast<char *>(jsonStr.c_str()), jsonStr.length()};
-
-    int32_t ret = SoftbusChannelAdapter::GetInstance().SendStreamData(sessionName_, peerDevId_, &data, &ext);
+    int32_t ret = DH_AVT_SUCCESS;
+    if (extHeaderVersion_.load() >= AVT_EXT_HEADER_VERSION_BINARY) {
+        uint8_t extHeader[AVT_EXT_HEADER_LEN] = {0};
+        if (!hisAMeta.MarshalVideoMetaBinary(extHeader, AVT_EXT_HEADER_LEN)) {
+            AVTRANS_LOGE("Marshal binary ext header failed.");
+            return;
+        }
+        StreamData ext = {reinterpret_cast<char *>(extHeader), AVT_EXT_HEADER_LEN};
+        ret = SoftbusChannelAdapter::GetInstance().SendStreamData(sessionName_, peerDevId_, &data, &ext);
+    } else {
+        std::string jsonStr = MarshalJsonExt(hisAMeta);
+        if (jsonStr.empty()) {
+            return;
+        }
+        AVTRANS_LOGI("jsonStr->bufLen %{public}zu, jsonStR: %{public}s", jsonStr.length(), jsonStr.c_str());
+        StreamData ext = {const_cast<char *>(jsonStr.c_str()), jsonStr.length()};
+        ret = SoftbusChannelAdapter::GetInstance().SendStreamData(sessionName_, peerDevId_, &data, &ext);
+    }
     if (ret != DH_AVT_SUCCESS) {
         AVTRANS_LOGE("Send data to softbus failed.");
+        return;
+    }
+    sendCalls_++;
+    sentFrames_++;
+}
+
+std::string DsoftbusOutputPlugin::MarshalJsonExt(AVTransVideoBufferMeta &meta)
+{
+    cJSON *jsonObj = cJSON_CreateObject();
+    if (jsonObj == nullptr) {
+        return "";
+    }
+    cJSON_AddNumberToObject(jsonObj, AVT_DATA_META_TYPE.c_str(), static_cast<uint32_t>(BufferMetaType::VIDEO));
+    cJSON_AddStringToObject(jsonObj, AVT_DATA_PARAM.c_str(), meta.MarshalVideoMeta().c_str());
+    char *str = cJSON_PrintUnformatted(jsonObj);
+    if (str == nullptr) {
+        cJSON_Delete(jsonObj);
+        return "";
     }
+    std::string jsonStr = std::string(str);
     cJSON_free(str);
     cJSON_Delete(jsonObj);
+    return jsonStr;
 }
 
 void DsoftbusOutputPlugin::DataQueueClear(std::queue<std::shared_ptr<Buffer>> &queue)
@@ -75,6 +75,16 @@ public:
 private:
     Status OpenSoftbusChannel();
     void SendDataToSoftbus(std::shared_ptr<Buffer> &buffer);
+    bool BuildVideoMeta(std::shared_ptr<Buffer> &buffer, AVTransVideoBufferMeta &meta);
+    void FeedBuffer(std::shared_ptr<Buffer> &buffer);
+    bool IsBatchable(const std::shared_ptr<Buffer> &buffer);
+    bool IsBatchDue(bool isQueueEmpty);
+    void SendBatchToSoftbus();
+    void ClearBatch();
+    int64_t GetFeedWaitTime();
+    void SetBatchParameter(const std::string &jsonStr);
+    std::string GetBatchParameter();
+    std::string MarshalJsonExt(AVTransVideoBufferMeta &meta);
     void DataQueueClear(std::queue<std::shared_ptr<Buffer>> &queue);
     void CloseSoftbusChannel();
     void FeedChannelData();
@@ -104,7 +114,18 @@ private:
     std::queue<std::shared_ptr<Buffer>> dataQueue_;
     std::map<Tag, ValueType> paramsMap_;
     std::atomic<State> state_ = State::CREATED;
+    std::atomic<uint8_t> extHeaderVersion_ = AVT_EXT_HEADER_VERSION_JSON;
     Callback* eventsCb_ = nullptr;
+
+    std::atomic<bool> batchEnabled_ = false;
+    std::atomic<int64_t> batchMaxDelayMs_ = SEND_BATCH_DEFAULT_DELAY_MS;
+    std::atomic<uint32_t> batchMaxBytes_ = SEND_BATCH_DEFAULT_MAX_BYTES;
+    std::atomic<uint64_t> sentFrames_ = 0;
+    std::atomic<uint64_t> sendCalls_ = 0;
+    // frames waiting to be coalesced into one send, only touched by the feed thread
+    std::vector<std::shared_ptr<Buffer>> batchFrames_;
+    uint32_t batchBytes_ = 0;
+    int64_t batchDeadline_ = 0;
 };
 } // namespace DistributedHardware
 } // namespace OHOS
@@ -259,7 +259,7 @@ Status DsoftbusOutputAudioPlugin::PushData(const std::string &inPort, std::share
     size_t bufSize = buffer->GetMemory()->GetSize();
     auto tempBuffer = std::make_shared<Plugin::Buffer>(BufferMetaType::AUDIO);
     tempBuffer->pts = buffer->pts;
-    tempBuffer->AllocMemory(nullptr, bufSize);
+    tempBuffer->AllocMemory(GetAVTransPoolAllocator(), bufSize);
     tempBuffer->GetMemory()->Write(buffer->GetMemory()->GetReadOnlyData(), bufSize);
     tempBuffer->UpdateBufferMeta(*(buffer->GetBufferMeta()->Clone()));
     dataQueue_.push(tempBuffer);
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_JITTER_ESTIMATOR_H
+#define OHOS_JITTER_ESTIMATOR_H
+
+#include <cstdint>
+#include <mutex>
+
+#include "av_trans_utils.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+/**
+ * Target buffering delay of the adaptive control mode.
+ * The inter-arrival jitter is smoothed like the rfc3550 jitter, frame loss as a moving ratio. The target
+ * follows a raise of either at once and shrinks slowly, bounded by the min and max latency. Frames are
+ * played out at the arrival baseline plus the timestamp offset plus the target. The baseline follows the
+ * fastest transit, so a sender clock drifting from ours does not eat up the buffer.
+ * All times are in nanoseconds. Thread safe, PushData updates while the control thread reads.
+ */
+class JitterEstimator {
+public:
+    void SetLatencyBound(const int64_t minLatency, const int64_t maxLatency);
+    void Update(const int64_t arrivalTime, const int64_t timeStamp, const uint32_t lostNum);
+    /* Returns 0 before the first update */
+    int64_t GetPlayoutTime(const int64_t timeStamp);
+    int64_t GetTargetLatency();
+    int64_t GetJitter();
+    int64_t GetMinLatency();
+    int64_t GetMaxLatency();
+    void Reset();
+
+public:
+    static constexpr int64_t DEFAULT_MIN_LATENCY = 20 * NS_ONE_MS;
+    static constexpr int64_t DEFAULT_MAX_LATENCY = 500 * NS_ONE_MS;
+
+private:
+    void UpdateTargetLatency();
+
+private:
+    // smoothing gains, a sample moves the estimate by 1/gain of its difference
+    static constexpr int64_t JITTER_GAIN = 16;
+    static constexpr int64_t LOSS_GAIN = 16;
+    static constexpr int64_t RELEASE_GAIN = 64;
+    // the target covers this many times the smoothed jitter, close to its peaks
+    static constexpr int64_t JITTER_FACTOR = 4;
+    static constexpr int64_t PERMILLE = 1000;
+    // frames after which the baseline is moved to the fastest transit seen in between
+    static constexpr uint32_t BASELINE_PERIOD_FRAMES = 300;
+
+    std::mutex mutex_;
+    int64_t minLatency_ = DEFAULT_MIN_LATENCY;
+    int64_t maxLatency_ = DEFAULT_MAX_LATENCY;
+    int64_t targetLatency_ = DEFAULT_MIN_LATENCY;
+    int64_t jitter_ = 0;
+    int64_t lossPermille_ = 0;
+    bool isInit_ = false;
+    int64_t baseArrival_ = 0;
+    int64_t baseTimeStamp_ = 0;
+    int64_t lastTransit_ = 0;
+    int64_t periodMinTransit_ = 0;
+    uint32_t periodFrames_ = 0;
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_JITTER_ESTIMATOR_H
@@ -18,18 +18,18 @@
 #include <atomic>
 #include <condition_variable>
 #include <mutex>
-#include <queue>
 #include <thread>
 #include <memory>
 #include "output_controller_listener.h"
+#include "output_frame_ring.h"
 #include "time_statistician.h"
+#include "jitter_estimator.h"
 #include "output_controller_constants.h"
 #include "plugin_buffer.h"
 #include "plugin_types.h"
 #include "av_trans_log.h"
 #include "av_trans_utils.h"
 #include "av_sync_utils.h"
-#include "event_handler.h"
 
 namespace OHOS {
 namespace DistributedHardware {
@@ -40,6 +40,7 @@ public:
     virtual ~OutputController();
     virtual void PrepareSmooth();
     virtual void PrepareSync();
+    virtual void PrepareAdaptive();
     virtual void InitBaseline(const int64_t timeStampBaseline, const int64_t clockBaseline);
     virtual void InitTimeStatistician();
     virtual int32_t NotifyOutput(const std::shared_ptr<Plugin::Buffer>& data);
@@ -56,6 +57,8 @@ public:
     enum class ControlMode {
         SMOOTH,
         SYNC,
+        // smooth output with a buffering delay following the observed jitter and loss
+        ADAPTIVE,
     };
     void PushData(std::shared_ptr<Plugin::Buffer>& data);
     ControlStatus StartControl();
@@ -70,6 +73,16 @@ public:
     void SetBaselineInitState(const bool state);
     void SetProcessDynamicBalanceState(const bool state);
     void SetAllowControlState(const bool state);
+    /* Takes effect only while the control is not started */
+    void SetFrameQueueConfig(const uint32_t capacity, const FrameDropPolicy policy);
+    uint64_t GetDroppedFrameCount();
+    /* Json string with the percentiles, rates and drop counts of the last WINDOW_SECONDS */
+    std::string GetWindowStatistics();
+    void ResetWindowStatistics();
+    /* Replaces the smooth mode with the adaptive one while enabled, latencies in nanoseconds */
+    void SetAdaptiveMode(const bool enable, const int64_t minLatency, const int64_t maxLatency);
+    bool GetAdaptiveModeState();
+    int64_t GetAdaptiveTargetLatency();
 
     uint32_t GetBufferTime();
     bool GetTimeInitState();
@@ -115,8 +128,6 @@ private:
     int32_t AcquireSyncClockTime(const std::shared_ptr<Plugin::Buffer>& data);
     size_t GetQueueSize();
 
-    void ClearQueue(std::queue<std::shared_ptr<Plugin::Buffer>>& queue);
-
     bool CheckIsTimeInit();
     bool CheckIsBaselineInit();
     bool CheckIsAllowControl();
@@ -125,18 +136,26 @@ private:
     bool CheckIsProcessInDynamicBalance(const std::shared_ptr<Plugin::Buffer>& data);
     bool CheckIsProcessInDynamicBalanceOnce(const std::shared_ptr<Plugin::Buffer>& data);
 
-    void LooperHandle();
     void LooperControl();
+    void WaitForData();
+    void WakeUpControl();
     int32_t ControlOutput(const std::shared_ptr<Plugin::Buffer>& data);
-    int32_t PostOutputEvent(const std::shared_ptr<Plugin::Buffer>& data);
+    int32_t OutputFrame(const std::shared_ptr<Plugin::Buffer>& data);
     void HandleControlResult(const std::shared_ptr<Plugin::Buffer>& data, int32_t result);
     void CalSleepTime(const int64_t timeStamp);
     void SyncClock(const std::shared_ptr<Plugin::Buffer>& data);
     void HandleSmoothTime(const std::shared_ptr<Plugin::Buffer>& data);
     void HandleSyncTime(const std::shared_ptr<Plugin::Buffer>& data);
+    void HandleAdaptiveTime(const std::shared_ptr<Plugin::Buffer>& data);
+    void UpdateJitterEstimator(const std::shared_ptr<Plugin::Buffer>& data, const int64_t pushTime);
+    void SetAdaptiveParameter(const std::string &jsonStr);
+    std::string GetAdaptiveParameter();
+    void RecordOutputStatistics(const std::shared_ptr<Plugin::Buffer>& data);
+    void RecordDroppedFrames(const uint64_t num);
 
 protected:
-    std::queue<std::shared_ptr<Plugin::Buffer>> dataQueue_;
+    // PushData is the only producer, the control thread the only consumer
+    FrameRing<std::shared_ptr<Plugin::Buffer>> dataQueue_;
     std::map<Tag, ValueType> paramsMap_;
     std::shared_ptr<TimeStatistician> statistician_ = nullptr;
     std::shared_ptr<OutputControllerListener> listener_ = nullptr;
@@ -145,25 +164,21 @@ private:
     std::atomic<ControlStatus> status_ {ControlStatus::RELEASE};
     std::atomic<ControlMode> mode_ {ControlMode::SMOOTH};
     std::unique_ptr<std::thread> controlThread_ = nullptr;
-    std::unique_ptr<std::thread> handlerThread_ = nullptr;
-    std::shared_ptr<AppExecFwk::EventHandler> handler_ = nullptr;
     std::condition_variable controlCon_;
     std::condition_variable sleepCon_;
     std::condition_variable clockCon_;
-    std::condition_variable handlerCon_;
-    std::mutex handlerMutex_;
+    // only taken when the control thread waits for data
     std::mutex queueMutex_;
+    std::atomic<bool> isControlWaiting_ = false;
     std::mutex sleepMutex_;
-    std::mutex stateMutex_;
-    std::mutex modeMutex_;
     std::mutex clockMutex_;
     std::mutex paramMapMutex_;
     std::atomic<bool> isInDynamicBalance_ = true;
     std::atomic<bool> isBaselineInit_ = false;
     std::atomic<bool> isTimeInit_ = false;
     std::atomic<bool> isAllowControl_ = true;
+    std::atomic<bool> isAdaptiveEnabled_ = false;
 
-    const uint32_t QUEUE_MAX_SIZE = 100;
     const int64_t GREATER_HALF_REREAD_TIME = 5 * NS_ONE_MS;
     const int64_t LESS_HALF_REREAD_TIME = 3 * GREATER_HALF_REREAD_TIME;
     int64_t waitClockThre_ = 0;
@@ -188,12 +203,25 @@ private:
     int64_t sleep_ = 0;
     int64_t sleepThre_ = 0;
     AVTransSharedMemory sharedMem_ = { 0, 0, "" };
+    AVTransMappedMemory sharedMemMap_;
     AVSyncClockUnit clockUnit_ = { 0, 0, 0 };
     std::atomic<int32_t> devClockDiff_ = 0;
     int64_t aFront_ = 0;
     int64_t aBack_ = 0;
     int64_t vFront_ = 0;
     int64_t vBack_ = 0;
+    // the frame to output again by the next loop, after a REPEAT_FREAM result
+    std::shared_ptr<Plugin::Buffer> repeatData_ = nullptr;
+    uint64_t lastDroppedCount_ = 0;
+    // windowed statistics, recorded by the control thread and queried by any thread
+    WindowedHistogram outputIntervalHist_;
+    WindowedHistogram outputLatencyHist_;
+    WindowedCounter droppedFrames_;
+    std::atomic<uint64_t> totalDroppedFrames_ = 0;
+    int64_t lastOutputTime_ = 0;
+    JitterEstimator jitterEstimator_;
+    // only touched by PushData, the frame number seen last for the loss of the adaptive mode
+    uint32_t lastFrameNumber_ = 0;
 };
 } // namespace DistributedHardware
 } // namespace OHOS
@@ -35,7 +35,29 @@ typedef enum {
 } ControllerControlResult;
 
 const std::string LOOPER_CONTROL_THREAD_NAME = "looperControl";
-const std::string OUTPUT_HANDLE_THREAD_NAME = "outputHandle";
+
+const std::string KEY_STATS_WINDOW_SECONDS = "windowSeconds";
+const std::string KEY_STATS_PUSH_INTERVAL = "pushInterval";
+const std::string KEY_STATS_TIMESTAMP_INTERVAL = "timeStampInterval";
+const std::string KEY_STATS_OUTPUT_INTERVAL = "outputInterval";
+const std::string KEY_STATS_OUTPUT_LATENCY = "outputLatency";
+const std::string KEY_STATS_COUNT = "count";
+const std::string KEY_STATS_RATE = "rate";
+const std::string KEY_STATS_P50 = "p50";
+const std::string KEY_STATS_P90 = "p90";
+const std::string KEY_STATS_P99 = "p99";
+const std::string KEY_STATS_MAX = "max";
+const std::string KEY_STATS_DROPPED_FRAMES = "droppedFrames";
+const std::string KEY_STATS_DROP_RATE = "dropRate";
+const std::string KEY_STATS_TOTAL_DROPPED_FRAMES = "totalDroppedFrames";
+const std::string KEY_STATS_QUEUE_SIZE = "queueSize";
+const std::string KEY_STATS_TARGET_LATENCY = "targetLatency";
+const std::string KEY_STATS_JITTER = "jitter";
+
+const std::string KEY_ADAPTIVE_ENABLE = "enable";
+const std::string KEY_ADAPTIVE_MIN_LATENCY = "minLatencyMs";
+const std::string KEY_ADAPTIVE_MAX_LATENCY = "maxLatencyMs";
+const std::string KEY_ADAPTIVE_TARGET_LATENCY = "targetLatencyMs";
 
 const int64_t INVALID_TIMESTAMP = 0;
 const int64_t INVALID_INTERVAL = 0;
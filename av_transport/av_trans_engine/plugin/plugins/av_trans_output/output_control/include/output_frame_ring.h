@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_OUTPUT_FRAME_RING_H
+#define OHOS_OUTPUT_FRAME_RING_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace OHOS {
+namespace DistributedHardware {
+enum class FrameDropPolicy : uint8_t {
+    // keep the latest frames, the consumer discards the oldest ones beyond capacity
+    DROP_OLDEST = 0,
+    // keep the queued frames, the producer discards the incoming one at capacity
+    DROP_NEWEST = 1,
+};
+
+/**
+ * Bounded single producer single consumer frame ring.
+ * Push is only called by the producer thread, Pop by the consumer thread. Only the consumer moves
+ * the head, so dropping the oldest frames and Clear are both carried out by the consumer. The ring
+ * keeps twice the capacity in slots, so the producer does not drop while the consumer catches up.
+ */
+template <typename T>
+class FrameRing {
+public:
+    explicit FrameRing(uint32_t capacity = DEFAULT_CAPACITY, FrameDropPolicy policy = FrameDropPolicy::DROP_OLDEST)
+    {
+        Reset(capacity, policy);
+    }
+
+    /* Not thread safe, only call it while neither the producer nor the consumer is running */
+    void Reset(uint32_t capacity, FrameDropPolicy policy)
+    {
+        capacity_ = (capacity == 0) ? 1 : capacity;
+        policy_ = policy;
+        uint64_t slotNum = 1;
+        while (slotNum < static_cast<uint64_t>(capacity_) * SLOT_FACTOR) {
+            slotNum <<= 1;
+        }
+        slots_.clear();
+        slots_.resize(slotNum);
+        mask_ = slotNum - 1;
+        head_.store(0);
+        tail_.store(0);
+        clearUntil_.store(0);
+        dropped_.store(0);
+    }
+
+    bool Push(T item)
+    {
+        uint64_t tail = tail_.load(std::memory_order_relaxed);
+        uint64_t size = tail - head_.load();
+        if (size > mask_ || (policy_ == FrameDropPolicy::DROP_NEWEST && size >= capacity_)) {
+            dropped_++;
+            return false;
+        }
+        slots_[tail & mask_] = std::move(item);
+        tail_.store(tail + 1);
+        return true;
+    }
+
+    bool Pop(T &item)
+    {
+        uint64_t head = head_.load(std::memory_order_relaxed);
+        uint64_t tail = tail_.load();
+        uint64_t clearUntil = clearUntil_.load();
+        while (head != tail) {
+            bool isCleared = head < clearUntil;
+            if (!isCleared && (policy_ != FrameDropPolicy::DROP_OLDEST || tail - head <= capacity_)) {
+                break;
+            }
+            slots_[head & mask_] = T();
+            head++;
+            head_.store(head);
+            if (!isCleared) {
+                dropped_++;
+            }
+        }
+        if (head == tail) {
+            return false;
+        }
+        item = std::move(slots_[head & mask_]);
+        slots_[head & mask_] = T();
+        head_.store(head + 1);
+        return true;
+    }
+
+    /* Any thread, the frames pushed so far are discarded by the consumer */
+    void Clear()
+    {
+        clearUntil_.store(tail_.load());
+    }
+
+    size_t Size() const
+    {
+        uint64_t head = head_.load();
+        uint64_t tail = tail_.load();
+        uint64_t clearUntil = clearUntil_.load();
+        uint64_t begin = (head > clearUntil) ? head : clearUntil;
+        return (tail > begin) ? static_cast<size_t>(tail - begin) : 0;
+    }
+
+    bool Empty() const
+    {
+        return Size() == 0;
+    }
+
+    uint32_t GetCapacity() const
+    {
+        return capacity_;
+    }
+
+    FrameDropPolicy GetDropPolicy() const
+    {
+        return policy_;
+    }
+
+    uint64_t GetDroppedCount() const
+    {
+        return dropped_.load();
+    }
+
+public:
+    static constexpr uint32_t DEFAULT_CAPACITY = 100;
+
+private:
+    static constexpr uint64_t SLOT_FACTOR = 2;
+    uint32_t capacity_ = DEFAULT_CAPACITY;
+    FrameDropPolicy policy_ = FrameDropPolicy::DROP_OLDEST;
+    std::vector<T> slots_;
+    uint64_t mask_ = 0;
+    std::atomic<uint64_t> head_ {0};
+    std::atomic<uint64_t> tail_ {0};
+    std::atomic<uint64_t> clearUntil_ {0};
+    std::atomic<uint64_t> dropped_ {0};
+};
+} // namespace DistributedHardware
+} // namespace OHOS
+#endif // OHOS_OUTPUT_FRAME_RING_H
@@ -16,7 +16,10 @@
 #ifndef OHOS_TIME_STATISTICIAN_H
 #define OHOS_TIME_STATISTICIAN_H
 
+#include <array>
+#include <cstdint>
 #include <memory>
+#include <mutex>
 
 #include "plugin_buffer.h"
 
@@ -24,6 +27,69 @@ namespace OHOS {
 namespace DistributedHardware {
 using namespace OHOS::Media;
 using namespace OHOS::Media::Plugin;
+struct WindowStats {
+    uint64_t count = 0;
+    // samples per second over the covered part of the window
+    double rate = 0;
+    // values in microseconds
+    int64_t p50 = 0;
+    int64_t p90 = 0;
+    int64_t p99 = 0;
+    int64_t max = 0;
+};
+
+/**
+ * Sliding window histogram with fixed memory, one slot per second. Values are kept in log linear
+ * bins, 16 bins for each power of two, a percentile is reported as the middle of its bin and is
+ * within about 3% of the recorded value. Thread safe, the control thread records while any thread queries.
+ */
+class WindowedHistogram {
+public:
+    void Record(const int64_t value, const int64_t now);
+    WindowStats GetStats(const int64_t now);
+    void Reset();
+
+public:
+    static constexpr uint32_t WINDOW_SECONDS = 10;
+
+private:
+    static uint32_t GetBinIndex(const uint64_t valueUs);
+    static int64_t GetBinValue(const uint32_t index);
+
+private:
+    static constexpr uint32_t SUB_BIN_BITS = 4;
+    static constexpr uint32_t SUB_BIN_NUM = 1 << SUB_BIN_BITS;
+    // the last group ends above 16 seconds, larger values are counted in the last bin
+    static constexpr uint32_t BIN_NUM = 21 * SUB_BIN_NUM;
+    struct Slot {
+        int64_t second = -1;
+        uint64_t count = 0;
+        int64_t max = 0;
+        std::array<uint32_t, BIN_NUM> bins {};
+    };
+    std::mutex mutex_;
+    int64_t startSecond_ = -1;
+    std::array<Slot, WINDOW_SECONDS> slots_ {};
+};
+
+/* Sliding window event counter with the same one second slots as WindowedHistogram */
+class WindowedCounter {
+public:
+    void Add(const uint64_t num, const int64_t now);
+    uint64_t GetCount(const int64_t now);
+    double GetRate(const int64_t now);
+    void Reset();
+
+private:
+    struct Slot {
+        int64_t second = -1;
+        uint64_t count = 0;
+    };
+    std::mutex mutex_;
+    int64_t startSecond_ = -1;
+    std::array<Slot, WindowedHistogram::WINDOW_SECONDS> slots_ {};
+};
+
 class TimeStatistician {
 public:
     virtual ~TimeStatistician() = default;
@@ -37,6 +103,10 @@ public:
     int64_t GetPushInterval();
     int64_t GetTimeStampInterval();
     void ClearStatistics();
+    WindowStats GetPushIntervalStats();
+    WindowStats GetTimeStampIntervalStats();
+    /* Windows are not touched by ClearStatistics, they keep running over control mode changes */
+    void ResetWindowStatistics();
 
 public:
     int32_t pushIndex_ = 0;
@@ -52,6 +122,9 @@ public:
     int64_t timeStamp_ = 0;
     int64_t timeStampIntervalSum_ = 0;
     int64_t timeStampInterval_ = 0;
+
+    WindowedHistogram pushIntervalHist_;
+    WindowedHistogram timeStampIntervalHist_;
 };
 } // namespace DistributedHardware
 } // namespace OHOS
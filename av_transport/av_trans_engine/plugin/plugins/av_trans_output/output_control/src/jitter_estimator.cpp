@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "jitter_estimator.h"
+
+#include <cstdlib>
+
+#include "av_trans_log.h"
+
+namespace OHOS {
+namespace DistributedHardware {
+void JitterEstimator::SetLatencyBound(const int64_t minLatency, const int64_t maxLatency)
+{
+    if (minLatency < 0 || maxLatency < minLatency) {
+        AVTRANS_LOGE("Invalid latency bound, min: %{public}lld, max: %{public}lld.", minLatency, maxLatency);
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    minLatency_ = minLatency;
+    maxLatency_ = maxLatency;
+    if (targetLatency_ < minLatency_) {
+        targetLatency_ = minLatency_;
+    }
+    if (targetLatency_ > maxLatency_) {
+        targetLatency_ = maxLatency_;
+    }
+}
+
+void JitterEstimator::Update(const int64_t arrivalTime, const int64_t timeStamp, const uint32_t lostNum)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!isInit_) {
+        isInit_ = true;
+        baseArrival_ = arrivalTime;
+        baseTimeStamp_ = timeStamp;
+        lastTransit_ = 0;
+        periodMinTransit_ = 0;
+        periodFrames_ = 0;
+        return;
+    }
+    int64_t transit = (arrivalTime - baseArrival_) - (timeStamp - baseTimeStamp_);
+    jitter_ += (llabs(transit - lastTransit_) - jitter_) / JITTER_GAIN;
+    int64_t lossSample = static_cast<int64_t>(lostNum) * PERMILLE / (static_cast<int64_t>(lostNum) + 1);
+    lossPermille_ += (lossSample - lossPermille_) / LOSS_GAIN;
+    if (transit < 0) {
+        // faster than the baseline frame, this frame becomes the baseline
+        baseArrival_ += transit;
+        transit = 0;
+    }
+    lastTransit_ = transit;
+    periodMinTransit_ = (periodFrames_ == 0 || transit < periodMinTransit_) ? transit : periodMinTransit_;
+    periodFrames_++;
+    if (periodFrames_ >= BASELINE_PERIOD_FRAMES) {
+        baseArrival_ += periodMinTransit_;
+        lastTransit_ -= periodMinTransit_;
+        periodFrames_ = 0;
+    }
+    UpdateTargetLatency();
+}
+
+void JitterEstimator::UpdateTargetLatency()
+{
+    int64_t candidate = minLatency_ + JITTER_FACTOR * jitter_ + (maxLatency_ - minLatency_) * lossPermille_ / PERMILLE;
+    if (candidate > targetLatency_) {
+        targetLatency_ = candidate;
+    } else {
+        targetLatency_ -= (targetLatency_ - candidate) / RELEASE_GAIN;
+    }
+    if (targetLatency_ > maxLatency_) {
+        targetLatency_ = maxLatency_;
+    }
+    if (targetLatency_ < minLatency_) {
+        targetLatency_ = minLatency_;
+    }
+    AVTRANS_LOGD("Adaptive jitter: %{public}lld, loss permille: %{public}lld, target latency: %{public}lld.",
+        jitter_, lossPermille_, targetLatency_);
+}
+
+int64_t JitterEstimator::GetPlayoutTime(const int64_t timeStamp)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!isInit_) {
+        return 0;
+    }
+    return baseArrival_ + (timeStamp - baseTimeStamp_) + targetLatency_;
+}
+
+int64_t JitterEstimator::GetTargetLatency()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return targetLatency_;
+}
+
+int64_t JitterEstimator::GetJitter()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return jitter_;
+}
+
+int64_t JitterEstimator::GetMinLatency()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return minLatency_;
+}
+
+int64_t JitterEstimator::GetMaxLatency()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return maxLatency_;
+}
+
+void JitterEstimator::Reset()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    isInit_ = false;
+    jitter_ = 0;
+    lossPermille_ = 0;
+    targetLatency_ = minLatency_;
+    baseArrival_ = 0;
+    baseTimeStamp_ = 0;
+    lastTransit_ = 0;
+    periodMinTransit_ = 0;
+    periodFrames_ = 0;
+}
+} // namespace DistributedHardware
+} // namespace OHOS
@@ -26,6 +26,8 @@ namespace DistributedHardware {
 OutputController::~OutputController()
 {
     ReleaseControl();
+    std::lock_guard<std::mutex> lock(paramMapMutex_);
+    UnmapAVTransSharedMemory(sharedMemMap_);
 }
 
 void OutputController::PushData(std::shared_ptr<Plugin::Buffer>& data)
@@ -33,25 +35,25 @@ void OutputController::PushData(std::shared_ptr<Plugin::Buffer>& data)
     int64_t pushTime = GetCurrentTime();
     TRUE_RETURN((GetControlStatus() != ControlStatus::START),
         "Control status wrong, push data failed.");
-    {
-        std::lock_guard<std::mutex> lock(queueMutex_);
-        if (dataQueue_.size() > QUEUE_MAX_SIZE) {
-            AVTRANS_LOGE("DataQueue is greater than QUEUE_MAX_SIZE %{public}zu.", QUEUE_MAX_SIZE);
-            dataQueue_.pop();
-        }
-        CheckSyncInfo(data);
-        if (data == nullptr || data->GetBufferMeta() == nullptr) {
-            AVTRANS_LOGE("data or data getbuffermeta is nullptr");
-            return;
-        }
-        data->GetBufferMeta()->SetMeta(Tag::USER_PUSH_DATA_TIME, pushTime);
-        dataQueue_.push(data);
-        AVTRANS_LOGD("Push Data, dataQueue size is %{public}zu.", dataQueue_.size());
+    CheckSyncInfo(data);
+    if (data == nullptr || data->GetBufferMeta() == nullptr) {
+        AVTRANS_LOGE("data or data getbuffermeta is nullptr");
+        return;
+    }
+    data->GetBufferMeta()->SetMeta(Tag::USER_PUSH_DATA_TIME, pushTime);
+    if (GetControlMode() == ControlMode::ADAPTIVE) {
+        UpdateJitterEstimator(data, pushTime);
     }
+    if (!dataQueue_.Push(data)) {
+        AVTRANS_LOGE("DataQueue is full, capacity %{public}" PRIu32 ", drop the frame.", dataQueue_.GetCapacity());
+    }
+    AVTRANS_LOGD("Push Data, dataQueue size is %{public}zu.", dataQueue_.Size());
     if (GetControlMode() == ControlMode::SYNC) {
         clockCon_.notify_one();
     }
-    controlCon_.notify_one();
+    if (isControlWaiting_.load()) {
+        WakeUpControl();
+    }
 }
 
 OutputController::ControlStatus OutputController::StartControl()
@@ -59,26 +61,22 @@ OutputController::ControlStatus OutputController::StartControl()
     TRUE_RETURN_V_MSG_D((GetControlStatus() == ControlStatus::START), ControlStatus::STARTED,
         "Control status is started.");
     SetControlStatus(ControlStatus::START);
-    if (!handlerThread_) {
-        AVTRANS_LOGD("Init handler thread.");
-        handlerThread_ = std::make_unique<std::thread>(&OutputController::LooperHandle, this);
-        std::unique_lock<std::mutex> lock(handlerMutex_);
-        handlerCon_.wait(lock, [this] {
-            return handler_;
-        });
-    }
     if (!controlThread_) {
         AVTRANS_LOGD("Init control thread.");
         controlThread_ = std::make_unique<std::thread>(&OutputController::LooperControl, this);
     }
+    WakeUpControl();
     AVTRANS_LOGI("Start control success.");
     return ControlStatus::START;
 }
 
 void OutputController::PrepareControl()
 {
-    if (GetControlMode() == ControlMode::SMOOTH) {
+    ControlMode mode = GetControlMode();
+    if (mode == ControlMode::SMOOTH) {
         PrepareSmooth();
+    } else if (mode == ControlMode::ADAPTIVE) {
+        PrepareAdaptive();
     } else {
         PrepareSync();
     }
@@ -91,7 +89,7 @@ OutputController::ControlStatus OutputController::StopControl()
     TRUE_RETURN_V_MSG_D((GetControlStatus() == ControlStatus::STOP), ControlStatus::STOPPED,
         "Control status is stopped.");
     SetControlStatus(ControlStatus::STOP);
-    ClearQueue(dataQueue_);
+    dataQueue_.Clear();
     AVTRANS_LOGI("Stop control success.");
     return ControlStatus::STOP;
 }
@@ -103,21 +101,16 @@ OutputController::ControlStatus OutputController::ReleaseControl()
     SetControlStatus(ControlStatus::RELEASE);
     statistician_ = nullptr;
     UnregisterListener();
-    controlCon_.notify_one();
+    WakeUpControl();
     sleepCon_.notify_one();
     clockCon_.notify_one();
-    if (handler_ && handler_->GetEventRunner()) {
-        handler_->GetEventRunner()->Stop();
-    }
-    if (handlerThread_) {
-        handlerThread_->join();
-        handlerThread_ = nullptr;
-    }
     if (controlThread_) {
         controlThread_->join();
         controlThread_ = nullptr;
     }
-    ClearQueue(dataQueue_);
+    // the consumer is gone, the frames can be released right here
+    dataQueue_.Reset(dataQueue_.GetCapacity(), dataQueue_.GetDropPolicy());
+    repeatData_ = nullptr;
     paramsMap_.clear();
     AVTRANS_LOGI("Release control success.");
     return ControlStatus::RELEASE;
@@ -125,6 +118,14 @@ OutputController::ControlStatus OutputController::ReleaseControl()
 
 Status OutputController::GetParameter(Tag tag, ValueType& value)
 {
+    if (tag == TAG_OUTPUT_STATISTICS) {
+        value = GetWindowStatistics();
+        return Status::OK;
+    }
+    if (tag == TAG_ADAPTIVE_LATENCY) {
+        value = GetAdaptiveParameter();
+        return Status::OK;
+    }
     {
         std::lock_guard<std::mutex> lock(paramMapMutex_);
         auto iter = paramsMap_.find(tag);
@@ -138,6 +139,16 @@ Status OutputController::GetParameter(Tag tag, ValueType& value)
 
 Status OutputController::SetParameter(Tag tag, const ValueType& value)
 {
+    if (tag == TAG_OUTPUT_STATISTICS) {
+        ResetWindowStatistics();
+        return Status::OK;
+    }
+    if (tag == TAG_ADAPTIVE_LATENCY) {
+        TRUE_RETURN_V_MSG_E(!Plugin::Any::IsSameTypeWith<std::string>(value), Status::ERROR_INVALID_PARAMETER,
+            "Adaptive latency parameter type is invalid.");
+        SetAdaptiveParameter(Plugin::AnyCast<std::string>(value));
+        return Status::OK;
+    }
     {
         std::lock_guard<std::mutex> lock(paramMapMutex_);
         switch (tag) {
@@ -149,6 +160,11 @@ Status OutputController::SetParameter(Tag tag, const ValueType& value)
             case Tag::USER_SHARED_MEMORY_FD: {
                 std::string jsonStr = Plugin::AnyCast<std::string>(value);
                 sharedMem_ = UnmarshalSharedMemory(jsonStr);
+                if (IsInValidSharedMemory(sharedMem_)) {
+                    UnmapAVTransSharedMemory(sharedMemMap_);
+                } else {
+                    MapAVTransSharedMemory(sharedMem_, sharedMemMap_);
+                }
                 AVTRANS_LOGD("Set parameter USER_SHARED_MEMORY_FD: %{public}s, unmarshal sharedMem fd: %{public}d, "
                     "size: %{public}d, name: %{public}s", jsonStr.c_str(), sharedMem_.fd, sharedMem_.size,
                     sharedMem_.name.c_str());
@@ -206,38 +222,64 @@ void OutputController::PrepareSmooth()
     SetTimeStampOnceDiffThre(0);
 }
 
-void OutputController::LooperHandle()
+void OutputController::PrepareAdaptive()
 {
-    prctl(PR_SET_NAME, OUTPUT_HANDLE_THREAD_NAME.c_str());
-    auto runner = AppExecFwk::EventRunner::Create(false);
-    {
-        std::lock_guard<std::mutex> lock(handlerMutex_);
-        handler_ = std::make_shared<AppExecFwk::EventHandler>(runner);
-    }
-    handlerCon_.notify_one();
-    runner->Run();
+    AVTRANS_LOGI("Prepare adaptive.");
+    SetProcessDynamicBalanceState(true);
+    SetTimeInitState(false);
+    SetBaselineInitState(false);
+    SetAllowControlState(true);
+    SetBufferTime(0);
+    jitterEstimator_.Reset();
+    lastFrameNumber_ = 0;
 }
 
 void OutputController::LooperControl()
 {
     prctl(PR_SET_NAME, LOOPER_CONTROL_THREAD_NAME.c_str());
     while (GetControlStatus() != ControlStatus::RELEASE) {
+        if (GetControlStatus() != ControlStatus::START) {
+            repeatData_ = nullptr;
+            lastOutputTime_ = 0;
+            WaitForData();
+            continue;
+        }
         std::shared_ptr<Plugin::Buffer> data = nullptr;
-        {
-            std::unique_lock<std::mutex> lock(queueMutex_);
-            controlCon_.wait(lock, [this] {
-                return ((!dataQueue_.empty() && GetControlStatus() == ControlStatus::START)
-                    || (GetControlStatus() == ControlStatus::RELEASE));
-            });
-            if (GetControlStatus() == ControlStatus::RELEASE) {
-                continue;
-            }
-            data = dataQueue_.front();
+        if (repeatData_ != nullptr) {
+            data = repeatData_;
+            repeatData_ = nullptr;
+        } else if (!dataQueue_.Pop(data)) {
+            WaitForData();
+            continue;
+        }
+        uint64_t droppedCount = dataQueue_.GetDroppedCount();
+        if (droppedCount != lastDroppedCount_) {
+            AVTRANS_LOGE("DataQueue is greater than capacity %{public}" PRIu32 ", dropped %{public}" PRIu64
+                " frames in total.", dataQueue_.GetCapacity(), droppedCount);
+            RecordDroppedFrames(droppedCount - lastDroppedCount_);
+            lastDroppedCount_ = droppedCount;
         }
         HandleControlResult(data, ControlOutput(data));
     }
 }
 
+void OutputController::WaitForData()
+{
+    std::unique_lock<std::mutex> lock(queueMutex_);
+    isControlWaiting_.store(true);
+    controlCon_.wait(lock, [this] {
+        return ((!dataQueue_.Empty() && GetControlStatus() == ControlStatus::START)
+            || (GetControlStatus() == ControlStatus::RELEASE));
+    });
+    isControlWaiting_.store(false);
+}
+
+void OutputController::WakeUpControl()
+{
+    std::lock_guard<std::mutex> lock(queueMutex_);
+    controlCon_.notify_one();
+}
+
 int32_t OutputController::ControlOutput(const std::shared_ptr<Plugin::Buffer>& data)
 {
     if (data == nullptr) {
@@ -248,6 +290,12 @@ int32_t OutputController::ControlOutput(const std::shared_ptr<Plugin::Buffer>& d
     int64_t timeStamp = data->pts;
     TRUE_RETURN_V_MSG_D((timeStamp == INVALID_TIMESTAMP || !CheckIsAllowControl()), OUTPUT_FRAME,
         "Direct output.");
+    if (GetControlMode() == ControlMode::ADAPTIVE) {
+        CalProcessTime(data);
+        HandleAdaptiveTime(data);
+        RecordTime(enterTime_, timeStamp);
+        return OUTPUT_FRAME;
+    }
     if (CheckIsClockInvalid(data) || !CheckIsProcessInDynamicBalance(data)) {
         CalProcessTime(data);
         RecordTime(enterTime_, timeStamp);
@@ -275,23 +323,19 @@ void OutputController::CheckSyncInfo(const std::shared_ptr<Plugin::Buffer>& data
     auto bufferMeta = data->GetBufferMeta();
     bool isAFrameNumberExist = bufferMeta->IsExist(Tag::AUDIO_SAMPLE_PER_FRAME);
     bool isAPtsExist = bufferMeta->IsExist(Tag::MEDIA_START_TIME);
-    if (GetControlMode() == ControlMode::SYNC && (!isAFrameNumberExist || !isAPtsExist)) {
-        ClearQueue(dataQueue_);
-        sleepCon_.notify_one();
-        clockCon_.notify_one();
-        SetControlMode(ControlMode::SMOOTH);
-        AVTRANS_LOGI("Stop sync and start smooth, aFrameNumberExist: %{public}d, aPtsExist: %{public}d.",
-            isAFrameNumberExist, isAPtsExist);
+    ControlMode mode = GetControlMode();
+    ControlMode unsyncMode = isAdaptiveEnabled_.load() ? ControlMode::ADAPTIVE : ControlMode::SMOOTH;
+    ControlMode expectMode = (isAFrameNumberExist && isAPtsExist) ? ControlMode::SYNC : unsyncMode;
+    if (mode == expectMode) {
         return;
     }
-    if (GetControlMode() == ControlMode::SMOOTH && isAFrameNumberExist && isAPtsExist) {
-        ClearQueue(dataQueue_);
-        sleepCon_.notify_one();
-        clockCon_.notify_one();
-        SetControlMode(ControlMode::SYNC);
-        AVTRANS_LOGI("Stop smooth and start sync, aFrameNumberExist: %{public}d, aPtsExist: %{public}d.",
-            isAFrameNumberExist, isAPtsExist);
-    }
+    dataQueue_.Clear();
+    sleepCon_.notify_one();
+    clockCon_.notify_one();
+    SetControlMode(expectMode);
+    AVTRANS_LOGI("Switch control mode from %{public}d to %{public}d, aFrameNumberExist: %{public}d, "
+        "aPtsExist: %{public}d.", static_cast<int32_t>(mode), static_cast<int32_t>(expectMode),
+        isAFrameNumberExist, isAPtsExist);
 }
 
 void OutputController::CalProcessTime(const std::shared_ptr<Plugin::Buffer>& data)
@@ -353,15 +397,15 @@ int32_t OutputController::AcquireSyncClockTime(const std::shared_ptr<Plugin::Buf
     }
     TRUE_RETURN_V_MSG_E(((sharedMem_.fd <= 0) || (sharedMem_.size <= 0) || sharedMem_.name.empty()),
         ERR_DH_AVT_SHARED_MEMORY_FAILED, "Parameter USER_SHARED_MEMORY_FD info error.");
-    AVTransSharedMemory sharedMem;
-    sharedMem.fd = sharedMem_.fd;
-    sharedMem.size = sharedMem_.size;
-    sharedMem.name = sharedMem_.name;
     AVSyncClockUnit clockUnit;
     clockUnit.pts = INVALID_TIMESTAMP;
     auto bufferMeta = data->GetBufferMeta();
     clockUnit.frameNum = Plugin::AnyCast<uint32_t>(bufferMeta->GetMeta(Tag::AUDIO_SAMPLE_PER_FRAME));
-    int32_t ret = ReadClockUnitFromMemory(sharedMem, clockUnit);
+    int32_t ret = DH_AVT_SUCCESS;
+    {
+        std::lock_guard<std::mutex> lock(paramMapMutex_);
+        ret = ReadClockUnitFromMemory(sharedMemMap_, clockUnit);
+    }
     if (ret == DH_AVT_SUCCESS) {
         TRUE_RETURN_V_MSG_D((clockUnit.pts == INVALID_TIMESTAMP), ERR_DH_AVT_SHARED_MEMORY_FAILED,
             "Read invalid clock.");
@@ -375,8 +419,9 @@ int32_t OutputController::AcquireSyncClockTime(const std::shared_ptr<Plugin::Buf
 
 bool OutputController::WaitRereadClockFailed(const std::shared_ptr<Plugin::Buffer>& data)
 {
-    const uint32_t halfQueueSize = QUEUE_MAX_SIZE / 2;
-    while (GetQueueSize() < QUEUE_MAX_SIZE) {
+    const uint32_t queueCapacity = dataQueue_.GetCapacity();
+    const uint32_t halfQueueSize = queueCapacity / 2;
+    while (GetQueueSize() < queueCapacity) {
         if (GetQueueSize() < halfQueueSize) {
             {
                 AVTRANS_LOGD("Dataqueue size is less than half size, wait notify.");
@@ -398,7 +443,7 @@ bool OutputController::WaitRereadClockFailed(const std::shared_ptr<Plugin::Buffe
             }
         }
         int32_t ret = AcquireSyncClockTime(data);
-        TRUE_RETURN_V_MSG_D((ret == DH_AVT_SUCCESS || GetControlMode() == ControlMode::SMOOTH), false,
+        TRUE_RETURN_V_MSG_D((ret == DH_AVT_SUCCESS || GetControlMode() != ControlMode::SYNC), false,
             "Wait reread clock success.");
     }
     return true;
@@ -415,10 +460,7 @@ bool OutputController::CheckIsProcessInDynamicBalance(const std::shared_ptr<Plug
     }
     if (dynamicBalanceCount_ >= dynamicBalanceThre_) {
         AVTRANS_LOGD("Process meet dynamic balance condition.");
-        {
-            std::lock_guard<std::mutex> lock(queueMutex_);
-            ClearQueue(dataQueue_);
-        }
+        dataQueue_.Clear();
         SetProcessDynamicBalanceState(true);
         return true;
     }
@@ -547,31 +589,57 @@ void OutputController::HandleSyncTime(const std::shared_ptr<Plugin::Buffer>& dat
     }
 }
 
+void OutputController::HandleAdaptiveTime(const std::shared_ptr<Plugin::Buffer>& data)
+{
+    int64_t playoutTime = jitterEstimator_.GetPlayoutTime(data->pts);
+    int64_t maxLatency = jitterEstimator_.GetMaxLatency();
+    sleep_ = (playoutTime == INVALID_TIMESTAMP) ? 0 : (playoutTime - GetCurrentTime());
+    if (sleep_ > maxLatency) {
+        sleep_ = maxLatency;
+    }
+    if (sleep_ < 0) {
+        // late frame, output at once
+        sleep_ = 0;
+    }
+    AVTRANS_LOGD("Adaptive frame pts: %{public}lld, target latency: %{public}lld, sleep: %{public}lld.",
+        data->pts, jitterEstimator_.GetTargetLatency(), sleep_);
+    {
+        std::unique_lock<std::mutex> lock(sleepMutex_);
+        sleepCon_.wait_for(lock, std::chrono::nanoseconds(sleep_),
+            [this] { return (GetControlStatus() != ControlStatus::START); });
+    }
+}
+
+void OutputController::UpdateJitterEstimator(const std::shared_ptr<Plugin::Buffer>& data, const int64_t pushTime)
+{
+    TRUE_RETURN((data->pts == INVALID_TIMESTAMP), "Invalid timestamp, skip jitter estimate.");
+    uint32_t lostNum = 0;
+    auto bufferMeta = data->GetBufferMeta();
+    if (bufferMeta->IsExist(Tag::USER_FRAME_NUMBER)) {
+        uint32_t frameNumber = Plugin::AnyCast<uint32_t>(bufferMeta->GetMeta(Tag::USER_FRAME_NUMBER));
+        if (lastFrameNumber_ != 0 && frameNumber > lastFrameNumber_ + 1) {
+            lostNum = frameNumber - lastFrameNumber_ - 1;
+        }
+        lastFrameNumber_ = frameNumber;
+    }
+    jitterEstimator_.Update(pushTime, data->pts, lostNum);
+}
+
 void OutputController::HandleControlResult(const std::shared_ptr<Plugin::Buffer>& data, int32_t result)
 {
     switch (result) {
         case OUTPUT_FRAME: {
-            int32_t ret = PostOutputEvent(data);
+            int32_t ret = OutputFrame(data);
             TRUE_RETURN((ret == HANDLE_FAILED), "Handle result OUTPUT_FRAME failed.");
-            {
-                std::lock_guard<std::mutex> lock(queueMutex_);
-                if (!dataQueue_.empty() && data == dataQueue_.front()) {
-                    dataQueue_.pop();
-                }
-            }
             break;
         }
         case DROP_FRAME: {
-            {
-                std::lock_guard<std::mutex> lock(queueMutex_);
-                if (!dataQueue_.empty() && data == dataQueue_.front()) {
-                    dataQueue_.pop();
-                }
-            }
+            RecordDroppedFrames(1);
             break;
         }
         case REPEAT_FREAM: {
-            int32_t ret = PostOutputEvent(data);
+            repeatData_ = data;
+            int32_t ret = OutputFrame(data);
             TRUE_RETURN((ret == HANDLE_FAILED), "Handle result REPEAT_FREAM failed.");
             break;
         }
@@ -580,18 +648,35 @@ void OutputController::HandleControlResult(const std::shared_ptr<Plugin::Buffer>
     }
 }
 
-int32_t OutputController::PostOutputEvent(const std::shared_ptr<Plugin::Buffer>& data)
+int32_t OutputController::OutputFrame(const std::shared_ptr<Plugin::Buffer>& data)
 {
-    TRUE_RETURN_V_MSG_E((!handler_), HANDLE_FAILED, "Handler is nullptr.");
-    auto outputFunc = [this, data]() {
-        int32_t ret = NotifyOutput(data);
-        TRUE_RETURN_V_MSG_E((ret == NOTIFY_FAILED), HANDLE_FAILED, "Notify failed.");
-        return HANDLE_SUCCESS;
-    };
-    TRUE_RETURN_V_MSG_E((!handler_->PostTask(outputFunc)), HANDLE_FAILED, "Handler post task failed.");
+    // output on the control thread right after its sleep, no extra hop to another looper
+    int32_t ret = NotifyOutput(data);
+    TRUE_RETURN_V_MSG_E((ret == NOTIFY_FAILED), HANDLE_FAILED, "Notify failed.");
+    RecordOutputStatistics(data);
     return HANDLE_SUCCESS;
 }
 
+void OutputController::RecordOutputStatistics(const std::shared_ptr<Plugin::Buffer>& data)
+{
+    int64_t outputTime = GetCurrentTime();
+    if (lastOutputTime_ != 0) {
+        outputIntervalHist_.Record(outputTime - lastOutputTime_, outputTime);
+    }
+    lastOutputTime_ = outputTime;
+    if (data != nullptr && data->GetBufferMeta() != nullptr &&
+        data->GetBufferMeta()->IsExist(Tag::USER_PUSH_DATA_TIME)) {
+        int64_t pushTime = Plugin::AnyCast<int64_t>(data->GetBufferMeta()->GetMeta(Tag::USER_PUSH_DATA_TIME));
+        outputLatencyHist_.Record(outputTime - pushTime, outputTime);
+    }
+}
+
+void OutputController::RecordDroppedFrames(const uint64_t num)
+{
+    droppedFrames_.Add(num, GetCurrentTime());
+    totalDroppedFrames_.fetch_add(num);
+}
+
 int32_t OutputController::NotifyOutput(const std::shared_ptr<Plugin::Buffer>& data)
 {
     TRUE_RETURN_V_MSG_E((!listener_), NOTIFY_FAILED, "Listener is nullptr.");
@@ -673,6 +758,146 @@ bool OutputController::GetAllowControlState()
     return isAllowControl_.load();
 }
 
+void OutputController::SetFrameQueueConfig(const uint32_t capacity, const FrameDropPolicy policy)
+{
+    TRUE_RETURN((controlThread_ != nullptr), "Control thread is running, can not change frame queue.");
+    TRUE_RETURN((capacity == 0), "Invalid frame queue capacity.");
+    dataQueue_.Reset(capacity, policy);
+    AVTRANS_LOGI("Set frame queue capacity: %{public}" PRIu32 ", drop policy: %{public}" PRIu8, capacity,
+        static_cast<uint8_t>(policy));
+}
+
+uint64_t OutputController::GetDroppedFrameCount()
+{
+    return dataQueue_.GetDroppedCount();
+}
+
+static void AddWindowStats(cJSON *rootJson, const std::string &key, const WindowStats &stats)
+{
+    cJSON *statsJson = cJSON_CreateObject();
+    if (statsJson == nullptr) {
+        return;
+    }
+    cJSON_AddNumberToObject(statsJson, KEY_STATS_COUNT.c_str(), static_cast<double>(stats.count));
+    cJSON_AddNumberToObject(statsJson, KEY_STATS_RATE.c_str(), stats.rate);
+    cJSON_AddNumberToObject(statsJson, KEY_STATS_P50.c_str(), static_cast<double>(stats.p50));
+    cJSON_AddNumberToObject(statsJson, KEY_STATS_P90.c_str(), static_cast<double>(stats.p90));
+    cJSON_AddNumberToObject(statsJson, KEY_STATS_P99.c_str(), static_cast<double>(stats.p99));
+    cJSON_AddNumberToObject(statsJson, KEY_STATS_MAX.c_str(), static_cast<double>(stats.max));
+    cJSON_AddItemToObject(rootJson, key.c_str(), statsJson);
+}
+
+std::string OutputController::GetWindowStatistics()
+{
+    int64_t now = GetCurrentTime();
+    cJSON *rootJson = cJSON_CreateObject();
+    TRUE_RETURN_V_MSG_E((rootJson == nullptr), "", "Create statistics json failed.");
+    cJSON_AddNumberToObject(rootJson, KEY_STATS_WINDOW_SECONDS.c_str(), WindowedHistogram::WINDOW_SECONDS);
+    std::shared_ptr<TimeStatistician> statistician = statistician_;
+    if (statistician) {
+        AddWindowStats(rootJson, KEY_STATS_PUSH_INTERVAL, statistician->GetPushIntervalStats());
+        AddWindowStats(rootJson, KEY_STATS_TIMESTAMP_INTERVAL, statistician->GetTimeStampIntervalStats());
+    }
+    AddWindowStats(rootJson, KEY_STATS_OUTPUT_INTERVAL, outputIntervalHist_.GetStats(now));
+    AddWindowStats(rootJson, KEY_STATS_OUTPUT_LATENCY, outputLatencyHist_.GetStats(now));
+    cJSON_AddNumberToObject(rootJson, KEY_STATS_DROPPED_FRAMES.c_str(),
+        static_cast<double>(droppedFrames_.GetCount(now)));
+    cJSON_AddNumberToObject(rootJson, KEY_STATS_DROP_RATE.c_str(), droppedFrames_.GetRate(now));
+    cJSON_AddNumberToObject(rootJson, KEY_STATS_TOTAL_DROPPED_FRAMES.c_str(),
+        static_cast<double>(totalDroppedFrames_.load()));
+    cJSON_AddNumberToObject(rootJson, KEY_STATS_QUEUE_SIZE.c_str(), static_cast<double>(dataQueue_.Size()));
+    if (GetControlMode() == ControlMode::ADAPTIVE) {
+        cJSON_AddNumberToObject(rootJson, KEY_STATS_TARGET_LATENCY.c_str(),
+            static_cast<double>(jitterEstimator_.GetTargetLatency() / NS_ONE_US));
+        cJSON_AddNumberToObject(rootJson, KEY_STATS_JITTER.c_str(),
+            static_cast<double>(jitterEstimator_.GetJitter() / NS_ONE_US));
+    }
+    char *data = cJSON_PrintUnformatted(rootJson);
+    if (data == nullptr) {
+        cJSON_Delete(rootJson);
+        return "";
+    }
+    std::string jsonStr(data);
+    cJSON_free(data);
+    cJSON_Delete(rootJson);
+    return jsonStr;
+}
+
+void OutputController::ResetWindowStatistics()
+{
+    std::shared_ptr<TimeStatistician> statistician = statistician_;
+    if (statistician) {
+        statistician->ResetWindowStatistics();
+    }
+    outputIntervalHist_.Reset();
+    outputLatencyHist_.Reset();
+    droppedFrames_.Reset();
+    totalDroppedFrames_.store(0);
+    AVTRANS_LOGI("Reset window statistics.");
+}
+
+void OutputController::SetAdaptiveMode(const bool enable, const int64_t minLatency, const int64_t maxLatency)
+{
+    TRUE_RETURN((minLatency < 0 || maxLatency < minLatency), "Invalid adaptive latency bound.");
+    jitterEstimator_.SetLatencyBound(minLatency, maxLatency);
+    isAdaptiveEnabled_.store(enable);
+    AVTRANS_LOGI("Set adaptive mode enable: %{public}d, min latency: %{public}lld, max latency: %{public}lld.",
+        enable, minLatency, maxLatency);
+}
+
+bool OutputController::GetAdaptiveModeState()
+{
+    return isAdaptiveEnabled_.load();
+}
+
+int64_t OutputController::GetAdaptiveTargetLatency()
+{
+    return jitterEstimator_.GetTargetLatency();
+}
+
+void OutputController::SetAdaptiveParameter(const std::string &jsonStr)
+{
+    cJSON *paramJson = cJSON_Parse(jsonStr.c_str());
+    TRUE_RETURN((paramJson == nullptr), "Parse adaptive parameter failed.");
+    cJSON *enableObj = cJSON_GetObjectItem(paramJson, KEY_ADAPTIVE_ENABLE.c_str());
+    cJSON *minObj = cJSON_GetObjectItem(paramJson, KEY_ADAPTIVE_MIN_LATENCY.c_str());
+    cJSON *maxObj = cJSON_GetObjectItem(paramJson, KEY_ADAPTIVE_MAX_LATENCY.c_str());
+    if (!cJSON_IsBool(enableObj)) {
+        AVTRANS_LOGE("Adaptive parameter enable is invalid.");
+        cJSON_Delete(paramJson);
+        return;
+    }
+    bool enable = cJSON_IsTrue(enableObj);
+    int64_t minLatency = cJSON_IsNumber(minObj) ? static_cast<int64_t>(minObj->valueint) * NS_ONE_MS :
+        jitterEstimator_.GetMinLatency();
+    int64_t maxLatency = cJSON_IsNumber(maxObj) ? static_cast<int64_t>(maxObj->valueint) * NS_ONE_MS :
+        jitterEstimator_.GetMaxLatency();
+    cJSON_Delete(paramJson);
+    SetAdaptiveMode(enable, minLatency, maxLatency);
+}
+
+std::string OutputController::GetAdaptiveParameter()
+{
+    cJSON *paramJson = cJSON_CreateObject();
+    TRUE_RETURN_V_MSG_E((paramJson == nullptr), "", "Create adaptive parameter json failed.");
+    cJSON_AddBoolToObject(paramJson, KEY_ADAPTIVE_ENABLE.c_str(), GetAdaptiveModeState());
+    cJSON_AddNumberToObject(paramJson, KEY_ADAPTIVE_MIN_LATENCY.c_str(),
+        static_cast<double>(jitterEstimator_.GetMinLatency() / NS_ONE_MS));
+    cJSON_AddNumberToObject(paramJson, KEY_ADAPTIVE_MAX_LATENCY.c_str(),
+        static_cast<double>(jitterEstimator_.GetMaxLatency() / NS_ONE_MS));
+    cJSON_AddNumberToObject(paramJson, KEY_ADAPTIVE_TARGET_LATENCY.c_str(),
+        static_cast<double>(jitterEstimator_.GetTargetLatency() / NS_ONE_MS));
+    char *data = cJSON_PrintUnformatted(paramJson);
+    if (data == nullptr) {
+        cJSON_Delete(paramJson);
+        return "";
+    }
+    std::string jsonStr(data);
+    cJSON_free(data);
+    cJSON_Delete(paramJson);
+    return jsonStr;
+}
+
 void OutputController::SetClockBaseline(const int64_t clockBaseline)
 {
     clockBaseline_ = clockBaseline;
@@ -796,16 +1021,7 @@ void OutputController::SetControlStatus(ControlStatus status)
 
 size_t OutputController::GetQueueSize()
 {
-    {
-        std::lock_guard<std::mutex> lock(queueMutex_);
-        return dataQueue_.size();
-    }
-}
-
-void OutputController::ClearQueue(std::queue<std::shared_ptr<Plugin::Buffer>>& queue)
-{
-    std::queue<std::shared_ptr<Plugin::Buffer>> empty;
-    swap(empty, queue);
+    return dataQueue_.Size();
 }
 } // namespace DistributedHardware
 } // namespace OHOS
\ No newline at end of file
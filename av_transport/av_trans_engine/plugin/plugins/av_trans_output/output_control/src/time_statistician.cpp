@@ -14,6 +14,7 @@
  */
 #include "time_statistician.h"
 #include "av_trans_log.h"
+#include "av_trans_utils.h"
 
 namespace OHOS {
 namespace DistributedHardware {
@@ -61,6 +62,7 @@ void TimeStatistician::CalAverPushInterval(const int64_t pushTime)
     pushIntervalSum_ += pushInterval_;
     averPushInterval_ = pushIntervalSum_ / pushIndex_;
     lastPushTime_ = pushTime_;
+    pushIntervalHist_.Record(pushInterval_, GetCurrentTime());
     AVTRANS_LOGD("Statistic pushInterval: %{public}lld, pushIndex: %{public}" PRIu32 ", averPushInterval: %{public}lld",
         pushInterval_, pushIndex_, averPushInterval_);
 }
@@ -77,6 +79,7 @@ void TimeStatistician::CalAverTimeStampInterval(const int64_t timeStamp)
     timeStampIntervalSum_ += timeStampInterval_;
     averTimeStampInterval_ = timeStampIntervalSum_ / timeStampIndex_;
     lastTimeStamp_ = timeStamp_;
+    timeStampIntervalHist_.Record(timeStampInterval_, GetCurrentTime());
     AVTRANS_LOGD("Statistic timeStampInterval: %{public}lld, timeStampIndex: %{public}" PRIu32
         ", averTimeStampInterval: %{public}lld", timeStampInterval_, timeStampIndex_, averTimeStampInterval_);
 }
@@ -100,5 +103,188 @@ int64_t TimeStatistician::GetTimeStampInterval()
 {
     return timeStampInterval_;
 }
+
+WindowStats TimeStatistician::GetPushIntervalStats()
+{
+    return pushIntervalHist_.GetStats(GetCurrentTime());
+}
+
+WindowStats TimeStatistician::GetTimeStampIntervalStats()
+{
+    return timeStampIntervalHist_.GetStats(GetCurrentTime());
+}
+
+void TimeStatistician::ResetWindowStatistics()
+{
+    pushIntervalHist_.Reset();
+    timeStampIntervalHist_.Reset();
+}
+
+namespace {
+constexpr uint32_t PERCENT_50 = 50;
+constexpr uint32_t PERCENT_90 = 90;
+constexpr uint32_t PERCENT_99 = 99;
+constexpr uint32_t PERCENT_100 = 100;
+
+int64_t GetCoveredSeconds(const int64_t startSecond, const int64_t second)
+{
+    if (startSecond < 0 || second < startSecond) {
+        return 0;
+    }
+    int64_t covered = second - startSecond + 1;
+    return (covered > WindowedHistogram::WINDOW_SECONDS) ? WindowedHistogram::WINDOW_SECONDS : covered;
+}
+
+bool IsInWindow(const int64_t slotSecond, const int64_t second)
+{
+    return (slotSecond >= 0) && (slotSecond <= second) && (second - slotSecond < WindowedHistogram::WINDOW_SECONDS);
+}
+}
+
+void WindowedHistogram::Record(const int64_t value, const int64_t now)
+{
+    uint64_t valueUs = (value > 0) ? static_cast<uint64_t>(value / NS_ONE_US) : 0;
+    int64_t second = now / NS_ONE_S;
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (startSecond_ < 0) {
+        startSecond_ = second;
+    }
+    Slot &slot = slots_[static_cast<uint64_t>(second) % WINDOW_SECONDS];
+    if (slot.second != second) {
+        slot.second = second;
+        slot.count = 0;
+        slot.max = 0;
+        slot.bins.fill(0);
+    }
+    slot.count++;
+    slot.bins[GetBinIndex(valueUs)]++;
+    if (static_cast<int64_t>(valueUs) > slot.max) {
+        slot.max = static_cast<int64_t>(valueUs);
+    }
+}
+
+WindowStats WindowedHistogram::GetStats(const int64_t now)
+{
+    int64_t second = now / NS_ONE_S;
+    WindowStats stats;
+    std::array<uint64_t, BIN_NUM> bins {};
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto &slot : slots_) {
+        if (!IsInWindow(slot.second, second)) {
+            continue;
+        }
+        stats.count += slot.count;
+        stats.max = (slot.max > stats.max) ? slot.max : stats.max;
+        for (uint32_t i = 0; i < BIN_NUM; i++) {
+            bins[i] += slot.bins[i];
+        }
+    }
+    int64_t covered = GetCoveredSeconds(startSecond_, second);
+    if (stats.count == 0 || covered == 0) {
+        return stats;
+    }
+    stats.rate = static_cast<double>(stats.count) / covered;
+    const uint32_t percents[] = { PERCENT_50, PERCENT_90, PERCENT_99 };
+    int64_t *results[] = { &stats.p50, &stats.p90, &stats.p99 };
+    uint64_t accumulated = 0;
+    uint32_t index = 0;
+    for (uint32_t i = 0; i < BIN_NUM && index < sizeof(percents) / sizeof(percents[0]); i++) {
+        accumulated += bins[i];
+        while (index < sizeof(percents) / sizeof(percents[0]) &&
+            accumulated * PERCENT_100 >= stats.count * percents[index]) {
+            int64_t binValue = GetBinValue(i);
+            *results[index] = (binValue > stats.max) ? stats.max : binValue;
+            index++;
+        }
+    }
+    return stats;
+}
+
+void WindowedHistogram::Reset()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    startSecond_ = -1;
+    for (auto &slot : slots_) {
+        slot.second = -1;
+        slot.count = 0;
+        slot.max = 0;
+        slot.bins.fill(0);
+    }
+}
+
+uint32_t WindowedHistogram::GetBinIndex(const uint64_t valueUs)
+{
+    if (valueUs < SUB_BIN_NUM) {
+        return static_cast<uint32_t>(valueUs);
+    }
+    uint32_t msb = 0;
+    for (uint64_t v = valueUs; v > 1; v >>= 1) {
+        msb++;
+    }
+    uint32_t shift = msb - SUB_BIN_BITS;
+    uint32_t index = (shift + 1) * SUB_BIN_NUM + static_cast<uint32_t>((valueUs >> shift) & (SUB_BIN_NUM - 1));
+    return (index < BIN_NUM) ? index : (BIN_NUM - 1);
+}
+
+int64_t WindowedHistogram::GetBinValue(const uint32_t index)
+{
+    uint32_t group = index / SUB_BIN_NUM;
+    uint32_t sub = index % SUB_BIN_NUM;
+    if (group == 0) {
+        return static_cast<int64_t>(sub);
+    }
+    uint32_t shift = group - 1;
+    int64_t lowerBound = static_cast<int64_t>(SUB_BIN_NUM + sub) << shift;
+    return lowerBound + ((static_cast<int64_t>(1) << shift) >> 1);
+}
+
+void WindowedCounter::Add(const uint64_t num, const int64_t now)
+{
+    int64_t second = now / NS_ONE_S;
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (startSecond_ < 0) {
+        startSecond_ = second;
+    }
+    Slot &slot = slots_[static_cast<uint64_t>(second) % WindowedHistogram::WINDOW_SECONDS];
+    if (slot.second != second) {
+        slot.second = second;
+        slot.count = 0;
+    }
+    slot.count += num;
+}
+
+uint64_t WindowedCounter::GetCount(const int64_t now)
+{
+    int64_t second = now / NS_ONE_S;
+    uint64_t count = 0;
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto &slot : slots_) {
+        if (IsInWindow(slot.second, second)) {
+            count += slot.count;
+        }
+    }
+    return count;
+}
+
+double WindowedCounter::GetRate(const int64_t now)
+{
+    uint64_t count = GetCount(now);
+    int64_t covered = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        covered = GetCoveredSeconds(startSecond_, now / NS_ONE_S);
+    }
+    return (covered == 0) ? 0 : static_cast<double>(count) / covered;
+}
+
+void WindowedCounter::Reset()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    startSecond_ = -1;
+    for (auto &slot : slots_) {
+        slot.second = -1;
+        slot.count = 0;
+    }
+}
 } // namespace DistributedHardware
 } // namespace OHOS
\ No newline at end of file
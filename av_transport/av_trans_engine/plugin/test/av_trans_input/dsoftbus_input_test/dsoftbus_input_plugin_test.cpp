@@ -15,6 +15,8 @@
 
 #include "dsoftbus_input_plugin_test.h"
 
+#include <thread>
+
 #include "dsoftbus_input_plugin.h"
 
 namespace OHOS {
@@ -202,5 +204,159 @@ HWTEST_F(DsoftbusInputPluginTest, Reset_001, TestSize.Level1)
     plugin->isrunning_ = false;
     plugin->HandleData();
 }
+
+HWTEST_F(DsoftbusInputPluginTest, OnStreamReceived_001, TestSize.Level1)
+{
+    auto plugin = std::make_shared<DsoftbusInputPlugin>(PLUGINNAME);
+    AVTransVideoBufferMeta meta;
+    meta.pts_ = 1000;
+    meta.frameNum_ = 10;
+    meta.extPts_ = 2000;
+    meta.extFrameNum_ = 20;
+    uint8_t extHeader[AVT_EXT_HEADER_LEN] = {0};
+    EXPECT_TRUE(meta.MarshalVideoMetaBinary(extHeader, AVT_EXT_HEADER_LEN));
+
+    char payload[] = "frame";
+    StreamData data = {payload, sizeof(payload)};
+    StreamData ext = {reinterpret_cast<char *>(extHeader), AVT_EXT_HEADER_LEN};
+    plugin->OnStreamReceived(&data, &ext);
+    ASSERT_EQ(1, plugin->dataQueue_.size());
+    auto buffer = plugin->dataQueue_.front();
+    EXPECT_EQ(1000, buffer->pts);
+    EXPECT_EQ(10, Plugin::AnyCast<uint32_t>(buffer->GetBufferMeta()->GetMeta(Tag::USER_FRAME_NUMBER)));
+    EXPECT_EQ(2000, Plugin::AnyCast<int64_t>(buffer->GetBufferMeta()->GetMeta(Tag::MEDIA_START_TIME)));
+
+    AVTransVideoBufferMeta jsonMeta;
+    jsonMeta.pts_ = 3000;
+    jsonMeta.frameNum_ = 30;
+    cJSON *extJson = cJSON_CreateObject();
+    ASSERT_NE(nullptr, extJson);
+    cJSON_AddNumberToObject(extJson, AVT_DATA_META_TYPE.c_str(), static_cast<uint32_t>(BufferMetaType::VIDEO));
+    cJSON_AddStringToObject(extJson, AVT_DATA_PARAM.c_str(), jsonMeta.MarshalVideoMeta().c_str());
+    char *extStr = cJSON_PrintUnformatted(extJson);
+    ASSERT_NE(nullptr, extStr);
+    std::string jsonExt(extStr);
+    cJSON_free(extStr);
+    cJSON_Delete(extJson);
+    ext = {const_cast<char *>(jsonExt.c_str()), jsonExt.length()};
+    plugin->OnStreamReceived(&data, &ext);
+    ASSERT_EQ(2, plugin->dataQueue_.size());
+    EXPECT_EQ(3000, plugin->dataQueue_.back()->pts);
+
+    extHeader[0] = 0;
+    ext = {reinterpret_cast<char *>(extHeader), AVT_EXT_HEADER_LEN};
+    plugin->OnStreamReceived(&data, &ext);
+    EXPECT_EQ(2, plugin->dataQueue_.size());
+}
+
+HWTEST_F(DsoftbusInputPluginTest, OnStreamPayloadReceived_001, TestSize.Level1)
+{
+    auto plugin = std::make_shared<DsoftbusInputPlugin>(PLUGINNAME);
+    AVTransVideoBufferMeta meta;
+    meta.pts_ = 1000;
+    meta.frameNum_ = 10;
+    uint8_t extHeader[AVT_EXT_HEADER_LEN] = {0};
+    EXPECT_TRUE(meta.MarshalVideoMetaBinary(extHeader, AVT_EXT_HEADER_LEN));
+    StreamData ext = {reinterpret_cast<char *>(extHeader), AVT_EXT_HEADER_LEN};
+
+    auto allocator = plugin->GetStreamPayloadAllocator();
+    ASSERT_NE(nullptr, allocator);
+    uint32_t size = 64;
+    auto payload = allocator(size);
+    ASSERT_NE(nullptr, payload);
+    uint8_t *address = payload.get();
+    plugin->OnStreamPayloadReceived(payload, size, &ext);
+    ASSERT_EQ(1, plugin->dataQueue_.size());
+    auto buffer = plugin->dataQueue_.front();
+    EXPECT_EQ(1000, buffer->pts);
+    EXPECT_EQ(address, buffer->GetMemory()->GetReadOnlyData());
+    EXPECT_EQ(size, buffer->GetMemory()->GetSize());
+
+    plugin->OnStreamPayloadReceived(nullptr, size, &ext);
+    plugin->OnStreamPayloadReceived(payload, size, nullptr);
+    EXPECT_EQ(1, plugin->dataQueue_.size());
+}
+
+HWTEST_F(DsoftbusInputPluginTest, OnStreamReceived_002, TestSize.Level1)
+{
+    auto plugin = std::make_shared<DsoftbusInputPlugin>(PLUGINNAME);
+    AVTransVideoBatchMeta batchMeta;
+    for (uint32_t i = 0; i < 2; i++) {
+        AVTransVideoBufferMeta meta;
+        meta.pts_ = 1000 * (i + 1);
+        meta.frameNum_ = i + 1;
+        EXPECT_TRUE(batchMeta.AddFrame(meta, 6 + i));
+    }
+    const std::vector<uint8_t> &extBuf = batchMeta.Marshal();
+    char payload[] = "frame1frame22";
+    uint32_t payloadLen = 13;
+    StreamData data = {payload, static_cast<int>(payloadLen)};
+    StreamData ext = {reinterpret_cast<char *>(const_cast<uint8_t *>(extBuf.data())), static_cast<int>(extBuf.size())};
+    plugin->OnStreamReceived(&data, &ext);
+    ASSERT_EQ(2, plugin->dataQueue_.size());
+    EXPECT_EQ(1000, plugin->dataQueue_.front()->pts);
+    EXPECT_EQ(6, plugin->dataQueue_.front()->GetMemory()->GetSize());
+    EXPECT_EQ(2000, plugin->dataQueue_.back()->pts);
+    EXPECT_EQ(7, plugin->dataQueue_.back()->GetMemory()->GetSize());
+
+    data.bufLen = static_cast<int>(payloadLen - 1);
+    plugin->OnStreamReceived(&data, &ext);
+    EXPECT_EQ(2, plugin->dataQueue_.size());
+
+    auto block = plugin->GetStreamPayloadAllocator()(payloadLen);
+    ASSERT_NE(nullptr, block);
+    plugin->OnStreamPayloadReceived(block, payloadLen, &ext);
+    ASSERT_EQ(4, plugin->dataQueue_.size());
+    EXPECT_EQ(block.get() + 6, plugin->dataQueue_.back()->GetMemory()->GetReadOnlyData());
+}
+
+HWTEST_F(DsoftbusInputPluginTest, OnStreamReceived_003, TestSize.Level1)
+{
+    auto plugin = std::make_shared<DsoftbusInputPlugin>(PLUGINNAME);
+    // the frame lengths wrap around to the data len in 32 bits
+    AVTransVideoBatchMeta batchMeta;
+    AVTransVideoBufferMeta meta;
+    meta.pts_ = 1000;
+    meta.frameNum_ = 1;
+    EXPECT_TRUE(batchMeta.AddFrame(meta, UINT32_MAX));
+    EXPECT_TRUE(batchMeta.AddFrame(meta, 14));
+    const std::vector<uint8_t> &extBuf = batchMeta.Marshal();
+    char payload[] = "frame1frame22";
+    uint32_t payloadLen = 13;
+    StreamData data = {payload, static_cast<int>(payloadLen)};
+    StreamData ext = {reinterpret_cast<char *>(const_cast<uint8_t *>(extBuf.data())), static_cast<int>(extBuf.size())};
+    AVTransVideoBatchMeta parsedMeta;
+    EXPECT_FALSE(parsedMeta.Unmarshal(extBuf.data(), static_cast<uint32_t>(extBuf.size())));
+    plugin->OnStreamReceived(&data, &ext);
+    EXPECT_EQ(0, plugin->dataQueue_.size());
+}
+
+HWTEST_F(DsoftbusInputPluginTest, HandleData_001, TestSize.Level1)
+{
+    auto plugin = std::make_shared<DsoftbusInputPlugin>(PLUGINNAME);
+    std::atomic<uint32_t> handledNum {0};
+    plugin->dataCb_ = [&handledNum](std::shared_ptr<Buffer>) { handledNum++; };
+    plugin->SetCurrentState(State::PREPARED);
+    plugin->isrunning_.store(true);
+    std::thread handleThread([plugin]() { plugin->HandleData(); });
+
+    auto buffer = std::make_shared<Buffer>();
+    plugin->DataEnqueue(buffer);
+    std::this_thread::sleep_for(std::chrono::milliseconds(PLUGIN_TASK_WAIT_TIME));
+    EXPECT_EQ(0, handledNum.load());
+
+    plugin->SetCurrentState(State::RUNNING);
+    int32_t waitNum = 0;
+    while (handledNum.load() == 0 && waitNum++ < PLUGIN_STATE_CHANGE_MAX_COST_MS) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(1, handledNum.load());
+
+    int64_t stopTime = GetCurrentTime();
+    plugin->isrunning_.store(false);
+    plugin->WakeUpHandleData();
+    handleThread.join();
+    EXPECT_GT(PLUGIN_STATE_CHANGE_MAX_COST_MS, (GetCurrentTime() - stopTime) / NS_ONE_MS);
+}
 } // namespace DistributedHardware
 } // namespace OHOS
\ No newline at end of file
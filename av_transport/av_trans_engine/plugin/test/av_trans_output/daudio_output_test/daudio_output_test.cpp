@@ -127,6 +127,14 @@ HWTEST_F(DaudioOutputTest, GetParameter_001, TestSize.Level1)
     EXPECT_EQ(Status::OK, ret);
 }
 
+HWTEST_F(DaudioOutputTest, GetParameter_003, TestSize.Level1)
+{
+    auto plugin = std::make_shared<DaudioOutputPlugin>(PLUGINNAME);
+    EXPECT_EQ(Status::ERROR_UNIMPLEMENTED, plugin->SetParameter(TAG_OUTPUT_STATISTICS, std::string("")));
+    ValueType val;
+    EXPECT_EQ(Status::ERROR_UNIMPLEMENTED, plugin->GetParameter(TAG_OUTPUT_STATISTICS, val));
+}
+
 HWTEST_F(DaudioOutputTest, GetParameter_002, TestSize.Level1)
 {
     auto plugin = std::make_shared<DaudioOutputPlugin>(PLUGINNAME);
@@ -209,5 +209,73 @@ HWTEST_F(DsoftbusOutputPluginTest, OpenSoftbusChannel_001, TestSize.Level1)
     StreamData *ext = nullptr;
     plugin->OnStreamReceived(data, ext);
 }
+
+HWTEST_F(DsoftbusOutputPluginTest, OnStreamReceived_001, TestSize.Level1)
+{
+    auto plugin = std::make_shared<DsoftbusOutputPlugin>(PLUGINNAME);
+    EXPECT_EQ(AVT_EXT_HEADER_VERSION_JSON, plugin->extHeaderVersion_.load());
+
+    char version = static_cast<char>(AVT_EXT_HEADER_VERSION_BINARY);
+    StreamData data = {&version, sizeof(version)};
+    std::string capStr = "{\"avtrans_data_ext_version\":1}";
+    StreamData ext = {const_cast<char *>(capStr.c_str()), capStr.length()};
+    plugin->OnStreamReceived(&data, &ext);
+    EXPECT_EQ(AVT_EXT_HEADER_VERSION_BINARY, plugin->extHeaderVersion_.load());
+
+    plugin->Reset();
+    EXPECT_EQ(AVT_EXT_HEADER_VERSION_JSON, plugin->extHeaderVersion_.load());
+}
+
+HWTEST_F(DsoftbusOutputPluginTest, SendBatching_001, TestSize.Level1)
+{
+    auto plugin = std::make_shared<DsoftbusOutputPlugin>(PLUGINNAME);
+    std::string param = "{\"enable\":true,\"maxDelayMs\":20,\"maxBytes\":1024}";
+    EXPECT_EQ(Status::OK, plugin->SetParameter(TAG_SEND_BATCHING, param));
+    EXPECT_TRUE(plugin->batchEnabled_.load());
+    EXPECT_EQ(20, plugin->batchMaxDelayMs_.load());
+    EXPECT_EQ(1024, plugin->batchMaxBytes_.load());
+
+    auto createFrame = [](uint32_t size, uint32_t frameNum) {
+        auto buffer = std::make_shared<Plugin::Buffer>(BufferMetaType::VIDEO);
+        buffer->AllocMemory(nullptr, size);
+        std::vector<uint8_t> payload(size, 1);
+        buffer->GetMemory()->Write(payload.data(), size, 0);
+        buffer->GetBufferMeta()->SetMeta(Tag::USER_FRAME_NUMBER, frameNum);
+        return buffer;
+    };
+    auto buffer = createFrame(300, 0);
+    EXPECT_FALSE(plugin->IsBatchable(buffer));
+
+    plugin->extHeaderVersion_.store(AVT_EXT_HEADER_VERSION_BATCH);
+    for (uint32_t i = 0; i < 3; i++) {
+        buffer = createFrame(300, i);
+        plugin->FeedBuffer(buffer);
+    }
+    EXPECT_EQ(3, plugin->batchFrames_.size());
+    EXPECT_EQ(900, plugin->batchBytes_);
+    EXPECT_LT(0, plugin->GetFeedWaitTime());
+
+    buffer = createFrame(300, 3);
+    plugin->FeedBuffer(buffer);
+    EXPECT_EQ(1, plugin->batchFrames_.size());
+
+    buffer = createFrame(2048, 4);
+    EXPECT_FALSE(plugin->IsBatchable(buffer));
+    plugin->FeedBuffer(buffer);
+    EXPECT_TRUE(plugin->batchFrames_.empty());
+
+    ValueType value;
+    EXPECT_EQ(Status::OK, plugin->GetParameter(TAG_SEND_BATCHING, value));
+    EXPECT_NE(std::string::npos, Plugin::AnyCast<std::string>(value).find(KEY_BATCH_SEND_CALLS));
+
+    buffer = createFrame(300, 5);
+    plugin->FeedBuffer(buffer);
+    EXPECT_FALSE(plugin->IsBatchDue(true));
+    param = "{\"enable\":true,\"maxDelayMs\":0}";
+    EXPECT_EQ(Status::OK, plugin->SetParameter(TAG_SEND_BATCHING, param));
+    EXPECT_TRUE(plugin->IsBatchDue(true));
+    EXPECT_FALSE(plugin->IsBatchDue(false));
+    plugin->ClearBatch();
+}
 } // namespace DistributedHardware
 } // namespace OHOS
\ No newline at end of file
@@ -45,7 +45,7 @@ HWTEST_F(OutputControllerTest, SetParameter_001, TestSize.Level0)
     controller->mode_.store(OutputController::ControlMode::SYNC);
 
     for (int32_t i = 0; i <= TEST_QUEUE_MAX_SIZE; i++) {
-        controller->dataQueue_.push(data);
+        controller->dataQueue_.Push(data);
     }
     controller->PushData(data);
 }
@@ -174,7 +174,7 @@ HWTEST_F(OutputControllerTest, WaitRereadClockFailed_001, testing::ext::TestSize
 
     data = std::make_shared<Plugin::Buffer>(BufferMetaType::AUDIO);
     for (int32_t i = 0; i <= TEST_QUEUE_MAX_SIZE; i++) {
-        controller->dataQueue_.push(data);
+        controller->dataQueue_.Push(data);
     }
     ret = controller->WaitRereadClockFailed(data);
     EXPECT_EQ(true, ret);
@@ -210,11 +210,11 @@ HWTEST_F(OutputControllerTest, CheckIsProcessInDynamicBalanceOnce_001, testing::
     EXPECT_EQ(false, ret);
 }
 
-HWTEST_F(OutputControllerTest, PostOutputEvent_001, testing::ext::TestSize.Level1)
+HWTEST_F(OutputControllerTest, OutputFrame_001, testing::ext::TestSize.Level1)
 {
     auto controller = std::make_shared<OutputController>();
     std::shared_ptr<Plugin::Buffer> data;
-    int32_t ret = controller->PostOutputEvent(data);
+    int32_t ret = controller->OutputFrame(data);
     EXPECT_EQ(HANDLE_FAILED, ret);
 
     data = std::make_shared<AVBuffer>();
@@ -251,7 +251,7 @@ HWTEST_F(OutputControllerTest, NotifyOutput_001, testing::ext::TestSize.Level1)
 
     result = 1;
     data = std::make_shared<Plugin::Buffer>(BufferMetaType::AUDIO);
-    controller->dataQueue_.push(data);
+    controller->dataQueue_.Push(data);
     controller->HandleControlResult(data, result);
 
     result = 2;
@@ -260,5 +260,145 @@ HWTEST_F(OutputControllerTest, NotifyOutput_001, testing::ext::TestSize.Level1)
     result = 3;
     controller->HandleControlResult(data, result);
 }
+
+HWTEST_F(OutputControllerTest, FrameRing_001, testing::ext::TestSize.Level1)
+{
+    const uint32_t capacity = 4;
+    FrameRing<int32_t> ring(capacity, FrameDropPolicy::DROP_OLDEST);
+    for (int32_t i = 0; i < static_cast<int32_t>(capacity) + 2; i++) {
+        EXPECT_EQ(true, ring.Push(i));
+    }
+    int32_t value = -1;
+    EXPECT_EQ(true, ring.Pop(value));
+    EXPECT_EQ(2, value);
+    EXPECT_EQ(2, ring.GetDroppedCount());
+
+    ring.Clear();
+    EXPECT_EQ(true, ring.Empty());
+    EXPECT_EQ(true, ring.Push(capacity));
+    EXPECT_EQ(true, ring.Pop(value));
+    EXPECT_EQ(static_cast<int32_t>(capacity), value);
+    EXPECT_EQ(false, ring.Pop(value));
+
+    ring.Reset(capacity, FrameDropPolicy::DROP_NEWEST);
+    for (int32_t i = 0; i < static_cast<int32_t>(capacity); i++) {
+        EXPECT_EQ(true, ring.Push(i));
+    }
+    EXPECT_EQ(false, ring.Push(capacity));
+    EXPECT_EQ(true, ring.Pop(value));
+    EXPECT_EQ(0, value);
+    EXPECT_EQ(1, ring.GetDroppedCount());
+}
+
+HWTEST_F(OutputControllerTest, SetFrameQueueConfig_001, testing::ext::TestSize.Level1)
+{
+    auto controller = std::make_shared<OutputController>();
+    const uint32_t capacity = 10;
+    controller->SetFrameQueueConfig(capacity, FrameDropPolicy::DROP_NEWEST);
+    EXPECT_EQ(capacity, controller->dataQueue_.GetCapacity());
+    EXPECT_EQ(FrameDropPolicy::DROP_NEWEST, controller->dataQueue_.GetDropPolicy());
+
+    controller->SetFrameQueueConfig(0, FrameDropPolicy::DROP_OLDEST);
+    EXPECT_EQ(capacity, controller->dataQueue_.GetCapacity());
+    EXPECT_EQ(0, controller->GetDroppedFrameCount());
+}
+
+HWTEST_F(OutputControllerTest, WindowedHistogram_001, testing::ext::TestSize.Level1)
+{
+    WindowedHistogram histogram;
+    const int64_t now = 100 * NS_ONE_S;
+    WindowStats stats = histogram.GetStats(now);
+    EXPECT_EQ(0, stats.count);
+
+    const int64_t sampleNum = 100;
+    for (int64_t i = 1; i <= sampleNum; i++) {
+        histogram.Record(i * NS_ONE_MS, now);
+    }
+    const int64_t stall = 200 * NS_ONE_MS;
+    histogram.Record(stall, now);
+    stats = histogram.GetStats(now);
+    EXPECT_EQ(sampleNum + 1, stats.count);
+    EXPECT_EQ(stall / NS_ONE_US, stats.max);
+    EXPECT_LE(stats.p50, stats.p90);
+    EXPECT_LE(stats.p90, stats.p99);
+    EXPECT_LE(stats.p99, stats.max);
+
+    stats = histogram.GetStats(now + WindowedHistogram::WINDOW_SECONDS * NS_ONE_S);
+    EXPECT_EQ(0, stats.count);
+
+    histogram.Reset();
+    stats = histogram.GetStats(now);
+    EXPECT_EQ(0, stats.count);
+}
+
+HWTEST_F(OutputControllerTest, GetWindowStatistics_001, testing::ext::TestSize.Level1)
+{
+    auto controller = std::make_shared<OutputController>();
+    controller->RecordDroppedFrames(2);
+    ValueType value;
+    Status ret = controller->GetParameter(TAG_OUTPUT_STATISTICS, value);
+    EXPECT_EQ(Status::OK, ret);
+    std::string statistics = Plugin::AnyCast<std::string>(value);
+    EXPECT_NE(std::string::npos, statistics.find(KEY_STATS_OUTPUT_INTERVAL));
+    EXPECT_EQ(2, controller->totalDroppedFrames_.load());
+
+    ret = controller->SetParameter(TAG_OUTPUT_STATISTICS, std::string(""));
+    EXPECT_EQ(Status::OK, ret);
+    EXPECT_EQ(0, controller->totalDroppedFrames_.load());
+    EXPECT_EQ(0, controller->droppedFrames_.GetCount(GetCurrentTime()));
+}
+
+HWTEST_F(OutputControllerTest, JitterEstimator_001, testing::ext::TestSize.Level1)
+{
+    JitterEstimator estimator;
+    const int64_t minLatency = 10 * NS_ONE_MS;
+    const int64_t maxLatency = 100 * NS_ONE_MS;
+    estimator.SetLatencyBound(maxLatency, minLatency);
+    EXPECT_EQ(JitterEstimator::DEFAULT_MAX_LATENCY, estimator.GetMaxLatency());
+    estimator.SetLatencyBound(minLatency, maxLatency);
+    EXPECT_EQ(0, estimator.GetPlayoutTime(0));
+
+    const int64_t interval = 16 * NS_ONE_MS;
+    const int64_t frameNum = 100;
+    for (int64_t i = 0; i < frameNum; i++) {
+        estimator.Update(i * interval, i * interval, 0);
+    }
+    EXPECT_EQ(minLatency, estimator.GetTargetLatency());
+    EXPECT_EQ(frameNum * interval + minLatency, estimator.GetPlayoutTime(frameNum * interval));
+
+    const int64_t jitter = 40 * NS_ONE_MS;
+    for (int64_t i = frameNum; i < frameNum * 2; i++) {
+        estimator.Update(i * interval + ((i % 2 == 0) ? jitter : 0), i * interval, 0);
+    }
+    EXPECT_GT(estimator.GetTargetLatency(), minLatency);
+    EXPECT_LE(estimator.GetTargetLatency(), maxLatency);
+
+    estimator.Reset();
+    EXPECT_EQ(minLatency, estimator.GetTargetLatency());
+}
+
+HWTEST_F(OutputControllerTest, AdaptiveMode_001, testing::ext::TestSize.Level1)
+{
+    auto controller = std::make_shared<OutputController>();
+    std::string param = "{\"enable\":true,\"minLatencyMs\":30,\"maxLatencyMs\":300}";
+    Status ret = controller->SetParameter(TAG_ADAPTIVE_LATENCY, param);
+    EXPECT_EQ(Status::OK, ret);
+    EXPECT_EQ(true, controller->GetAdaptiveModeState());
+    EXPECT_EQ(30 * NS_ONE_MS, controller->GetAdaptiveTargetLatency());
+
+    std::shared_ptr<Plugin::Buffer> data = std::make_shared<Plugin::Buffer>(BufferMetaType::VIDEO);
+    controller->CheckSyncInfo(data);
+    EXPECT_EQ(OutputController::ControlMode::ADAPTIVE, controller->GetControlMode());
+
+    ValueType value;
+    ret = controller->GetParameter(TAG_ADAPTIVE_LATENCY, value);
+    EXPECT_EQ(Status::OK, ret);
+    std::string result = Plugin::AnyCast<std::string>(value);
+    EXPECT_NE(std::string::npos, result.find(KEY_ADAPTIVE_TARGET_LATENCY));
+
+    controller->SetAdaptiveMode(false, 30 * NS_ONE_MS, 300 * NS_ONE_MS);
+    controller->CheckSyncInfo(data);
+    EXPECT_EQ(OutputController::ControlMode::SMOOTH, controller->GetControlMode());
+}
 } // namespace DistributedHardware
 } // namespace OHOS
\ No newline at end of file
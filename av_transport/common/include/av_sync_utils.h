@@ -16,6 +16,8 @@
 #ifndef OHOS_AV_TRANSPORT_SHARED_MEMORY_H
 #define OHOS_AV_TRANSPORT_SHARED_MEMORY_H
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string>
 
@@ -24,6 +26,38 @@ namespace DistributedHardware {
 constexpr uint8_t INVALID_VALUE_FALG = 0;
 constexpr uint32_t MAX_CLOCK_UNIT_COUNT = 50;
 constexpr uint32_t DEFAULT_INVALID_FRAME_NUM = 0;
+constexpr uint32_t MAX_SEQLOCK_READ_RETRY = 100;
+
+/*
+ * Layout version 2, both layouts start with a seqlock sequence counter which the single writer makes odd while
+ * updating.
+ * clock ring: seq(4) latestIndex(4) unit[MAX_CLOCK_UNIT_COUNT]{frameNum(4) pts(8)}
+ * frame info: seq(4) frameNum(4) pts(8)
+ * Layout version 1 is still read and written for regions of the version 1 size, created by older peers.
+ * clock ring: unit[MAX_CLOCK_UNIT_COUNT]{frameNum(4) pts(8)}
+ * frame info: frameNum(4) pts(8)
+ * Mixed versions are only supported when the old side creates the region. A version 2 region is larger than a
+ * version 1 one, so an old engine given a region created by new code reads it with the wrong offsets.
+ */
+constexpr size_t AV_SYNC_SEQ_SIZE = sizeof(uint32_t);
+constexpr size_t AV_SYNC_CLOCK_UNIT_SIZE = sizeof(uint32_t) + sizeof(int64_t);
+constexpr size_t AV_SYNC_CLOCK_RING_HEADER_SIZE = AV_SYNC_SEQ_SIZE + sizeof(uint32_t);
+constexpr size_t AV_SYNC_CLOCK_RING_MEM_SIZE = AV_SYNC_CLOCK_RING_HEADER_SIZE +
+    AV_SYNC_CLOCK_UNIT_SIZE * MAX_CLOCK_UNIT_COUNT;
+constexpr size_t AV_SYNC_FRAME_INFO_MEM_SIZE = AV_SYNC_SEQ_SIZE + sizeof(uint32_t) + sizeof(int64_t);
+constexpr size_t AV_SYNC_V1_CLOCK_RING_MEM_SIZE = AV_SYNC_CLOCK_UNIT_SIZE * MAX_CLOCK_UNIT_COUNT;
+constexpr size_t AV_SYNC_V1_FRAME_INFO_MEM_SIZE = sizeof(uint32_t) + sizeof(int64_t);
+
+/*
+ * Output frame ring shared by one writer (the receiver engine) and one reader (the consumer), both indexes only grow.
+ * header: slotNum(4) slotSize(4) writeIndex(8) readIndex(8) overflowCount(8) latencySumNs(8) latencyMaxNs(8)
+ * slot: dataSize(4) metaType(4) dataType(4) format(4) width(4) height(4) sampleRate(4) reserved(4) pts(8)
+ *       writeTimeNs(8) data[slotSize]
+ */
+constexpr size_t AV_FRAME_RING_HEADER_SIZE = 2 * sizeof(uint32_t) + 5 * sizeof(uint64_t);
+constexpr size_t AV_FRAME_RING_SLOT_HEADER_SIZE = 8 * sizeof(uint32_t) + 2 * sizeof(int64_t);
+constexpr uint32_t MAX_FRAME_RING_SLOT_NUM = 64;
+constexpr uint32_t MAX_FRAME_RING_SLOT_SIZE = 16 * 1024 * 1024;
 
 struct AVTransSharedMemory {
     int32_t fd;
@@ -31,12 +65,43 @@ struct AVTransSharedMemory {
     std::string name;
 };
 
+struct AVTransMappedMemory {
+    AVTransSharedMemory memory = AVTransSharedMemory{ 0, 0, "" };
+    uint8_t *base = nullptr;
+};
+
 struct AVSyncClockUnit {
     uint32_t index;
     uint32_t frameNum;
     int64_t pts;
 };
 
+struct AVFrameRingInfo {
+    uint32_t dataSize = 0;
+    uint32_t metaType = 0;
+    uint32_t dataType = 0;
+    uint32_t format = 0;
+    uint32_t width = 0;
+    uint32_t height = 0;
+    uint32_t sampleRate = 0;
+    int64_t pts = 0;
+    int64_t writeTimeNs = 0;
+};
+
+/* Ring geometry checked once by the writer, the copy in the shared header is never trusted afterwards */
+struct AVFrameRingGeometry {
+    uint32_t slotNum = 0;
+    uint32_t slotSize = 0;
+};
+
+struct AVFrameRingStatistics {
+    uint64_t writeCount = 0;
+    uint64_t readCount = 0;
+    uint64_t overflowCount = 0;
+    int64_t avgLatencyNs = 0;
+    int64_t maxLatencyNs = 0;
+};
+
 /**
  * @brief create shared memory space for av sync.
  * @param name    name for the shared memory.
@@ -51,47 +116,136 @@ AVTransSharedMemory CreateAVTransSharedMemory(const std::string &name, size_t si
 void CloseAVTransSharedMemory(const AVTransSharedMemory &memory) noexcept;
 
 /**
- * @brief write the clock unit into the shared memory space.
- * @param memory       shared memory
+ * @brief map the shared memory space once, the mapping is reused by the read and write functions below.
+ *        a region already held by mapped is unmapped first.
+ * @param memory    shared memory
+ * @param mapped    the mapped region
+ * @return Returns DH_AVT_SUCCESS(0) if successful, otherwise returns other error code.
+ */
+int32_t MapAVTransSharedMemory(const AVTransSharedMemory &memory, AVTransMappedMemory &mapped);
+
+/**
+ * @brief unmap the shared memory space mapped by MapAVTransSharedMemory.
+ * @param mapped    the mapped region
+ */
+void UnmapAVTransSharedMemory(AVTransMappedMemory &mapped) noexcept;
+
+/**
+ * @brief write the clock unit into the clock ring and publish it as the latest one.
+ * @param mapped       the mapped clock ring
  * @param clockUnit    the clock unit
  * @return Returns DH_AVT_SUCCESS(0) if successful, otherwise returns other error code.
  */
-int32_t WriteClockUnitToMemory(const AVTransSharedMemory &memory, AVSyncClockUnit &clockUnit);
+int32_t WriteClockUnitToMemory(const AVTransMappedMemory &mapped, AVSyncClockUnit &clockUnit);
 
 /**
- * @brief read clock unit from the shared memory space.
- * @param memory       shared memory
+ * @brief read the latest clock unit from the clock ring.
+ * @param mapped       the mapped clock ring
  * @param clockUnit    the clock unit
  * @return Returns DH_AVT_SUCCESS(0) if successful, otherwise returns other error code.
  */
-int32_t ReadClockUnitFromMemory(const AVTransSharedMemory &memory, AVSyncClockUnit &clockUnit);
+int32_t ReadClockUnitFromMemory(const AVTransMappedMemory &mapped, AVSyncClockUnit &clockUnit);
 
 /**
  * @brief write frame number and pts into the shared memory space.
- * @param memory       shared memory
+ * @param mapped       the mapped shared memory
  * @param frameNum     the frame number
  * @param timestamp    the pts
  * @return Returns DH_AVT_SUCCESS(0) if successful, otherwise returns other error code.
  */
-int32_t WriteFrameInfoToMemory(const AVTransSharedMemory &memory, uint32_t frameNum, int64_t timestamp);
+int32_t WriteFrameInfoToMemory(const AVTransMappedMemory &mapped, uint32_t frameNum, int64_t timestamp);
 
 /**
  * @brief read frame number and pts from the shared memory space.
- * @param memory       shared memory
+ * @param mapped       the mapped shared memory
  * @param frameNum     the frame number
  * @param timestamp    the pts
  * @return Returns DH_AVT_SUCCESS(0) if successful, otherwise returns other error code.
  */
-int32_t ReadFrameInfoFromMemory(const AVTransSharedMemory &memory, uint32_t &frameNum, int64_t &timestamp);
+int32_t ReadFrameInfoFromMemory(const AVTransMappedMemory &mapped, uint32_t &frameNum, int64_t &timestamp);
 
 /**
  * @brief reset the shared memory value to all zeros.
- * @param memory       shared memory
+ * @param mapped       the mapped shared memory
+ * @return Returns DH_AVT_SUCCESS(0) if successful, otherwise returns other error code.
+ */
+int32_t ResetSharedMemory(const AVTransMappedMemory &mapped);
+
+/**
+ * @brief get the shared memory size needed by a frame ring.
+ * @param slotNum     the number of frame slots
+ * @param slotSize    the max frame data size of one slot
+ * @return the shared memory size, 0 if the parameters are invalid.
+ */
+size_t GetFrameRingMemSize(uint32_t slotNum, uint32_t slotSize);
+
+/**
+ * @brief format the frame ring header, called by the reader before handing the memory to the writer.
+ * @param mapped      the mapped shared memory
+ * @param slotNum     the number of frame slots
+ * @param slotSize    the max frame data size of one slot
+ * @return Returns DH_AVT_SUCCESS(0) if successful, otherwise returns other error code.
+ */
+int32_t InitFrameRingMemory(const AVTransMappedMemory &mapped, uint32_t slotNum, uint32_t slotSize);
+
+/**
+ * @brief check the frame ring header against the shared memory size.
+ * @param mapped      the mapped shared memory
+ * @return Returns DH_AVT_SUCCESS(0) if successful, otherwise returns other error code.
+ */
+int32_t CheckFrameRingMemory(const AVTransMappedMemory &mapped);
+
+/**
+ * @brief check the frame ring header against the shared memory size and output its geometry.
+ * @param mapped      the mapped shared memory
+ * @param geometry    the checked slot number and slot size
+ * @return Returns DH_AVT_SUCCESS(0) if successful, otherwise returns other error code.
+ */
+int32_t CheckFrameRingMemory(const AVTransMappedMemory &mapped, AVFrameRingGeometry &geometry);
+
+/**
+ * @brief write one frame into the frame ring, the frame is dropped and counted when the ring is full.
+ * @param mapped      the mapped frame ring
+ * @param geometry    the geometry got from CheckFrameRingMemory, the shared header is not read again
+ * @param info        the frame info, writeTimeNs is filled in here
+ * @param data        the frame data of info.dataSize bytes
+ * @param isNotify    true when the reader has drained the ring and needs a notification
  * @return Returns DH_AVT_SUCCESS(0) if successful, otherwise returns other error code.
  */
+int32_t WriteFrameToRing(const AVTransMappedMemory &mapped, const AVFrameRingGeometry &geometry,
+    AVFrameRingInfo &info, const uint8_t *data, bool &isNotify);
+
+/**
+ * @brief read the oldest frame from the frame ring and account its latency.
+ * @param mapped      the mapped frame ring
+ * @param info        the frame info
+ * @param data        the buffer to copy the frame data into
+ * @param dataLen     the buffer size, the frame is kept in the ring if it is too small
+ * @return Returns DH_AVT_SUCCESS(0) if successful, ERR_DH_AVT_SHARED_RING_EMPTY if there is no frame.
+ */
+int32_t ReadFrameFromRing(const AVTransMappedMemory &mapped, AVFrameRingInfo &info, uint8_t *data,
+    uint32_t dataLen);
+
+/**
+ * @brief get the write, read, overflow and latency statistics of the frame ring.
+ * @param mapped      the mapped frame ring
+ * @param stats       the statistics
+ * @return Returns DH_AVT_SUCCESS(0) if successful, otherwise returns other error code.
+ */
+int32_t GetFrameRingStatistics(const AVTransMappedMemory &mapped, AVFrameRingStatistics &stats);
+
+/*
+ * Compatible interfaces which map the shared memory for every call, kept for the callers built against them.
+ * Prefer the AVTransMappedMemory ones above.
+ */
+int32_t WriteClockUnitToMemory(const AVTransSharedMemory &memory, AVSyncClockUnit &clockUnit);
+int32_t ReadClockUnitFromMemory(const AVTransSharedMemory &memory, AVSyncClockUnit &clockUnit);
+int32_t WriteFrameInfoToMemory(const AVTransSharedMemory &memory, uint32_t frameNum, int64_t timestamp);
+int32_t ReadFrameInfoFromMemory(const AVTransSharedMemory &memory, uint32_t &frameNum, int64_t &timestamp);
 int32_t ResetSharedMemory(const AVTransSharedMemory &memory);
 
 bool IsInValidSharedMemory(const AVTransSharedMemory &memory);
+bool IsInValidMappedMemory(const AVTransMappedMemory &mapped);
 bool IsInValidClockUnit(const AVSyncClockUnit &clockUnit);
 
 std::string MarshalSharedMemory(const AVTransSharedMemory &memory);
@@ -16,11 +16,15 @@
 #ifndef OHOS_AV_TRANSPORT_BUFFER_H
 #define OHOS_AV_TRANSPORT_BUFFER_H
 
+#include <array>
+#include <atomic>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 #include "av_trans_types.h"
+#include "single_instance.h"
 
 namespace OHOS {
 namespace DistributedHardware {
@@ -32,6 +36,56 @@ enum struct MetaType : uint32_t {
     VIDEO,
 };
 
+constexpr uint32_t BUFFER_POOL_SIZE_CLASS_NUM = 14;
+constexpr size_t BUFFER_POOL_MIN_BLOCK_SIZE = 1024;
+constexpr size_t BUFFER_POOL_MAX_BLOCK_SIZE = BUFFER_POOL_MIN_BLOCK_SIZE << (BUFFER_POOL_SIZE_CLASS_NUM - 1);
+constexpr uint32_t BUFFER_POOL_DEFAULT_BLOCKS_PER_CLASS = 16;
+constexpr size_t BUFFER_POOL_DEFAULT_MAX_CACHED_BYTES = 64 * 1024 * 1024;
+
+struct AVTransBufferPoolConfig {
+    uint32_t maxBlocksPerClass = BUFFER_POOL_DEFAULT_BLOCKS_PER_CLASS;
+    size_t maxCachedBytes = BUFFER_POOL_DEFAULT_MAX_CACHED_BYTES;
+};
+
+struct AVTransBufferPoolStats {
+    uint64_t hitCount = 0;
+    uint64_t missCount = 0;
+    uint64_t recycleCount = 0;
+    uint64_t dropCount = 0;
+    size_t cachedBytes = 0;
+};
+
+/**
+* @brief Size-classed payload pool shared by BufferData and the histreamer buffers.
+* Blocks are rounded up to a power of two, freed blocks are cached per size class until the caps are reached.
+*/
+class AVTransBufferPool {
+DECLARE_SINGLE_INSTANCE_BASE(AVTransBufferPool);
+public:
+    uint8_t *Alloc(size_t size);
+    void Free(uint8_t *ptr);
+    std::shared_ptr<uint8_t> Acquire(size_t size);
+    void SetConfig(const AVTransBufferPoolConfig &config);
+    AVTransBufferPoolStats GetStats();
+    void ResetStats();
+    void Clear();
+
+private:
+    AVTransBufferPool() = default;
+    ~AVTransBufferPool();
+    uint32_t GetSizeClass(size_t size);
+
+private:
+    std::mutex poolMtx_;
+    AVTransBufferPoolConfig config_;
+    std::array<std::vector<uint8_t *>, BUFFER_POOL_SIZE_CLASS_NUM> freeBlocks_ {};
+    size_t cachedBytes_ = 0;
+    std::atomic<uint64_t> hitCount_ = 0;
+    std::atomic<uint64_t> missCount_ = 0;
+    std::atomic<uint64_t> recycleCount_ = 0;
+    std::atomic<uint64_t> dropCount_ = 0;
+};
+
 /**
 * @brief BufferData description. Only manager the basic memory information.
 */
@@ -31,6 +31,7 @@ const int32_t SESSION_WAIT_SECONDS = 5;
 const int32_t INTERCERT_STRING_LENGTH = 20;
 const int32_t PLUGIN_RANK = 100;
 const int32_t PLUGIN_TASK_WAIT_TIME = 10;
+const int64_t PLUGIN_STATE_CHANGE_MAX_COST_MS = 100;
 
 const uint32_t VIDEO_H264_LEVEL = 32;
 const uint32_t MAX_DEVICE_ID_LEN = 100;
@@ -61,6 +62,7 @@ const std::string VDECODER_NAME = "builtin.player.videodecoder";
 
 const std::string AVT_DATA_META_TYPE = "avtrans_data_meta_type";
 const std::string AVT_DATA_PARAM = "avtrans_data_param";
+const std::string AVT_DATA_EXT_VERSION = "avtrans_data_ext_version";
 const std::string AV_TRANS_SPECIAL_DEVICE_ID = "av.trans.special.device.id";
 
 const std::string KEY_MY_DEV_ID = "myDevId";
@@ -74,13 +76,31 @@ const std::string KEY_GROUP_INFO_ARRAY = "groupInfoArray";
 const std::string KEY_SHARED_MEM_FD = "sharedMemoryFd";
 const std::string KEY_SHARED_MEM_SIZE = "sharedMemorySize";
 const std::string KEY_SHARED_MEM_NAME = "sharedMemoryName";
+const std::string KEY_BATCH_ENABLE = "enable";
+const std::string KEY_BATCH_MAX_DELAY = "maxDelayMs";
+const std::string KEY_BATCH_MAX_BYTES = "maxBytes";
+const std::string KEY_BATCH_SENT_FRAMES = "sentFrames";
+const std::string KEY_BATCH_SEND_CALLS = "sendCalls";
 
 const std::string SCREEN_FILE_NAME_BEFOREENCODING = "/data/data/dscreen/BeforeEncoding.h265";
 const std::string SCREEN_FILE_NAME_AFTERCODING = "/data/data/dscreen/AfterCoding.h265";
 
+const uint16_t AVT_EXT_HEADER_MAGIC = 0xA5E7;
+const uint8_t AVT_EXT_HEADER_VERSION_JSON = 0;
+const uint8_t AVT_EXT_HEADER_VERSION_BINARY = 1;
+const uint32_t AVT_EXT_HEADER_LEN = 32;
+const uint8_t AVT_EXT_HEADER_VERSION_BATCH = 2;
+const uint32_t AVT_BATCH_HEADER_LEN = 8;
+const uint32_t AVT_BATCH_FRAME_INFO_LEN = AVT_EXT_HEADER_LEN + sizeof(uint32_t);
+const uint32_t AVT_BATCH_MAX_FRAME_NUM = 32;
+// 0 merges only the frames already queued behind the first one, a batch never waits for more frames
+const int64_t SEND_BATCH_DEFAULT_DELAY_MS = 0;
+const uint32_t SEND_BATCH_DEFAULT_MAX_BYTES = 16 * 1024;
+
 const uint8_t DATA_WAIT_SECONDS = 1;
 const size_t DATA_QUEUE_MAX_SIZE = 1000;
 constexpr const char *SEND_CHANNEL_EVENT = "SendChannelEvent";
+constexpr const char *DELIVER_STREAM_DATA = "DeliverStream";
 } // namespace DistributedHardware
 } // namespace OHOS
 #endif // OHOS_AV_TRANSPORT_CONSTANTS_H
\ No newline at end of file
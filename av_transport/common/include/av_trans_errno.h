@@ -69,6 +69,8 @@ namespace DistributedHardware {
     constexpr int32_t ERR_DH_AVT_SHARED_MEMORY_FAILED = -80023;
     constexpr int32_t ERR_DH_AVT_MASTER_NOT_READY = -80024;
     constexpr int32_t ERR_DH_AVT_SESSION_HAS_OPENED = -80025;
+    constexpr int32_t ERR_DH_AVT_SHARED_RING_FULL = -80026;
+    constexpr int32_t ERR_DH_AVT_SHARED_RING_EMPTY = -80027;
 } // namespace DistributedHardware
 } // namespace OHOS
 #endif // OHOS_AV_TRANSPORT_ERRNO_H
\ No newline at end of file
@@ -16,6 +16,8 @@
 #ifndef OHOS_AV_TRANSPORT_EXTEND_META_H
 #define OHOS_AV_TRANSPORT_EXTEND_META_H
 
+#include <vector>
+
 #include "av_trans_types.h"
 
 // follwing head files depends on histreamer
@@ -73,6 +75,16 @@ public:
     std::string MarshalVideoMeta();
     bool UnmarshalVideoMeta(const std::string &jsonStr);
 
+    /**
+     * Fixed layout form of the video meta, used as the softbus stream ext once the peer
+     * has announced support for it. All fields are big endian:
+     * magic(2) version(1) headerLen(1) metaType(1) dataType(1) flags(2)
+     * pts(8) frameNum(4) extFrameNum(4) extPts(8)
+     */
+    bool MarshalVideoMetaBinary(uint8_t *buf, uint32_t len);
+    bool UnmarshalVideoMetaBinary(const uint8_t *buf, uint32_t len);
+    static bool IsBinaryVideoMeta(const uint8_t *buf, uint32_t len);
+
     int64_t pts_ {0};
 
     int64_t cts_ {0};
@@ -94,6 +106,35 @@ public:
 private:
     friend class Buffer;
 };
+
+/**
+ * @brief ext header of several small video frames coalesced into one softbus stream.
+ * Used once the peer has announced support for it, the payloads follow each other in the stream data
+ * in frame order. All fields are big endian:
+ * magic(2) version(1) headerLen(1) frameNum(2) reserved(2), then per frame the binary video meta
+ * followed by its payloadLen(4)
+ */
+class AVTransVideoBatchMeta {
+public:
+    AVTransVideoBatchMeta();
+    ~AVTransVideoBatchMeta() = default;
+
+    void Clear();
+    bool AddFrame(AVTransVideoBufferMeta &meta, uint32_t payloadLen);
+    bool GetFrame(uint32_t index, AVTransVideoBufferMeta &meta, uint32_t &payloadLen) const;
+    uint32_t GetFrameNum() const;
+    uint32_t GetPayloadLen() const;
+
+    /* The returned ext stays valid until the batch is changed */
+    const std::vector<uint8_t> &Marshal();
+    bool Unmarshal(const uint8_t *buf, uint32_t len);
+    static bool IsBatchVideoMeta(const uint8_t *buf, uint32_t len);
+
+private:
+    std::vector<uint8_t> ext_;
+    uint32_t frameNum_ = 0;
+    uint32_t payloadLen_ = 0;
+};
 } // namespace DistributedHardware
 } // namespace OHOS
 #endif // OHOS_AV_TRANSPORT_EXTEND_META_H
\ No newline at end of file
@@ -113,6 +113,9 @@ enum struct AVTransTag : uint32_t {
     STOP_AV_SYNC,
     TIME_SYNC_RESULT,
     SHARED_MEMORY_FD,
+    ADAPTIVE_LATENCY,
+    SEND_BATCHING,
+    OUTPUT_SHARED_RING,
 
     /* -------------------- d_audio tag -------------------- */
     AUDIO_CHANNELS = SECTION_D_AUDIO_START + 1,
@@ -150,6 +153,7 @@ enum struct EventType : uint32_t {
     EVENT_TIME_SYNC_RESULT = 10,
     EVENT_ADD_STREAM = 11,
     EVENT_REMOVE_STREAM = 12,
+    EVENT_OUTPUT_RING_DATA = 13,
 };
 
 struct AVTransEvent {
@@ -39,9 +39,30 @@ using AVBuffer = OHOS::Media::Plugin::Buffer;
 const int64_t NS_ONE_US = 1000;
 const int64_t NS_ONE_MS = 1000000;
 const int64_t NS_ONE_S = 1000000000;
+// user specific plugin tags owned by av transport, kept in the upper half of the histreamer user section
+constexpr uint32_t AVT_USER_TAG_BASE = static_cast<uint32_t>(Tag::SECTION_USER_SPECIFIC_START) + 0x8000;
+// get: json string of the windowed output statistics, set: reset the windows without stopping the stream
+constexpr Tag TAG_OUTPUT_STATISTICS = static_cast<Tag>(AVT_USER_TAG_BASE + 1);
+// json string {"enable", "minLatencyMs", "maxLatencyMs"}, get also returns the current "targetLatencyMs"
+constexpr Tag TAG_ADAPTIVE_LATENCY = static_cast<Tag>(AVT_USER_TAG_BASE + 2);
+// json string {"enable", "maxDelayMs", "maxBytes"}, get also returns the "sentFrames" and "sendCalls" counters.
+// maxDelayMs 0 (default) merges only frames that are already queued, a larger value waits that long for more
+constexpr Tag TAG_SEND_BATCHING = static_cast<Tag>(AVT_USER_TAG_BASE + 3);
 std::string TransName2PkgName(const std::string &ownerName);
 MediaType TransName2MediaType(const std::string &ownerName);
 
+/**
+* @brief Histreamer allocator backed by AVTransBufferPool, used by AVBuffer::AllocMemory on the data path.
+*/
+class AVTransPoolAllocator : public Plugin::Allocator {
+public:
+    AVTransPoolAllocator() = default;
+    ~AVTransPoolAllocator() override = default;
+    void *Alloc(size_t size) override;
+    void Free(void *ptr) override; // NOLINT: void*
+};
+std::shared_ptr<Plugin::Allocator> GetAVTransPoolAllocator();
+
 std::shared_ptr<AVBuffer> TransBuffer2HiSBuffer(const std::shared_ptr<AVTransBuffer> &transBuffer);
 std::shared_ptr<AVTransBuffer> HiSBuffer2TransBuffer(const std::shared_ptr<AVBuffer> &hisBuffer);
 void Convert2HiSBufferMeta(std::shared_ptr<AVTransBuffer> transBuffer, std::shared_ptr<AVBuffer> hisBuffer);
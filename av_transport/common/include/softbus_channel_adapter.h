@@ -16,9 +16,17 @@
 #ifndef OHOS_SOFTBUS_CHANNEL_ADAPTER
 #define OHOS_SOFTBUS_CHANNEL_ADAPTER
 
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <set>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
 #include "transport/socket.h"
 #include "transport/trans_type.h"
@@ -35,6 +43,70 @@ public:
     virtual ~ISoftbusChannelListener() = default;
     virtual void OnChannelEvent(const AVTransEvent &event) = 0;
     virtual void OnStreamReceived(const StreamData *data, const StreamData *ext) = 0;
+
+    /*
+     * Optional zero-copy receive. A listener returning an allocator gets the payload of each frame written
+     * straight into memory it owns, and the frame delivered through OnStreamPayloadReceived.
+     */
+    virtual std::function<std::shared_ptr<uint8_t>(uint32_t)> GetStreamPayloadAllocator()
+    {
+        return nullptr;
+    }
+
+    virtual void OnStreamPayloadReceived(std::shared_ptr<uint8_t> payload, uint32_t size, const StreamData *ext)
+    {
+        StreamData data = {reinterpret_cast<char *>(payload.get()), static_cast<int>(size)};
+        OnStreamReceived(&data, ext);
+    }
+};
+
+using StreamPayloadAllocator = std::function<std::shared_ptr<uint8_t>(uint32_t)>;
+
+struct SoftbusStreamStats {
+    uint64_t received = 0;
+    uint64_t delivered = 0;
+    uint64_t dropped = 0;
+};
+
+/**
+ * Copy the frames received on one data session and deliver them to its listener on a
+ * dedicated thread, so the softbus receive thread never waits for a slow consumer.
+ * When the consumer falls behind, the oldest queued frame is dropped and counted.
+ * The deliver thread keeps the dispatcher alive until it exits, Stop must be called to end it.
+ */
+class SoftbusStreamDispatcher : public std::enable_shared_from_this<SoftbusStreamDispatcher> {
+public:
+    SoftbusStreamDispatcher(const std::string &sessName, StreamPayloadAllocator allocator);
+    ~SoftbusStreamDispatcher();
+
+    void Start();
+    void Stop();
+    void PushFrame(const StreamData *data, const StreamData *ext);
+    SoftbusStreamStats GetStats() const;
+
+private:
+    struct StreamFrame {
+        std::vector<char> data;
+        std::vector<char> ext;
+        // listener owned payload, replaces data when the listener supplies an allocator
+        std::shared_ptr<uint8_t> payload;
+        uint32_t payloadSize = 0;
+    };
+    void DeliverLoop();
+
+private:
+    std::string sessName_;
+    StreamPayloadAllocator allocator_;
+    std::mutex frameMtx_;
+    std::condition_variable frameCond_;
+    std::deque<StreamFrame> frames_;
+    // delivered frames, kept to reuse their capacity
+    std::vector<StreamFrame> freeFrames_;
+    bool running_ = false;
+    std::thread deliverThread_;
+    std::atomic<uint64_t> received_ {0};
+    std::atomic<uint64_t> delivered_ {0};
+    std::atomic<uint64_t> dropped_ {0};
 };
 
 class SoftbusChannelAdapter {
@@ -69,6 +141,11 @@ public:
     void OnSoftbusTimeSyncResult(const TimeSyncResultInfo *info, int32_t result);
     void OnSoftbusStreamReceived(int32_t sessionId, const StreamData *data, const StreamData *ext,
         const StreamFrameInfo *frameInfo);
+    /* Called by the dispatcher thread of the session, without holding any adapter lock */
+    void DeliverStream(const std::string &sessName, const StreamData *data, const StreamData *ext);
+    void DeliverStreamPayload(const std::string &sessName, std::shared_ptr<uint8_t> payload, uint32_t size,
+        const StreamData *ext);
+    int32_t GetStreamStats(const std::string &sessName, const std::string &peerDevId, SoftbusStreamStats &stats);
 
 private:
     SoftbusChannelAdapter();
@@ -82,6 +159,24 @@ private:
     std::string FindSessNameByPeerSessName(const std::string peerSessionName);
     void SendEventChannelOPened(const std::string &mySessName, const std::string &peerDevId);
 
+    /* Maintain devId2SessIdMap_ together with its sessionId index, caller holds idMapMutex_ */
+    void InsertSessIdMapItem(const std::string &idMapKey, int32_t sessionId);
+    void EraseSessIdMapItem(const std::string &idMapKey);
+    std::vector<std::string> GetIdMapKeysBySessId(int32_t sessionId);
+    /* Publish a new sessionId -> stream dispatchers snapshot, caller holds idMapMutex_ */
+    void RefreshStreamTable();
+
+    /* Channel events are delivered by a fixed worker pool, in order for the same session */
+    void PostChannelEvent(const std::string &sessName, const AVTransEvent &event);
+    void ChannelEventWorker();
+    void StartEventWorkers();
+    void StopEventWorkers();
+
+    struct ChannelEventItem {
+        std::string sessName;
+        AVTransEvent event;
+    };
+
 private:
     std::mutex timeSyncMtx_;
     std::mutex idMapMutex_;
@@ -93,6 +188,23 @@ private:
     std::set<std::string> timeSyncSessNames_;
     std::map<std::string, int32_t> devId2SessIdMap_;
     std::map<std::string, ISoftbusChannelListener *> listenerMap_;
+    // sessionId -> keys of devId2SessIdMap_ ("sessName_peerDevId") holding it
+    std::unordered_map<int32_t, std::set<std::string>> sessId2IdMapKeys_;
+
+    std::mutex eventMtx_;
+    std::condition_variable eventCond_;
+    std::deque<ChannelEventItem> eventQueue_;
+    // sessions whose event is being delivered, their next event waits until it finishes
+    std::set<std::string> busySessNames_;
+    std::vector<std::thread> eventWorkers_;
+    bool eventWorkerRunning_ = false;
+
+    using StreamDispatcherTable = std::unordered_map<int32_t, std::vector<std::shared_ptr<SoftbusStreamDispatcher>>>;
+    std::mutex streamMtx_;
+    // data session listener key -> its dispatcher
+    std::map<std::string, std::shared_ptr<SoftbusStreamDispatcher>> streamDispatchers_;
+    // read lock free by OnSoftbusStreamReceived, replaced as a whole by RefreshStreamTable
+    std::shared_ptr<const StreamDispatcherTable> streamTable_;
 };
 } // namespace DistributedHardware
 } // namespace OHOS
@@ -15,6 +15,10 @@
 
 #include "av_sync_utils.h"
 
+#include <algorithm>
+#include <atomic>
+#include <ctime>
+#include <limits>
 #include <sys/mman.h>
 #include <securec.h>
 #include <unistd.h>
@@ -53,9 +57,11 @@ AVTransSharedMemory CreateAVTransSharedMemory(const std::string &name, size_t si
     uint8_t *base = reinterpret_cast<uint8_t*>(addr);
     if (memset_s(base, size, INVALID_VALUE_FALG, size) != EOK) {
         AVTRANS_LOGE("memset_s failed.");
+        (void)::munmap(addr, size);
         (void)::close(fd);
         return AVTransSharedMemory{0, 0, name};
     }
+    (void)::munmap(addr, size);
     uint64_t tmpsize = static_cast<uint64_t>(size);
     AVTRANS_LOGI("create av trans shared memory success, name=%{public}s, size=%{public}" PRIu64 ", fd=%{public}"
         PRId32, name.c_str(), tmpsize, fd);
@@ -75,190 +81,485 @@ void CloseAVTransSharedMemory(const AVTransSharedMemory &memory) noexcept
     }
 }
 
-int32_t WriteClockUnitToMemory(const AVTransSharedMemory &memory, AVSyncClockUnit &clockUnit)
+int32_t MapAVTransSharedMemory(const AVTransSharedMemory &memory, AVTransMappedMemory &mapped)
 {
-    AVTRANS_LOGI("write clock unit to shared memory, name=%{public}s, size=%{public}" PRId32 ", fd=%{public}" PRId32,
+    AVTRANS_LOGI("map shared memory, name=%{public}s, size=%{public}" PRId32 ", fd=%{public}" PRId32,
         memory.name.c_str(), memory.size, memory.fd);
+    UnmapAVTransSharedMemory(mapped);
     TRUE_RETURN_V_MSG_E(IsInValidSharedMemory(memory), ERR_DH_AVT_INVALID_PARAM, "invalid input shared memory");
 
-    AVTRANS_LOGI("clock unit index=%{public}" PRId32 ", frameNum=%{public}" PRId32 ", pts=%{public}lld",
-        clockUnit.index, clockUnit.frameNum, (long long)clockUnit.pts);
-    TRUE_RETURN_V_MSG_E(IsInValidClockUnit(clockUnit), ERR_DH_AVT_INVALID_PARAM, "invalid input clock unit");
-
     int size = AshmemGetSize(memory.fd);
     TRUE_RETURN_V_MSG_E(size != memory.size, ERR_DH_AVT_SHARED_MEMORY_FAILED, "invalid memory size = %{public}" PRId32,
         size);
 
-    unsigned int prot = PROT_WRITE;
-    int result = AshmemSetProt(memory.fd, static_cast<int>(prot));
-    TRUE_RETURN_V_MSG_E(result < 0, ERR_DH_AVT_SHARED_MEMORY_FAILED, "AshmemSetProt failed");
-
+    unsigned int prot = PROT_READ | PROT_WRITE;
     void *addr = ::mmap(nullptr, static_cast<size_t>(memory.size), static_cast<int>(prot), MAP_SHARED, memory.fd, 0);
     if (addr == MAP_FAILED) {
-        addr = nullptr;
         AVTRANS_LOGE("shared memory mmap failed, mmap address is invalid.");
         return ERR_DH_AVT_SHARED_MEMORY_FAILED;
     }
-
-    uint8_t *base = reinterpret_cast<uint8_t*>(addr);
-    size_t fOffset = (sizeof(uint32_t) + sizeof(int64_t)) * clockUnit.index;
-    size_t tOffset = fOffset + sizeof(uint32_t);
-    U64ToU8(base + tOffset, clockUnit.pts);
-    U32ToU8(base + fOffset, clockUnit.frameNum);
-
-    clockUnit.index ++;
-    if (clockUnit.index == MAX_CLOCK_UNIT_COUNT) {
-        clockUnit.index = 0;
-    }
-
-    AVTRANS_LOGI("write clock unit frameNum=%{public}" PRId32 ", pts=%{public}lld to shared memory success",
-        clockUnit.frameNum, (long long)(clockUnit.pts));
+    mapped.memory = memory;
+    mapped.base = reinterpret_cast<uint8_t*>(addr);
     return DH_AVT_SUCCESS;
 }
 
-int32_t ReadClockUnitFromMemory(const AVTransSharedMemory &memory, AVSyncClockUnit &clockUnit)
+void UnmapAVTransSharedMemory(AVTransMappedMemory &mapped) noexcept
 {
-    AVTRANS_LOGI("read clock unit from shared memory, name=%{public}s, size=%{public}" PRId32 ", fd=%{public}" PRId32,
-        memory.name.c_str(), memory.size, memory.fd);
-    TRUE_RETURN_V_MSG_E(IsInValidSharedMemory(memory), ERR_DH_AVT_INVALID_PARAM, "invalid input shared memory");
+    if (mapped.base != nullptr) {
+        AVTRANS_LOGI("unmap shared memory, name=%{public}s, size=%{public}" PRId32, mapped.memory.name.c_str(),
+            mapped.memory.size);
+        (void)::munmap(mapped.base, static_cast<size_t>(mapped.memory.size));
+    }
+    mapped.base = nullptr;
+    mapped.memory = AVTransSharedMemory{ 0, 0, "" };
+}
 
-    AVTRANS_LOGI("clock unit index=%{public}" PRId32 ", frameNum=%{public}" PRId32,
-        clockUnit.index, clockUnit.frameNum);
-    TRUE_RETURN_V_MSG_E((clockUnit.frameNum <= 0), ERR_DH_AVT_INVALID_PARAM, "invalid input frame number");
+static std::atomic<uint32_t> *GetSeqLock(uint8_t *base)
+{
+    return reinterpret_cast<std::atomic<uint32_t>*>(base);
+}
 
-    int size = AshmemGetSize(memory.fd);
-    TRUE_RETURN_V_MSG_E(size != memory.size, ERR_DH_AVT_SHARED_MEMORY_FAILED, "invalid memory size = %{public}" PRId32,
-        size);
+static uint32_t BeginSeqWrite(uint8_t *base)
+{
+    std::atomic<uint32_t> *seq = GetSeqLock(base);
+    uint32_t begin = seq->load(std::memory_order_relaxed);
+    seq->store(begin + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    return begin;
+}
 
-    unsigned int prot = PROT_WRITE;
-    int result = AshmemSetProt(memory.fd, static_cast<int>(prot));
-    TRUE_RETURN_V_MSG_E(result < 0, ERR_DH_AVT_SHARED_MEMORY_FAILED, "AshmemSetProt failed");
+static void EndSeqWrite(uint8_t *base, uint32_t begin)
+{
+    GetSeqLock(base)->store(begin + 2, std::memory_order_release);
+}
 
-    void *addr = ::mmap(nullptr, static_cast<size_t>(memory.size), static_cast<int>(prot), MAP_SHARED, memory.fd, 0);
-    if (addr == MAP_FAILED) {
-        addr = nullptr;
-        AVTRANS_LOGE("shared memory mmap failed, mmap address is invalid.");
-        return ERR_DH_AVT_SHARED_MEMORY_FAILED;
-    }
+static bool IsV1Layout(const AVTransMappedMemory &mapped)
+{
+    size_t size = static_cast<size_t>(mapped.memory.size);
+    return (size == AV_SYNC_V1_CLOCK_RING_MEM_SIZE) || (size == AV_SYNC_V1_FRAME_INFO_MEM_SIZE);
+}
 
-    uint8_t *base = reinterpret_cast<uint8_t*>(addr);
+static int32_t ReadClockUnitV1(const uint8_t *base, AVSyncClockUnit &clockUnit)
+{
     uint32_t firstUnit = U8ToU32(base);
     TRUE_RETURN_V_MSG_E(firstUnit == 0, ERR_DH_AVT_MASTER_NOT_READY, "master queue not ready, clock is null.");
-
-    uint32_t index = 0;
     int64_t latestPts = 0;
-    size_t unitSize = sizeof(uint32_t) + sizeof(int64_t);
-    while (index < MAX_CLOCK_UNIT_COUNT) {
-        uint32_t frameNum = U8ToU32(base + (index * unitSize));
-        int64_t pts = static_cast<int64_t>(U8ToU64(base + (index * unitSize) + sizeof(uint32_t)));
+    for (uint32_t index = 0; index < MAX_CLOCK_UNIT_COUNT; index++) {
+        const uint8_t *unit = base + AV_SYNC_CLOCK_UNIT_SIZE * index;
+        int64_t pts = static_cast<int64_t>(U8ToU64(unit + sizeof(uint32_t)));
         if (pts > latestPts) {
             latestPts = pts;
             clockUnit.pts = pts;
-            clockUnit.frameNum = frameNum;
+            clockUnit.frameNum = U8ToU32(unit);
         }
-        index++;
     }
-    AVTRANS_LOGI("read clock unit from shared memory success, frameNum=%{public}" PRId32 ", pts=%{public}lld",
-        clockUnit.frameNum, (long long)clockUnit.pts);
     return DH_AVT_SUCCESS;
 }
 
-int32_t WriteFrameInfoToMemory(const AVTransSharedMemory &memory, uint32_t frameNum, int64_t timestamp)
+int32_t WriteClockUnitToMemory(const AVTransMappedMemory &mapped, AVSyncClockUnit &clockUnit)
 {
-    AVTRANS_LOGI("write frame info to shared memory, name=%{public}s, size=%{public}" PRId32 ", fd=%{public}" PRId32,
-        memory.name.c_str(), memory.size, memory.fd);
-    TRUE_RETURN_V_MSG_E(IsInValidSharedMemory(memory), ERR_DH_AVT_INVALID_PARAM, "invalid input shared memory");
-
-    TRUE_RETURN_V_MSG_E((frameNum <= 0), ERR_DH_AVT_INVALID_PARAM, "invalid input frame number");
+    TRUE_RETURN_V_MSG_E(IsInValidMappedMemory(mapped), ERR_DH_AVT_INVALID_PARAM, "invalid mapped shared memory");
+    TRUE_RETURN_V_MSG_E(IsInValidClockUnit(clockUnit), ERR_DH_AVT_INVALID_PARAM, "invalid input clock unit");
+    if (static_cast<size_t>(mapped.memory.size) == AV_SYNC_V1_CLOCK_RING_MEM_SIZE) {
+        uint8_t *unit = mapped.base + AV_SYNC_CLOCK_UNIT_SIZE * clockUnit.index;
+        U64ToU8(unit + sizeof(uint32_t), clockUnit.pts);
+        U32ToU8(unit, clockUnit.frameNum);
+    } else {
+        TRUE_RETURN_V_MSG_E(static_cast<size_t>(mapped.memory.size) < AV_SYNC_CLOCK_RING_MEM_SIZE,
+            ERR_DH_AVT_SHARED_MEMORY_FAILED, "shared memory too small for clock ring");
+        uint8_t *unit = mapped.base + AV_SYNC_CLOCK_RING_HEADER_SIZE + AV_SYNC_CLOCK_UNIT_SIZE * clockUnit.index;
+        uint32_t begin = BeginSeqWrite(mapped.base);
+        U32ToU8(unit, clockUnit.frameNum);
+        U64ToU8(unit + sizeof(uint32_t), clockUnit.pts);
+        U32ToU8(mapped.base + AV_SYNC_SEQ_SIZE, clockUnit.index);
+        EndSeqWrite(mapped.base, begin);
+    }
 
-    int size = AshmemGetSize(memory.fd);
-    TRUE_RETURN_V_MSG_E(size != memory.size, ERR_DH_AVT_SHARED_MEMORY_FAILED, "invalid memory size = %{public}" PRId32,
-        size);
+    clockUnit.index ++;
+    if (clockUnit.index == MAX_CLOCK_UNIT_COUNT) {
+        clockUnit.index = 0;
+    }
+    AVTRANS_LOGD("write clock unit frameNum=%{public}" PRId32 ", pts=%{public}lld to shared memory success",
+        clockUnit.frameNum, (long long)(clockUnit.pts));
+    return DH_AVT_SUCCESS;
+}
 
-    unsigned int prot = PROT_WRITE;
-    int result = AshmemSetProt(memory.fd, static_cast<int>(prot));
-    TRUE_RETURN_V_MSG_E(result < 0, ERR_DH_AVT_SHARED_MEMORY_FAILED, "AshmemSetProt failed");
+int32_t ReadClockUnitFromMemory(const AVTransMappedMemory &mapped, AVSyncClockUnit &clockUnit)
+{
+    TRUE_RETURN_V_MSG_E(IsInValidMappedMemory(mapped), ERR_DH_AVT_INVALID_PARAM, "invalid mapped shared memory");
+    TRUE_RETURN_V_MSG_E((clockUnit.frameNum <= 0), ERR_DH_AVT_INVALID_PARAM, "invalid input frame number");
+    if (static_cast<size_t>(mapped.memory.size) == AV_SYNC_V1_CLOCK_RING_MEM_SIZE) {
+        return ReadClockUnitV1(mapped.base, clockUnit);
+    }
+    TRUE_RETURN_V_MSG_E(static_cast<size_t>(mapped.memory.size) < AV_SYNC_CLOCK_RING_MEM_SIZE,
+        ERR_DH_AVT_SHARED_MEMORY_FAILED, "shared memory too small for clock ring");
+
+    std::atomic<uint32_t> *seq = GetSeqLock(mapped.base);
+    for (uint32_t retry = 0; retry < MAX_SEQLOCK_READ_RETRY; retry++) {
+        uint32_t begin = seq->load(std::memory_order_acquire);
+        TRUE_RETURN_V_MSG_E(begin == 0, ERR_DH_AVT_MASTER_NOT_READY, "master queue not ready, clock is null.");
+        if ((begin & 1) != 0) {
+            continue;
+        }
+        uint32_t latest = U8ToU32(mapped.base + AV_SYNC_SEQ_SIZE);
+        if (latest >= MAX_CLOCK_UNIT_COUNT) {
+            continue;
+        }
+        const uint8_t *unit = mapped.base + AV_SYNC_CLOCK_RING_HEADER_SIZE + AV_SYNC_CLOCK_UNIT_SIZE * latest;
+        uint32_t frameNum = U8ToU32(unit);
+        int64_t pts = static_cast<int64_t>(U8ToU64(unit + sizeof(uint32_t)));
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (seq->load(std::memory_order_relaxed) == begin) {
+            TRUE_RETURN_V_MSG_E(pts <= 0, ERR_DH_AVT_MASTER_NOT_READY, "master queue not ready, clock is reset.");
+            clockUnit.frameNum = frameNum;
+            clockUnit.pts = pts;
+            AVTRANS_LOGD("read clock unit from shared memory success, frameNum=%{public}" PRId32
+                ", pts=%{public}lld", clockUnit.frameNum, (long long)clockUnit.pts);
+            return DH_AVT_SUCCESS;
+        }
+    }
+    AVTRANS_LOGE("read clock unit from shared memory failed, writer keeps updating.");
+    return ERR_DH_AVT_SHARED_MEMORY_FAILED;
+}
 
-    void *addr = ::mmap(nullptr, static_cast<size_t>(memory.size), static_cast<int>(prot), MAP_SHARED, memory.fd, 0);
-    if (addr == MAP_FAILED) {
-        addr = nullptr;
-        AVTRANS_LOGE("shared memory mmap failed, mmap address is invalid.");
-        return ERR_DH_AVT_SHARED_MEMORY_FAILED;
+int32_t WriteFrameInfoToMemory(const AVTransMappedMemory &mapped, uint32_t frameNum, int64_t timestamp)
+{
+    TRUE_RETURN_V_MSG_E(IsInValidMappedMemory(mapped), ERR_DH_AVT_INVALID_PARAM, "invalid mapped shared memory");
+    TRUE_RETURN_V_MSG_E((frameNum <= 0), ERR_DH_AVT_INVALID_PARAM, "invalid input frame number");
+    if (static_cast<size_t>(mapped.memory.size) == AV_SYNC_V1_FRAME_INFO_MEM_SIZE) {
+        U32ToU8(mapped.base, frameNum);
+        U64ToU8(mapped.base + sizeof(uint32_t), timestamp);
+        return DH_AVT_SUCCESS;
     }
+    TRUE_RETURN_V_MSG_E(static_cast<size_t>(mapped.memory.size) < AV_SYNC_FRAME_INFO_MEM_SIZE,
+        ERR_DH_AVT_SHARED_MEMORY_FAILED, "shared memory too small for frame info");
 
-    uint8_t *base = reinterpret_cast<uint8_t*>(addr);
-    U32ToU8(base, frameNum);
-    U64ToU8(base + sizeof(uint32_t), timestamp);
+    uint8_t *info = mapped.base + AV_SYNC_SEQ_SIZE;
+    uint32_t begin = BeginSeqWrite(mapped.base);
+    U32ToU8(info, frameNum);
+    U64ToU8(info + sizeof(uint32_t), timestamp);
+    EndSeqWrite(mapped.base, begin);
 
-    AVTRANS_LOGI("write frameNum=%{public}" PRId32 ", timestamp=%{public}lld to shared memory success",
+    AVTRANS_LOGD("write frameNum=%{public}" PRId32 ", timestamp=%{public}lld to shared memory success",
         frameNum, (long long)timestamp);
     return DH_AVT_SUCCESS;
 }
 
-int32_t ReadFrameInfoFromMemory(const AVTransSharedMemory &memory, uint32_t &frameNum, int64_t &timestamp)
+int32_t ReadFrameInfoFromMemory(const AVTransMappedMemory &mapped, uint32_t &frameNum, int64_t &timestamp)
 {
-    AVTRANS_LOGI("read frame info from shared memory, name=%{public}s, size=%{public}" PRId32 ", fd=%{public}" PRId32,
-        memory.name.c_str(), memory.size, memory.fd);
-    TRUE_RETURN_V_MSG_E(IsInValidSharedMemory(memory), ERR_DH_AVT_INVALID_PARAM, "invalid input shared memory");
+    TRUE_RETURN_V_MSG_E(IsInValidMappedMemory(mapped), ERR_DH_AVT_INVALID_PARAM, "invalid mapped shared memory");
+    if (static_cast<size_t>(mapped.memory.size) == AV_SYNC_V1_FRAME_INFO_MEM_SIZE) {
+        frameNum = U8ToU32(mapped.base);
+        timestamp = static_cast<int64_t>(U8ToU64(mapped.base + sizeof(uint32_t)));
+        TRUE_RETURN_V_MSG_E(frameNum <= 0, ERR_DH_AVT_MASTER_NOT_READY, "master queue not ready, frameNum is null.");
+        return DH_AVT_SUCCESS;
+    }
+    TRUE_RETURN_V_MSG_E(static_cast<size_t>(mapped.memory.size) < AV_SYNC_FRAME_INFO_MEM_SIZE,
+        ERR_DH_AVT_SHARED_MEMORY_FAILED, "shared memory too small for frame info");
+
+    std::atomic<uint32_t> *seq = GetSeqLock(mapped.base);
+    const uint8_t *info = mapped.base + AV_SYNC_SEQ_SIZE;
+    for (uint32_t retry = 0; retry < MAX_SEQLOCK_READ_RETRY; retry++) {
+        uint32_t begin = seq->load(std::memory_order_acquire);
+        if ((begin & 1) != 0) {
+            continue;
+        }
+        uint32_t readFrameNum = U8ToU32(info);
+        int64_t readTimestamp = static_cast<int64_t>(U8ToU64(info + sizeof(uint32_t)));
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (seq->load(std::memory_order_relaxed) != begin) {
+            continue;
+        }
+        frameNum = readFrameNum;
+        timestamp = readTimestamp;
+        TRUE_RETURN_V_MSG_E(frameNum <= 0, ERR_DH_AVT_MASTER_NOT_READY, "master queue not ready, frameNum is null.");
+        AVTRANS_LOGD("read frameNum=%{public}" PRId32 ", timestamp=%{public}lld from shared memory success.",
+            frameNum, (long long)timestamp);
+        return DH_AVT_SUCCESS;
+    }
+    AVTRANS_LOGE("read frame info from shared memory failed, writer keeps updating.");
+    return ERR_DH_AVT_SHARED_MEMORY_FAILED;
+}
 
-    int size = AshmemGetSize(memory.fd);
-    TRUE_RETURN_V_MSG_E(size != memory.size, ERR_DH_AVT_SHARED_MEMORY_FAILED, "invalid memory size = %{public}" PRId32,
-        size);
+namespace {
+constexpr size_t FRAME_RING_SLOT_NUM_OFFSET = 0;
+constexpr size_t FRAME_RING_SLOT_SIZE_OFFSET = FRAME_RING_SLOT_NUM_OFFSET + sizeof(uint32_t);
+constexpr size_t FRAME_RING_WRITE_INDEX_OFFSET = FRAME_RING_SLOT_SIZE_OFFSET + sizeof(uint32_t);
+constexpr size_t FRAME_RING_READ_INDEX_OFFSET = FRAME_RING_WRITE_INDEX_OFFSET + sizeof(uint64_t);
+constexpr size_t FRAME_RING_OVERFLOW_OFFSET = FRAME_RING_READ_INDEX_OFFSET + sizeof(uint64_t);
+constexpr size_t FRAME_RING_LATENCY_SUM_OFFSET = FRAME_RING_OVERFLOW_OFFSET + sizeof(uint64_t);
+constexpr size_t FRAME_RING_LATENCY_MAX_OFFSET = FRAME_RING_LATENCY_SUM_OFFSET + sizeof(uint64_t);
+constexpr size_t FRAME_RING_ALIGN_SIZE = sizeof(uint64_t);
+constexpr int64_t NS_PER_SECOND = 1000000000;
+}
 
-    unsigned int prot = PROT_WRITE;
-    int result = AshmemSetProt(memory.fd, static_cast<int>(prot));
-    TRUE_RETURN_V_MSG_E(result < 0, ERR_DH_AVT_SHARED_MEMORY_FAILED, "AshmemSetProt failed");
+static std::atomic<uint64_t> *GetRingCounter(uint8_t *base, size_t offset)
+{
+    return reinterpret_cast<std::atomic<uint64_t>*>(base + offset);
+}
 
-    void *addr = ::mmap(nullptr, static_cast<size_t>(memory.size), static_cast<int>(prot), MAP_SHARED, memory.fd, 0);
-    if (addr == MAP_FAILED) {
-        addr = nullptr;
-        AVTRANS_LOGE("shared memory mmap failed, mmap address is invalid.");
+static size_t GetFrameRingSlotStride(uint32_t slotSize)
+{
+    size_t alignedSize = (static_cast<size_t>(slotSize) + FRAME_RING_ALIGN_SIZE - 1) & ~(FRAME_RING_ALIGN_SIZE - 1);
+    return AV_FRAME_RING_SLOT_HEADER_SIZE + alignedSize;
+}
+
+static int64_t GetMonotonicTimeNs()
+{
+    struct timespec time = { 0, 0 };
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return static_cast<int64_t>(time.tv_sec) * NS_PER_SECOND + time.tv_nsec;
+}
+
+size_t GetFrameRingMemSize(uint32_t slotNum, uint32_t slotSize)
+{
+    if ((slotNum == 0) || (slotNum > MAX_FRAME_RING_SLOT_NUM) || (slotSize == 0) ||
+        (slotSize > MAX_FRAME_RING_SLOT_SIZE)) {
+        return 0;
+    }
+    size_t memSize = AV_FRAME_RING_HEADER_SIZE + GetFrameRingSlotStride(slotSize) * slotNum;
+    return (memSize > static_cast<size_t>(std::numeric_limits<int32_t>::max())) ? 0 : memSize;
+}
+
+int32_t InitFrameRingMemory(const AVTransMappedMemory &mapped, uint32_t slotNum, uint32_t slotSize)
+{
+    TRUE_RETURN_V_MSG_E(IsInValidMappedMemory(mapped), ERR_DH_AVT_INVALID_PARAM, "invalid mapped shared memory");
+    size_t memSize = GetFrameRingMemSize(slotNum, slotSize);
+    TRUE_RETURN_V_MSG_E((memSize == 0) || (static_cast<size_t>(mapped.memory.size) < memSize),
+        ERR_DH_AVT_SHARED_MEMORY_FAILED, "shared memory too small for frame ring");
+
+    if (memset_s(mapped.base, AV_FRAME_RING_HEADER_SIZE, INVALID_VALUE_FALG, AV_FRAME_RING_HEADER_SIZE) != EOK) {
+        AVTRANS_LOGE("memset_s failed.");
         return ERR_DH_AVT_SHARED_MEMORY_FAILED;
     }
+    U32ToU8(mapped.base + FRAME_RING_SLOT_NUM_OFFSET, slotNum);
+    U32ToU8(mapped.base + FRAME_RING_SLOT_SIZE_OFFSET, slotSize);
+    std::atomic_thread_fence(std::memory_order_release);
+    AVTRANS_LOGI("init frame ring success, slotNum=%{public}" PRIu32 ", slotSize=%{public}" PRIu32, slotNum,
+        slotSize);
+    return DH_AVT_SUCCESS;
+}
 
-    uint8_t *base = reinterpret_cast<uint8_t*>(addr);
-    frameNum = U8ToU32(base);
-    timestamp = static_cast<int64_t>(U8ToU64(base + sizeof(uint32_t)));
-    TRUE_RETURN_V_MSG_E(frameNum <= 0, ERR_DH_AVT_MASTER_NOT_READY, "master queue not ready, frameNum is null.");
+int32_t CheckFrameRingMemory(const AVTransMappedMemory &mapped)
+{
+    AVFrameRingGeometry geometry;
+    return CheckFrameRingMemory(mapped, geometry);
+}
 
-    AVTRANS_LOGI("read frameNum=%{public}" PRId32 ", timestamp=%{public}lld from shared memory success.", frameNum,
-        (long long)timestamp);
+int32_t CheckFrameRingMemory(const AVTransMappedMemory &mapped, AVFrameRingGeometry &geometry)
+{
+    TRUE_RETURN_V_MSG_E(IsInValidMappedMemory(mapped), ERR_DH_AVT_INVALID_PARAM, "invalid mapped shared memory");
+    TRUE_RETURN_V_MSG_E(static_cast<size_t>(mapped.memory.size) < AV_FRAME_RING_HEADER_SIZE,
+        ERR_DH_AVT_SHARED_MEMORY_FAILED, "shared memory too small for frame ring header");
+    std::atomic_thread_fence(std::memory_order_acquire);
+    uint32_t slotNum = U8ToU32(mapped.base + FRAME_RING_SLOT_NUM_OFFSET);
+    uint32_t slotSize = U8ToU32(mapped.base + FRAME_RING_SLOT_SIZE_OFFSET);
+    size_t memSize = GetFrameRingMemSize(slotNum, slotSize);
+    TRUE_RETURN_V_MSG_E((memSize == 0) || (static_cast<size_t>(mapped.memory.size) < memSize),
+        ERR_DH_AVT_SHARED_MEMORY_FAILED, "invalid frame ring, slotNum=%{public}" PRIu32 ", slotSize=%{public}"
+        PRIu32, slotNum, slotSize);
+    geometry.slotNum = slotNum;
+    geometry.slotSize = slotSize;
     return DH_AVT_SUCCESS;
 }
 
-int32_t ResetSharedMemory(const AVTransSharedMemory &memory)
+int32_t WriteFrameToRing(const AVTransMappedMemory &mapped, const AVFrameRingGeometry &geometry,
+    AVFrameRingInfo &info, const uint8_t *data, bool &isNotify)
 {
-    AVTRANS_LOGI("reset shared memory, name=%{public}s, size=%{public}" PRId32 ", fd=%{public}" PRId32,
-        memory.name.c_str(), memory.size, memory.fd);
-    TRUE_RETURN_V_MSG_E(IsInValidSharedMemory(memory), ERR_DH_AVT_INVALID_PARAM, "invalid input shared memory");
+    isNotify = false;
+    TRUE_RETURN_V_MSG_E(data == nullptr, ERR_DH_AVT_INVALID_PARAM, "input frame data is nullptr");
+    TRUE_RETURN_V_MSG_E(IsInValidMappedMemory(mapped), ERR_DH_AVT_INVALID_PARAM, "invalid mapped shared memory");
+    // the reader can rewrite the shared header at any time, so only the geometry checked before is used
+    uint32_t slotNum = geometry.slotNum;
+    uint32_t slotSize = geometry.slotSize;
+    size_t memSize = GetFrameRingMemSize(slotNum, slotSize);
+    TRUE_RETURN_V_MSG_E((memSize == 0) || (static_cast<size_t>(mapped.memory.size) < memSize),
+        ERR_DH_AVT_INVALID_PARAM, "invalid frame ring geometry");
+    TRUE_RETURN_V_MSG_E(info.dataSize > slotSize, ERR_DH_AVT_INVALID_PARAM, "frame size=%{public}" PRIu32
+        " exceeds slot size=%{public}" PRIu32, info.dataSize, slotSize);
+
+    std::atomic<uint64_t> *writeIndex = GetRingCounter(mapped.base, FRAME_RING_WRITE_INDEX_OFFSET);
+    std::atomic<uint64_t> *readIndex = GetRingCounter(mapped.base, FRAME_RING_READ_INDEX_OFFSET);
+    uint64_t writePos = writeIndex->load(std::memory_order_relaxed);
+    uint64_t readPos = readIndex->load(std::memory_order_acquire);
+    TRUE_RETURN_V_MSG_E(readPos > writePos, ERR_DH_AVT_SHARED_MEMORY_FAILED, "read index %{public}" PRIu64
+        " is ahead of write index %{public}" PRIu64, readPos, writePos);
+    if (writePos - readPos >= slotNum) {
+        GetRingCounter(mapped.base, FRAME_RING_OVERFLOW_OFFSET)->fetch_add(1, std::memory_order_relaxed);
+        return ERR_DH_AVT_SHARED_RING_FULL;
+    }
 
-    int size = AshmemGetSize(memory.fd);
-    TRUE_RETURN_V_MSG_E(size != memory.size, ERR_DH_AVT_SHARED_MEMORY_FAILED, "invalid memory size = %{public}" PRId32,
-        size);
+    uint8_t *slot = mapped.base + AV_FRAME_RING_HEADER_SIZE + GetFrameRingSlotStride(slotSize) * (writePos % slotNum);
+    info.writeTimeNs = GetMonotonicTimeNs();
+    uint32_t fields[] = { info.dataSize, info.metaType, info.dataType, info.format, info.width, info.height,
+        info.sampleRate, 0 };
+    size_t offset = 0;
+    for (uint32_t field : fields) {
+        U32ToU8(slot + offset, field);
+        offset += sizeof(uint32_t);
+    }
+    U64ToU8(slot + offset, static_cast<uint64_t>(info.pts));
+    U64ToU8(slot + offset + sizeof(int64_t), static_cast<uint64_t>(info.writeTimeNs));
+    if ((info.dataSize > 0) &&
+        (memcpy_s(slot + AV_FRAME_RING_SLOT_HEADER_SIZE, slotSize, data, info.dataSize) != EOK)) {
+        AVTRANS_LOGE("memcpy_s failed.");
+        return ERR_DH_AVT_SHARED_MEMORY_FAILED;
+    }
 
-    unsigned int prot = PROT_WRITE;
-    int result = AshmemSetProt(memory.fd, static_cast<int>(prot));
-    TRUE_RETURN_V_MSG_E(result < 0, ERR_DH_AVT_SHARED_MEMORY_FAILED, "AshmemSetProt failed");
+    // publish the slot, then check whether the reader had already drained everything before it
+    writeIndex->store(writePos + 1, std::memory_order_seq_cst);
+    isNotify = (readIndex->load(std::memory_order_seq_cst) == writePos);
+    return DH_AVT_SUCCESS;
+}
 
-    void *addr = ::mmap(nullptr, static_cast<size_t>(memory.size), static_cast<int>(prot), MAP_SHARED, memory.fd, 0);
-    if (addr == MAP_FAILED) {
-        addr = nullptr;
-        AVTRANS_LOGE("shared memory mmap failed, mmap address is invalid.");
+int32_t ReadFrameFromRing(const AVTransMappedMemory &mapped, AVFrameRingInfo &info, uint8_t *data,
+    uint32_t dataLen)
+{
+    TRUE_RETURN_V_MSG_E(data == nullptr, ERR_DH_AVT_INVALID_PARAM, "input data buffer is nullptr");
+    int32_t ret = CheckFrameRingMemory(mapped);
+    TRUE_RETURN_V(ret != DH_AVT_SUCCESS, ret);
+    uint32_t slotNum = U8ToU32(mapped.base + FRAME_RING_SLOT_NUM_OFFSET);
+    uint32_t slotSize = U8ToU32(mapped.base + FRAME_RING_SLOT_SIZE_OFFSET);
+
+    std::atomic<uint64_t> *writeIndex = GetRingCounter(mapped.base, FRAME_RING_WRITE_INDEX_OFFSET);
+    std::atomic<uint64_t> *readIndex = GetRingCounter(mapped.base, FRAME_RING_READ_INDEX_OFFSET);
+    uint64_t readPos = readIndex->load(std::memory_order_relaxed);
+    if (readPos == writeIndex->load(std::memory_order_acquire)) {
+        return ERR_DH_AVT_SHARED_RING_EMPTY;
+    }
+
+    const uint8_t *slot = mapped.base + AV_FRAME_RING_HEADER_SIZE +
+        GetFrameRingSlotStride(slotSize) * (readPos % slotNum);
+    uint32_t reserved = 0;
+    uint32_t *fields[] = { &info.dataSize, &info.metaType, &info.dataType, &info.format, &info.width, &info.height,
+        &info.sampleRate, &reserved };
+    size_t offset = 0;
+    for (uint32_t *field : fields) {
+        *field = U8ToU32(slot + offset);
+        offset += sizeof(uint32_t);
+    }
+    info.pts = static_cast<int64_t>(U8ToU64(slot + offset));
+    info.writeTimeNs = static_cast<int64_t>(U8ToU64(slot + offset + sizeof(int64_t)));
+    TRUE_RETURN_V_MSG_E(info.dataSize > slotSize, ERR_DH_AVT_SHARED_MEMORY_FAILED, "invalid frame size");
+    TRUE_RETURN_V_MSG_E(info.dataSize > dataLen, ERR_DH_AVT_INVALID_PARAM, "data buffer too small, need "
+        "%{public}" PRIu32, info.dataSize);
+    if ((info.dataSize > 0) &&
+        (memcpy_s(data, dataLen, slot + AV_FRAME_RING_SLOT_HEADER_SIZE, info.dataSize) != EOK)) {
+        AVTRANS_LOGE("memcpy_s failed.");
         return ERR_DH_AVT_SHARED_MEMORY_FAILED;
     }
-    if (memset_s(reinterpret_cast<uint8_t*>(addr), size, INVALID_VALUE_FALG, size) != EOK) {
+
+    // only the reader updates the latency statistics
+    uint64_t latency = static_cast<uint64_t>(std::max<int64_t>(GetMonotonicTimeNs() - info.writeTimeNs, 0));
+    std::atomic<uint64_t> *latencySum = GetRingCounter(mapped.base, FRAME_RING_LATENCY_SUM_OFFSET);
+    std::atomic<uint64_t> *latencyMax = GetRingCounter(mapped.base, FRAME_RING_LATENCY_MAX_OFFSET);
+    latencySum->store(latencySum->load(std::memory_order_relaxed) + latency, std::memory_order_relaxed);
+    if (latency > latencyMax->load(std::memory_order_relaxed)) {
+        latencyMax->store(latency, std::memory_order_relaxed);
+    }
+    readIndex->store(readPos + 1, std::memory_order_seq_cst);
+    return DH_AVT_SUCCESS;
+}
+
+int32_t GetFrameRingStatistics(const AVTransMappedMemory &mapped, AVFrameRingStatistics &stats)
+{
+    int32_t ret = CheckFrameRingMemory(mapped);
+    TRUE_RETURN_V(ret != DH_AVT_SUCCESS, ret);
+    stats.writeCount = GetRingCounter(mapped.base, FRAME_RING_WRITE_INDEX_OFFSET)->load();
+    stats.readCount = GetRingCounter(mapped.base, FRAME_RING_READ_INDEX_OFFSET)->load();
+    stats.overflowCount = GetRingCounter(mapped.base, FRAME_RING_OVERFLOW_OFFSET)->load();
+    uint64_t latencySum = GetRingCounter(mapped.base, FRAME_RING_LATENCY_SUM_OFFSET)->load();
+    stats.avgLatencyNs = (stats.readCount == 0) ? 0 : static_cast<int64_t>(latencySum / stats.readCount);
+    stats.maxLatencyNs = static_cast<int64_t>(GetRingCounter(mapped.base, FRAME_RING_LATENCY_MAX_OFFSET)->load());
+    return DH_AVT_SUCCESS;
+}
+
+int32_t ResetSharedMemory(const AVTransMappedMemory &mapped)
+{
+    AVTRANS_LOGI("reset shared memory, name=%{public}s, size=%{public}" PRId32, mapped.memory.name.c_str(),
+        mapped.memory.size);
+    TRUE_RETURN_V_MSG_E(IsInValidMappedMemory(mapped), ERR_DH_AVT_INVALID_PARAM, "invalid mapped shared memory");
+
+    size_t size = static_cast<size_t>(mapped.memory.size);
+    if (IsV1Layout(mapped)) {
+        TRUE_RETURN_V_MSG_E(memset_s(mapped.base, size, INVALID_VALUE_FALG, size) != EOK,
+            ERR_DH_AVT_SHARED_MEMORY_FAILED, "memset_s failed.");
+        AVTRANS_LOGI("reset shared memory success.");
+        return DH_AVT_SUCCESS;
+    }
+    uint32_t begin = BeginSeqWrite(mapped.base);
+    if (memset_s(mapped.base + AV_SYNC_SEQ_SIZE, size - AV_SYNC_SEQ_SIZE, INVALID_VALUE_FALG,
+        size - AV_SYNC_SEQ_SIZE) != EOK) {
         AVTRANS_LOGE("memset_s failed.");
+        EndSeqWrite(mapped.base, begin);
         return ERR_DH_AVT_SHARED_MEMORY_FAILED;
     }
+    EndSeqWrite(mapped.base, begin);
     AVTRANS_LOGI("reset shared memory success.");
     return DH_AVT_SUCCESS;
 }
 
+int32_t WriteClockUnitToMemory(const AVTransSharedMemory &memory, AVSyncClockUnit &clockUnit)
+{
+    AVTransMappedMemory mapped;
+    int32_t ret = MapAVTransSharedMemory(memory, mapped);
+    TRUE_RETURN_V(ret != DH_AVT_SUCCESS, ret);
+    ret = WriteClockUnitToMemory(mapped, clockUnit);
+    UnmapAVTransSharedMemory(mapped);
+    return ret;
+}
+
+int32_t ReadClockUnitFromMemory(const AVTransSharedMemory &memory, AVSyncClockUnit &clockUnit)
+{
+    AVTransMappedMemory mapped;
+    int32_t ret = MapAVTransSharedMemory(memory, mapped);
+    TRUE_RETURN_V(ret != DH_AVT_SUCCESS, ret);
+    ret = ReadClockUnitFromMemory(mapped, clockUnit);
+    UnmapAVTransSharedMemory(mapped);
+    return ret;
+}
+
+int32_t WriteFrameInfoToMemory(const AVTransSharedMemory &memory, uint32_t frameNum, int64_t timestamp)
+{
+    AVTransMappedMemory mapped;
+    int32_t ret = MapAVTransSharedMemory(memory, mapped);
+    TRUE_RETURN_V(ret != DH_AVT_SUCCESS, ret);
+    ret = WriteFrameInfoToMemory(mapped, frameNum, timestamp);
+    UnmapAVTransSharedMemory(mapped);
+    return ret;
+}
+
+int32_t ReadFrameInfoFromMemory(const AVTransSharedMemory &memory, uint32_t &frameNum, int64_t &timestamp)
+{
+    AVTransMappedMemory mapped;
+    int32_t ret = MapAVTransSharedMemory(memory, mapped);
+    TRUE_RETURN_V(ret != DH_AVT_SUCCESS, ret);
+    ret = ReadFrameInfoFromMemory(mapped, frameNum, timestamp);
+    UnmapAVTransSharedMemory(mapped);
+    return ret;
+}
+
+int32_t ResetSharedMemory(const AVTransSharedMemory &memory)
+{
+    AVTransMappedMemory mapped;
+    int32_t ret = MapAVTransSharedMemory(memory, mapped);
+    TRUE_RETURN_V(ret != DH_AVT_SUCCESS, ret);
+    ret = ResetSharedMemory(mapped);
+    UnmapAVTransSharedMemory(mapped);
+    return ret;
+}
+
 bool IsInValidSharedMemory(const AVTransSharedMemory &memory)
 {
     return (memory.fd <= 0) || (memory.size <= 0) || memory.name.empty();
 }
 
+bool IsInValidMappedMemory(const AVTransMappedMemory &mapped)
+{
+    return (mapped.base == nullptr) || IsInValidSharedMemory(mapped.memory) ||
+        (static_cast<size_t>(mapped.memory.size) < AV_SYNC_SEQ_SIZE);
+}
+
 bool IsInValidClockUnit(const AVSyncClockUnit &clockUnit)
 {
     return (clockUnit.index < 0) || (clockUnit.index >= MAX_CLOCK_UNIT_COUNT) || (clockUnit.frameNum <= 0)
@@ -22,6 +22,147 @@
 namespace OHOS {
 namespace DistributedHardware {
 static const uint32_t BUFFER_MAX_CAPACITY = 104857600;
+static const uint32_t BUFFER_POOL_BLOCK_MAGIC = 0x4156504C;
+
+struct AVTransBufferPoolHeader {
+    uint32_t magic;
+    uint32_t sizeClass;
+    uint64_t reserved;
+};
+static constexpr size_t BUFFER_POOL_HEADER_SIZE = sizeof(AVTransBufferPoolHeader);
+
+IMPLEMENT_SINGLE_INSTANCE(AVTransBufferPool);
+
+AVTransBufferPool::~AVTransBufferPool()
+{
+    Clear();
+}
+
+uint32_t AVTransBufferPool::GetSizeClass(size_t size)
+{
+    uint32_t sizeClass = 0;
+    size_t blockSize = BUFFER_POOL_MIN_BLOCK_SIZE;
+    while ((blockSize < size) && (sizeClass < BUFFER_POOL_SIZE_CLASS_NUM)) {
+        blockSize <<= 1;
+        sizeClass++;
+    }
+    return sizeClass;
+}
+
+uint8_t *AVTransBufferPool::Alloc(size_t size)
+{
+    if (size > BUFFER_MAX_CAPACITY) {
+        AVTRANS_LOGE("buffer pool alloc size is over size.");
+        return nullptr;
+    }
+    uint32_t sizeClass = GetSizeClass(size);
+    if (sizeClass < BUFFER_POOL_SIZE_CLASS_NUM) {
+        std::lock_guard<std::mutex> lock(poolMtx_);
+        auto &blocks = freeBlocks_[sizeClass];
+        if (!blocks.empty()) {
+            uint8_t *block = blocks.back();
+            blocks.pop_back();
+            cachedBytes_ -= (BUFFER_POOL_MIN_BLOCK_SIZE << sizeClass);
+            hitCount_++;
+            return block + BUFFER_POOL_HEADER_SIZE;
+        }
+    }
+    missCount_++;
+    size_t blockSize = (sizeClass < BUFFER_POOL_SIZE_CLASS_NUM) ? (BUFFER_POOL_MIN_BLOCK_SIZE << sizeClass) : size;
+    uint8_t *block = new (std::nothrow) uint8_t[blockSize + BUFFER_POOL_HEADER_SIZE];
+    if (block == nullptr) {
+        AVTRANS_LOGE("buffer pool alloc block failed, size: %{public}zu.", blockSize);
+        return nullptr;
+    }
+    auto header = reinterpret_cast<AVTransBufferPoolHeader *>(block);
+    header->magic = BUFFER_POOL_BLOCK_MAGIC;
+    header->sizeClass = sizeClass;
+    header->reserved = 0;
+    return block + BUFFER_POOL_HEADER_SIZE;
+}
+
+void AVTransBufferPool::Free(uint8_t *ptr)
+{
+    if (ptr == nullptr) {
+        return;
+    }
+    uint8_t *block = ptr - BUFFER_POOL_HEADER_SIZE;
+    auto header = reinterpret_cast<AVTransBufferPoolHeader *>(block);
+    if (header->magic != BUFFER_POOL_BLOCK_MAGIC) {
+        AVTRANS_LOGE("buffer pool free invalid block.");
+        return;
+    }
+    uint32_t sizeClass = header->sizeClass;
+    if (sizeClass < BUFFER_POOL_SIZE_CLASS_NUM) {
+        size_t blockSize = BUFFER_POOL_MIN_BLOCK_SIZE << sizeClass;
+        std::lock_guard<std::mutex> lock(poolMtx_);
+        auto &blocks = freeBlocks_[sizeClass];
+        if ((blocks.size() < config_.maxBlocksPerClass) && (cachedBytes_ + blockSize <= config_.maxCachedBytes)) {
+            blocks.push_back(block);
+            cachedBytes_ += blockSize;
+            recycleCount_++;
+            return;
+        }
+    }
+    dropCount_++;
+    header->magic = 0;
+    delete[] block;
+}
+
+std::shared_ptr<uint8_t> AVTransBufferPool::Acquire(size_t size)
+{
+    uint8_t *ptr = Alloc(size);
+    if (ptr == nullptr) {
+        return nullptr;
+    }
+    return std::shared_ptr<uint8_t>(ptr, [](uint8_t *data) { AVTransBufferPool::GetInstance().Free(data); });
+}
+
+void AVTransBufferPool::SetConfig(const AVTransBufferPoolConfig &config)
+{
+    {
+        std::lock_guard<std::mutex> lock(poolMtx_);
+        config_ = config;
+        for (auto &blocks : freeBlocks_) {
+            blocks.reserve(config_.maxBlocksPerClass);
+        }
+    }
+    AVTRANS_LOGI("buffer pool config, maxBlocksPerClass: %{public}u, maxCachedBytes: %{public}zu.",
+        config.maxBlocksPerClass, config.maxCachedBytes);
+    Clear();
+}
+
+AVTransBufferPoolStats AVTransBufferPool::GetStats()
+{
+    AVTransBufferPoolStats stats;
+    stats.hitCount = hitCount_.load();
+    stats.missCount = missCount_.load();
+    stats.recycleCount = recycleCount_.load();
+    stats.dropCount = dropCount_.load();
+    std::lock_guard<std::mutex> lock(poolMtx_);
+    stats.cachedBytes = cachedBytes_;
+    return stats;
+}
+
+void AVTransBufferPool::ResetStats()
+{
+    hitCount_ = 0;
+    missCount_ = 0;
+    recycleCount_ = 0;
+    dropCount_ = 0;
+}
+
+void AVTransBufferPool::Clear()
+{
+    std::lock_guard<std::mutex> lock(poolMtx_);
+    for (auto &blocks : freeBlocks_) {
+        for (uint8_t *block : blocks) {
+            delete[] block;
+        }
+        blocks.clear();
+    }
+    cachedBytes_ = 0;
+}
 
 AVTransBuffer::AVTransBuffer(MetaType type) : meta_()
 {
@@ -96,7 +237,7 @@ BufferData::BufferData(size_t capacity)
     : capacity_(capacity), size_(0), address_(nullptr)
 {
     if (capacity <= CAPACITY_MAX_LENGTH) {
-        address_ = std::shared_ptr<uint8_t>(new uint8_t[capacity], std::default_delete<uint8_t[]>());
+        address_ = AVTransBufferPool::GetInstance().Acquire(capacity);
     } else {
         AVTRANS_LOGE("The capacity is not in range : %{public}d.", capacity);
     }
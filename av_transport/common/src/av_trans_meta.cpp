@@ -15,6 +15,9 @@
 
 #include "av_trans_meta.h"
 
+#include <type_traits>
+
+#include "av_trans_constants.h"
 #include "av_trans_utils.h"
 #include "cJSON.h"
 
@@ -26,6 +29,34 @@ const std::string META_FRAME_NUMBER = "meta_frame_number";
 const std::string META_EXT_TIMESTAMP = "meta_ext_timestamp";
 const std::string META_EXT_FRAME_NUMBER = "meta_ext_frame_number";
 
+const uint16_t META_FLAG_EXT_TIMESTAMP = 0x0001;
+const uint16_t META_FLAG_EXT_FRAME_NUMBER = 0x0002;
+
+namespace {
+template<typename T>
+uint32_t WriteBigEndian(uint8_t *buf, uint32_t offset, T value)
+{
+    using U = typename std::make_unsigned<T>::type;
+    U raw = static_cast<U>(value);
+    for (uint32_t i = 0; i < sizeof(T); i++) {
+        buf[offset + i] = static_cast<uint8_t>(raw >> ((sizeof(T) - 1 - i) * 8));
+    }
+    return offset + sizeof(T);
+}
+
+template<typename T>
+uint32_t ReadBigEndian(const uint8_t *buf, uint32_t offset, T &value)
+{
+    using U = typename std::make_unsigned<T>::type;
+    U raw = 0;
+    for (uint32_t i = 0; i < sizeof(T); i++) {
+        raw = static_cast<U>((raw << 8) | buf[offset + i]);
+    }
+    value = static_cast<T>(raw);
+    return offset + sizeof(T);
+}
+} // namespace
+
 std::shared_ptr<OHOS::Media::Plugin::BufferMeta> AVTransAudioBufferMeta::Clone()
 {
     auto bufferMeta = std::make_shared<AVTransAudioBufferMeta>();
@@ -169,5 +200,178 @@ bool AVTransVideoBufferMeta::UnmarshalVideoMeta(const std::string& jsonStr)
     cJSON_Delete(metaJson);
     return true;
 }
+
+bool AVTransVideoBufferMeta::MarshalVideoMetaBinary(uint8_t *buf, uint32_t len)
+{
+    if (buf == nullptr || len < AVT_EXT_HEADER_LEN) {
+        return false;
+    }
+    uint16_t flags = 0;
+    if (extPts_ > 0) {
+        flags |= META_FLAG_EXT_TIMESTAMP;
+    }
+    if (extFrameNum_ > 0) {
+        flags |= META_FLAG_EXT_FRAME_NUMBER;
+    }
+    uint32_t offset = WriteBigEndian<uint16_t>(buf, 0, AVT_EXT_HEADER_MAGIC);
+    offset = WriteBigEndian<uint8_t>(buf, offset, AVT_EXT_HEADER_VERSION_BINARY);
+    offset = WriteBigEndian<uint8_t>(buf, offset, static_cast<uint8_t>(AVT_EXT_HEADER_LEN));
+    offset = WriteBigEndian<uint8_t>(buf, offset, static_cast<uint8_t>(GetType()));
+    offset = WriteBigEndian<uint8_t>(buf, offset, static_cast<uint8_t>(dataType_));
+    offset = WriteBigEndian<uint16_t>(buf, offset, flags);
+    offset = WriteBigEndian<int64_t>(buf, offset, pts_);
+    offset = WriteBigEndian<uint32_t>(buf, offset, frameNum_);
+    offset = WriteBigEndian<uint32_t>(buf, offset, extFrameNum_);
+    WriteBigEndian<int64_t>(buf, offset, extPts_);
+    return true;
+}
+
+bool AVTransVideoBufferMeta::UnmarshalVideoMetaBinary(const uint8_t *buf, uint32_t len)
+{
+    if (!IsBinaryVideoMeta(buf, len)) {
+        return false;
+    }
+    uint8_t metaType = 0;
+    uint8_t dataType = 0;
+    uint16_t flags = 0;
+    int64_t extPts = 0;
+    uint32_t extFrameNum = 0;
+    uint32_t offset = ReadBigEndian<uint8_t>(buf, sizeof(uint16_t) + sizeof(uint8_t) + sizeof(uint8_t), metaType);
+    if (metaType != static_cast<uint8_t>(BufferMetaType::VIDEO)) {
+        return false;
+    }
+    offset = ReadBigEndian<uint8_t>(buf, offset, dataType);
+    offset = ReadBigEndian<uint16_t>(buf, offset, flags);
+    offset = ReadBigEndian<int64_t>(buf, offset, pts_);
+    offset = ReadBigEndian<uint32_t>(buf, offset, frameNum_);
+    offset = ReadBigEndian<uint32_t>(buf, offset, extFrameNum);
+    ReadBigEndian<int64_t>(buf, offset, extPts);
+    dataType_ = static_cast<BufferDataType>(dataType);
+    extPts_ = (flags & META_FLAG_EXT_TIMESTAMP) ? extPts : 0;
+    extFrameNum_ = (flags & META_FLAG_EXT_FRAME_NUMBER) ? extFrameNum : 0;
+    return true;
+}
+
+bool AVTransVideoBufferMeta::IsBinaryVideoMeta(const uint8_t *buf, uint32_t len)
+{
+    if (buf == nullptr || len < AVT_EXT_HEADER_LEN) {
+        return false;
+    }
+    uint16_t magic = 0;
+    uint8_t version = 0;
+    uint8_t headerLen = 0;
+    uint32_t offset = ReadBigEndian<uint16_t>(buf, 0, magic);
+    offset = ReadBigEndian<uint8_t>(buf, offset, version);
+    ReadBigEndian<uint8_t>(buf, offset, headerLen);
+    // newer versions may only append fields, so any header at least as long as ours is readable
+    return (magic == AVT_EXT_HEADER_MAGIC) && (version >= AVT_EXT_HEADER_VERSION_BINARY) &&
+        (headerLen >= AVT_EXT_HEADER_LEN) && (headerLen <= len);
+}
+
+AVTransVideoBatchMeta::AVTransVideoBatchMeta()
+{
+    Clear();
+}
+
+void AVTransVideoBatchMeta::Clear()
+{
+    ext_.assign(AVT_BATCH_HEADER_LEN, 0);
+    frameNum_ = 0;
+    payloadLen_ = 0;
+}
+
+bool AVTransVideoBatchMeta::AddFrame(AVTransVideoBufferMeta &meta, uint32_t payloadLen)
+{
+    if (frameNum_ >= AVT_BATCH_MAX_FRAME_NUM) {
+        return false;
+    }
+    size_t offset = ext_.size();
+    ext_.resize(offset + AVT_BATCH_FRAME_INFO_LEN);
+    if (!meta.MarshalVideoMetaBinary(ext_.data() + offset, AVT_EXT_HEADER_LEN)) {
+        ext_.resize(offset);
+        return false;
+    }
+    WriteBigEndian<uint32_t>(ext_.data() + offset, AVT_EXT_HEADER_LEN, payloadLen);
+    frameNum_++;
+    payloadLen_ += payloadLen;
+    return true;
+}
+
+bool AVTransVideoBatchMeta::GetFrame(uint32_t index, AVTransVideoBufferMeta &meta, uint32_t &payloadLen) const
+{
+    if (index >= frameNum_) {
+        return false;
+    }
+    const uint8_t *info = ext_.data() + AVT_BATCH_HEADER_LEN + index * AVT_BATCH_FRAME_INFO_LEN;
+    if (!meta.UnmarshalVideoMetaBinary(info, AVT_EXT_HEADER_LEN)) {
+        return false;
+    }
+    ReadBigEndian<uint32_t>(info, AVT_EXT_HEADER_LEN, payloadLen);
+    return true;
+}
+
+uint32_t AVTransVideoBatchMeta::GetFrameNum() const
+{
+    return frameNum_;
+}
+
+uint32_t AVTransVideoBatchMeta::GetPayloadLen() const
+{
+    return payloadLen_;
+}
+
+const std::vector<uint8_t> &AVTransVideoBatchMeta::Marshal()
+{
+    uint32_t offset = WriteBigEndian<uint16_t>(ext_.data(), 0, AVT_EXT_HEADER_MAGIC);
+    offset = WriteBigEndian<uint8_t>(ext_.data(), offset, AVT_EXT_HEADER_VERSION_BATCH);
+    offset = WriteBigEndian<uint8_t>(ext_.data(), offset, static_cast<uint8_t>(AVT_BATCH_HEADER_LEN));
+    offset = WriteBigEndian<uint16_t>(ext_.data(), offset, static_cast<uint16_t>(frameNum_));
+    WriteBigEndian<uint16_t>(ext_.data(), offset, 0);
+    return ext_;
+}
+
+bool AVTransVideoBatchMeta::Unmarshal(const uint8_t *buf, uint32_t len)
+{
+    Clear();
+    if (!IsBatchVideoMeta(buf, len)) {
+        return false;
+    }
+    uint16_t frameNum = 0;
+    ReadBigEndian<uint16_t>(buf, sizeof(uint16_t) + sizeof(uint8_t) + sizeof(uint8_t), frameNum);
+    if (frameNum == 0 || frameNum > AVT_BATCH_MAX_FRAME_NUM ||
+        len < AVT_BATCH_HEADER_LEN + frameNum * AVT_BATCH_FRAME_INFO_LEN) {
+        return false;
+    }
+    ext_.assign(buf, buf + AVT_BATCH_HEADER_LEN + frameNum * AVT_BATCH_FRAME_INFO_LEN);
+    uint64_t totalLen = 0;
+    for (uint32_t i = 0; i < frameNum; i++) {
+        uint32_t payloadLen = 0;
+        ReadBigEndian<uint32_t>(ext_.data() + AVT_BATCH_HEADER_LEN + i * AVT_BATCH_FRAME_INFO_LEN,
+            AVT_EXT_HEADER_LEN, payloadLen);
+        totalLen += payloadLen;
+    }
+    if (totalLen > UINT32_MAX) {
+        Clear();
+        return false;
+    }
+    frameNum_ = frameNum;
+    payloadLen_ = static_cast<uint32_t>(totalLen);
+    return true;
+}
+
+bool AVTransVideoBatchMeta::IsBatchVideoMeta(const uint8_t *buf, uint32_t len)
+{
+    if (buf == nullptr || len < AVT_BATCH_HEADER_LEN) {
+        return false;
+    }
+    uint16_t magic = 0;
+    uint8_t version = 0;
+    uint8_t headerLen = 0;
+    uint32_t offset = ReadBigEndian<uint16_t>(buf, 0, magic);
+    offset = ReadBigEndian<uint8_t>(buf, offset, version);
+    ReadBigEndian<uint8_t>(buf, offset, headerLen);
+    return (magic == AVT_EXT_HEADER_MAGIC) && (version == AVT_EXT_HEADER_VERSION_BATCH) &&
+        (headerLen == AVT_BATCH_HEADER_LEN);
+}
 } // namespace DistributedHardware
 } // namespace OHOS
\ No newline at end of file
@@ -108,6 +108,22 @@ void ParseChannelDescription(const std::string &descJsonStr, std::string &ownerN
     cJSON_Delete(descJson);
 }
 
+void *AVTransPoolAllocator::Alloc(size_t size)
+{
+    return AVTransBufferPool::GetInstance().Alloc(size);
+}
+
+void AVTransPoolAllocator::Free(void *ptr) // NOLINT: void*
+{
+    AVTransBufferPool::GetInstance().Free(static_cast<uint8_t *>(ptr));
+}
+
+std::shared_ptr<Plugin::Allocator> GetAVTransPoolAllocator()
+{
+    static std::shared_ptr<Plugin::Allocator> allocator = std::make_shared<AVTransPoolAllocator>();
+    return allocator;
+}
+
 std::shared_ptr<AVBuffer> TransBuffer2HiSBuffer(const std::shared_ptr<AVTransBuffer>& transBuffer)
 {
     if ((transBuffer == nullptr) || transBuffer->IsEmpty()) {
@@ -32,6 +32,11 @@ namespace DistributedHardware {
 IMPLEMENT_SINGLE_INSTANCE(SoftbusChannelAdapter);
 
 namespace {
+constexpr uint32_t CHANNEL_EVENT_WORKER_NUM = 4;
+constexpr size_t MAX_CHANNEL_EVENT_QUEUE_SIZE = 1024;
+constexpr size_t MAX_STREAM_FRAME_QUEUE_SIZE = 16;
+constexpr uint64_t STREAM_DROP_LOG_INTERVAL = 100;
+
 const static std::pair<std::string, std::string> LOCAL_TO_PEER_SESSION_NAME_MAP[] = {
     {OWNER_NAME_D_MIC + "_" + SENDER_CONTROL_SESSION_NAME_SUFFIX,
      OWNER_NAME_D_MIC + "_" + RECEIVER_CONTROL_SESSION_NAME_SUFFIX},
@@ -108,6 +113,144 @@ static void onDevTimeSyncResult(const TimeSyncResultInfo *info, int32_t result)
     SoftbusChannelAdapter::GetInstance().OnSoftbusTimeSyncResult(info, result);
 }
 
+SoftbusStreamDispatcher::SoftbusStreamDispatcher(const std::string &sessName, StreamPayloadAllocator allocator)
+    : sessName_(sessName), allocator_(std::move(allocator))
+{
+}
+
+SoftbusStreamDispatcher::~SoftbusStreamDispatcher()
+{
+    Stop();
+}
+
+void SoftbusStreamDispatcher::Start()
+{
+    std::lock_guard<std::mutex> lock(frameMtx_);
+    if (running_) {
+        return;
+    }
+    running_ = true;
+    // the listener may drop the last outside reference from inside its callback, keep this alive for the loop
+    std::shared_ptr<SoftbusStreamDispatcher> self = shared_from_this();
+    deliverThread_ = std::thread([self]() { self->DeliverLoop(); });
+}
+
+void SoftbusStreamDispatcher::Stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(frameMtx_);
+        running_ = false;
+        frames_.clear();
+        freeFrames_.clear();
+    }
+    frameCond_.notify_all();
+    if (!deliverThread_.joinable()) {
+        return;
+    }
+    if (deliverThread_.get_id() == std::this_thread::get_id()) {
+        // stopped by the listener from inside its own callback, the loop still holds its own reference
+        deliverThread_.detach();
+        return;
+    }
+    deliverThread_.join();
+}
+
+void SoftbusStreamDispatcher::PushFrame(const StreamData *data, const StreamData *ext)
+{
+    received_++;
+    StreamFrame frame;
+    {
+        std::lock_guard<std::mutex> lock(frameMtx_);
+        if (!running_) {
+            dropped_++;
+            return;
+        }
+        if (!freeFrames_.empty()) {
+            frame = std::move(freeFrames_.back());
+            freeFrames_.pop_back();
+        }
+    }
+    // copy outside the lock, the consumer keeps taking frames meanwhile
+    frame.data.clear();
+    frame.payload = nullptr;
+    frame.payloadSize = 0;
+    if (data->buf != nullptr && data->bufLen > 0) {
+        if (allocator_ != nullptr) {
+            frame.payload = allocator_(static_cast<uint32_t>(data->bufLen));
+        }
+        if (frame.payload != nullptr &&
+            memcpy_s(frame.payload.get(), data->bufLen, data->buf, data->bufLen) == EOK) {
+            frame.payloadSize = static_cast<uint32_t>(data->bufLen);
+        } else {
+            frame.payload = nullptr;
+            frame.data.assign(data->buf, data->buf + data->bufLen);
+        }
+    }
+    if (ext->buf != nullptr && ext->bufLen > 0) {
+        frame.ext.assign(ext->buf, ext->buf + ext->bufLen);
+    } else {
+        frame.ext.clear();
+    }
+    {
+        std::lock_guard<std::mutex> lock(frameMtx_);
+        if (!running_) {
+            dropped_++;
+            return;
+        }
+        if (frames_.size() >= MAX_STREAM_FRAME_QUEUE_SIZE) {
+            freeFrames_.push_back(std::move(frames_.front()));
+            frames_.pop_front();
+            uint64_t dropped = ++dropped_;
+            if (dropped % STREAM_DROP_LOG_INTERVAL == 1) {
+                AVTRANS_LOGE("Stream consumer too slow, sessName:%{public}s, dropped:%{public}" PRIu64,
+                    sessName_.c_str(), dropped);
+            }
+        }
+        frames_.push_back(std::move(frame));
+    }
+    frameCond_.notify_one();
+}
+
+void SoftbusStreamDispatcher::DeliverLoop()
+{
+    pthread_setname_np(pthread_self(), DELIVER_STREAM_DATA);
+    while (true) {
+        StreamFrame frame;
+        {
+            std::unique_lock<std::mutex> lock(frameMtx_);
+            frameCond_.wait(lock, [this] { return !running_ || !frames_.empty(); });
+            if (!running_) {
+                return;
+            }
+            frame = std::move(frames_.front());
+            frames_.pop_front();
+        }
+        StreamData ext = {frame.ext.data(), static_cast<int>(frame.ext.size())};
+        if (frame.payload != nullptr) {
+            // the payload belongs to the listener from here on, the frame only keeps its ext storage
+            SoftbusChannelAdapter::GetInstance().DeliverStreamPayload(sessName_, std::move(frame.payload),
+                frame.payloadSize, &ext);
+        } else {
+            StreamData data = {frame.data.data(), static_cast<int>(frame.data.size())};
+            SoftbusChannelAdapter::GetInstance().DeliverStream(sessName_, &data, &ext);
+        }
+        delivered_++;
+        std::lock_guard<std::mutex> lock(frameMtx_);
+        if (running_ && freeFrames_.size() < MAX_STREAM_FRAME_QUEUE_SIZE) {
+            freeFrames_.push_back(std::move(frame));
+        }
+    }
+}
+
+SoftbusStreamStats SoftbusStreamDispatcher::GetStats() const
+{
+    SoftbusStreamStats stats;
+    stats.received = received_.load();
+    stats.delivered = delivered_.load();
+    stats.dropped = dropped_.load();
+    return stats;
+}
+
 SoftbusChannelAdapter::SoftbusChannelAdapter()
 {
     sessListener_.OnBind = OnSessionOpened;
@@ -119,16 +262,148 @@ SoftbusChannelAdapter::SoftbusChannelAdapter()
     sessListener_.OnQos = nullptr;
     sessListener_.OnError = nullptr;
     sessListener_.OnNegotiate = nullptr;
+    StartEventWorkers();
 }
 
 SoftbusChannelAdapter::~SoftbusChannelAdapter()
 {
+    StopEventWorkers();
+    {
+        std::lock_guard<std::mutex> lock(streamMtx_);
+        for (auto &item : streamDispatchers_) {
+            item.second->Stop();
+        }
+        streamDispatchers_.clear();
+    }
+    std::atomic_store(&streamTable_, std::shared_ptr<const StreamDispatcherTable>());
     listenerMap_.clear();
     timeSyncSessNames_.clear();
     devId2SessIdMap_.clear();
+    sessId2IdMapKeys_.clear();
     serverMap_.clear();
 }
 
+void SoftbusChannelAdapter::StartEventWorkers()
+{
+    std::lock_guard<std::mutex> lock(eventMtx_);
+    eventWorkerRunning_ = true;
+    for (uint32_t i = 0; i < CHANNEL_EVENT_WORKER_NUM; i++) {
+        eventWorkers_.emplace_back(&SoftbusChannelAdapter::ChannelEventWorker, this);
+    }
+}
+
+void SoftbusChannelAdapter::StopEventWorkers()
+{
+    {
+        std::lock_guard<std::mutex> lock(eventMtx_);
+        eventWorkerRunning_ = false;
+        eventQueue_.clear();
+    }
+    eventCond_.notify_all();
+    for (auto &worker : eventWorkers_) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+    eventWorkers_.clear();
+}
+
+void SoftbusChannelAdapter::PostChannelEvent(const std::string &sessName, const AVTransEvent &event)
+{
+    {
+        std::lock_guard<std::mutex> lock(eventMtx_);
+        if (eventQueue_.size() >= MAX_CHANNEL_EVENT_QUEUE_SIZE && event.type == EventType::EVENT_DATA_RECEIVED) {
+            AVTRANS_LOGE("Channel event queue is full, drop data event for sessName:%{public}s", sessName.c_str());
+            return;
+        }
+        eventQueue_.push_back({sessName, event});
+    }
+    eventCond_.notify_one();
+}
+
+void SoftbusChannelAdapter::ChannelEventWorker()
+{
+    pthread_setname_np(pthread_self(), SEND_CHANNEL_EVENT);
+    while (true) {
+        ChannelEventItem item;
+        {
+            std::unique_lock<std::mutex> lock(eventMtx_);
+            auto found = eventQueue_.end();
+            eventCond_.wait(lock, [this, &found] {
+                if (!eventWorkerRunning_) {
+                    return true;
+                }
+                // the first event whose session is not being delivered by another worker
+                found = std::find_if(eventQueue_.begin(), eventQueue_.end(),
+                    [this](const ChannelEventItem &queued) { return busySessNames_.count(queued.sessName) == 0; });
+                return found != eventQueue_.end();
+            });
+            if (!eventWorkerRunning_) {
+                return;
+            }
+            item = std::move(*found);
+            eventQueue_.erase(found);
+            busySessNames_.insert(item.sessName);
+        }
+        SendChannelEvent(item.sessName, item.event);
+        {
+            std::lock_guard<std::mutex> lock(eventMtx_);
+            busySessNames_.erase(item.sessName);
+        }
+        eventCond_.notify_all();
+    }
+}
+
+void SoftbusChannelAdapter::InsertSessIdMapItem(const std::string &idMapKey, int32_t sessionId)
+{
+    if (!devId2SessIdMap_.insert(std::make_pair(idMapKey, sessionId)).second) {
+        return;
+    }
+    sessId2IdMapKeys_[sessionId].insert(idMapKey);
+    RefreshStreamTable();
+}
+
+void SoftbusChannelAdapter::EraseSessIdMapItem(const std::string &idMapKey)
+{
+    auto iter = devId2SessIdMap_.find(idMapKey);
+    if (iter == devId2SessIdMap_.end()) {
+        return;
+    }
+    auto keysIter = sessId2IdMapKeys_.find(iter->second);
+    if (keysIter != sessId2IdMapKeys_.end()) {
+        keysIter->second.erase(idMapKey);
+        if (keysIter->second.empty()) {
+            sessId2IdMapKeys_.erase(keysIter);
+        }
+    }
+    devId2SessIdMap_.erase(iter);
+    RefreshStreamTable();
+}
+
+void SoftbusChannelAdapter::RefreshStreamTable()
+{
+    auto table = std::make_shared<StreamDispatcherTable>();
+    {
+        std::lock_guard<std::mutex> lock(streamMtx_);
+        for (const auto &item : devId2SessIdMap_) {
+            auto found = streamDispatchers_.find(item.first);
+            if (found != streamDispatchers_.end()) {
+                (*table)[item.second].push_back(found->second);
+            }
+        }
+    }
+    std::atomic_store(&streamTable_, std::shared_ptr<const StreamDispatcherTable>(table));
+}
+
+std::vector<std::string> SoftbusChannelAdapter::GetIdMapKeysBySessId(int32_t sessionId)
+{
+    auto keysIter = sessId2IdMapKeys_.find(sessionId);
+    if (keysIter == sessId2IdMapKeys_.end()) {
+        return {};
+    }
+    return std::vector<std::string>(keysIter->second.begin(), keysIter->second.end());
+}
+
 std::string SoftbusChannelAdapter::TransName2PkgName(const std::string &ownerName)
 {
     const static std::pair<std::string, std::string> mapArray[] = {
@@ -233,7 +508,8 @@ int32_t SoftbusChannelAdapter::RemoveChannelServer(const std::string& pkgName, c
         for (auto it = devId2SessIdMap_.begin(); it != devId2SessIdMap_.end(); it++) {
             if ((it->first).find(sessName) != std::string::npos) {
                 sessionId = it->second;
-                devId2SessIdMap_.erase(it->first);
+                std::string idMapKey = it->first;
+                EraseSessIdMapItem(idMapKey);
                 break;
             }
         }
@@ -252,7 +528,7 @@ void OHOS::DistributedHardware::SoftbusChannelAdapter::SendEventChannelOPened(co
     {
         for (auto it = listenerMap_.begin(); it != listenerMap_.end(); it++) {
             if (((it->first).find(mySessName) != std::string::npos) && (it->second != nullptr)) {
-                std::thread(&SoftbusChannelAdapter::SendChannelEvent, this, it->first, event).detach();
+                PostChannelEvent(it->first, event);
             }
         }
     }
@@ -305,7 +581,7 @@ int32_t SoftbusChannelAdapter::OpenSoftbusChannel(const std::string &mySessName,
     }
     {
         std::lock_guard<std::mutex> lock(idMapMutex_);
-        devId2SessIdMap_.insert(std::make_pair(mySessName + "_" + peerDevId, socketId));
+        InsertSessIdMapItem(mySessName + "_" + peerDevId, socketId);
     }
     SendEventChannelOPened(mySessName, peerDevId);
     AVTRANS_LOGI("Open softbus channel finished for mySessName:%{public}s.", mySessName.c_str());
@@ -323,7 +599,7 @@ int32_t SoftbusChannelAdapter::CloseSoftbusChannel(const std::string& sessName,
     Shutdown(sessionId);
     {
         std::lock_guard<std::mutex> lock(idMapMutex_);
-        devId2SessIdMap_.erase(sessName + "_" + peerDevId);
+        EraseSessIdMapItem(sessName + "_" + peerDevId);
     }
 
     AVTRANS_LOGI("Close softbus channel success, sessionId:%{public}" PRId32, sessionId);
@@ -385,9 +661,25 @@ int32_t SoftbusChannelAdapter::RegisterChannelListener(const std::string& sessNa
     TRUE_RETURN_V_MSG_E(peerDevId.empty(), ERR_DH_AVT_INVALID_PARAM, "input peerDevId is empty.");
     TRUE_RETURN_V_MSG_E(listener == nullptr, ERR_DH_AVT_INVALID_PARAM, "input callback is nullptr.");
 
-    std::lock_guard<std::mutex> lock(listenerMtx_);
-    listenerMap_[sessName + "_" + peerDevId] = listener;
-
+    std::string listenerKey = sessName + "_" + peerDevId;
+    {
+        std::lock_guard<std::mutex> lock(listenerMtx_);
+        listenerMap_[listenerKey] = listener;
+    }
+    if (sessName.find("avtrans.data") == std::string::npos) {
+        return DH_AVT_SUCCESS;
+    }
+    std::lock_guard<std::mutex> lock(idMapMutex_);
+    {
+        std::lock_guard<std::mutex> streamLock(streamMtx_);
+        if (streamDispatchers_.count(listenerKey) == 0) {
+            auto dispatcher = std::make_shared<SoftbusStreamDispatcher>(listenerKey,
+                listener->GetStreamPayloadAllocator());
+            dispatcher->Start();
+            streamDispatchers_[listenerKey] = dispatcher;
+        }
+    }
+    RefreshStreamTable();
     return DH_AVT_SUCCESS;
 }
 
@@ -398,9 +690,28 @@ int32_t SoftbusChannelAdapter::UnRegisterChannelListener(const std::string& sess
     TRUE_RETURN_V_MSG_E(sessName.empty(), ERR_DH_AVT_INVALID_PARAM, "input sessName is empty.");
     TRUE_RETURN_V_MSG_E(peerDevId.empty(), ERR_DH_AVT_INVALID_PARAM, "input peerDevId is empty.");
 
-    std::lock_guard<std::mutex> lock(listenerMtx_);
-    listenerMap_.erase(sessName + "_" + peerDevId);
-
+    std::string listenerKey = sessName + "_" + peerDevId;
+    {
+        std::lock_guard<std::mutex> lock(listenerMtx_);
+        listenerMap_.erase(listenerKey);
+    }
+    std::shared_ptr<SoftbusStreamDispatcher> dispatcher = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(idMapMutex_);
+        {
+            std::lock_guard<std::mutex> streamLock(streamMtx_);
+            auto found = streamDispatchers_.find(listenerKey);
+            if (found != streamDispatchers_.end()) {
+                dispatcher = found->second;
+                streamDispatchers_.erase(found);
+            }
+        }
+        RefreshStreamTable();
+    }
+    if (dispatcher != nullptr) {
+        // wait for the frame in delivery, the listener may be released once we return
+        dispatcher->Stop();
+    }
     return DH_AVT_SUCCESS;
 }
 
@@ -457,10 +768,9 @@ int32_t SoftbusChannelAdapter::GetSessIdBySessName(const std::string& sessName,
 std::string SoftbusChannelAdapter::GetSessionNameById(int32_t sessionId)
 {
     std::lock_guard<std::mutex> lock(idMapMutex_);
-    for (auto it = devId2SessIdMap_.begin(); it != devId2SessIdMap_.end(); it++) {
-        if (it->second == sessionId) {
-            return it->first;
-        }
+    auto keysIter = sessId2IdMapKeys_.find(sessionId);
+    if (keysIter != sessId2IdMapKeys_.end() && !keysIter->second.empty()) {
+        return *(keysIter->second.begin());
     }
 
     AVTRANS_LOGE("No available channel or invalid sessionId:%{public}" PRId32, sessionId);
@@ -484,9 +794,9 @@ int32_t SoftbusChannelAdapter::OnSoftbusChannelOpened(std::string peerSessionNam
         std::lock_guard<std::mutex> lock(listenerMtx_);
         for (auto it = listenerMap_.begin(); it != listenerMap_.end(); it++) {
             if (((it->first).find(mySessionName) != std::string::npos) && (it->second != nullptr)) {
-                std::thread(&SoftbusChannelAdapter::SendChannelEvent, this, it->first, event).detach();
-                devId2SessIdMap_.erase(it->first);
-                devId2SessIdMap_.insert(std::make_pair(it->first, sessionId));
+                PostChannelEvent(it->first, event);
+                EraseSessIdMapItem(it->first);
+                InsertSessIdMapItem(it->first, sessionId);
             }
         }
     }
@@ -494,7 +804,7 @@ int32_t SoftbusChannelAdapter::OnSoftbusChannelOpened(std::string peerSessionNam
     if (devId2SessIdMap_.find(idMapKey) == devId2SessIdMap_.end()) {
         AVTRANS_LOGI("Can not find sessionId for mySessionName:%{public}s, peerDevId:%{public}s. try to insert it.",
             mySessionName.c_str(), GetAnonyString(peerDevId).c_str());
-            devId2SessIdMap_.insert(std::make_pair(idMapKey, sessionId));
+            InsertSessIdMapItem(idMapKey, sessionId);
     }
     return DH_AVT_SUCCESS;
 }
@@ -508,14 +818,10 @@ void SoftbusChannelAdapter::OnSoftbusChannelClosed(int32_t sessionId, ShutdownRe
     AVTransEvent event = {EventType::EVENT_CHANNEL_CLOSED, "", peerDevId};
 
     std::lock_guard<std::mutex> lock(idMapMutex_);
-    for (auto it = devId2SessIdMap_.begin(); it != devId2SessIdMap_.end();) {
-        if (it->second == sessionId) {
-            event.content = GetOwnerFromSessName(it->first);
-            std::thread(&SoftbusChannelAdapter::SendChannelEvent, this, it->first, event).detach();
-            it = devId2SessIdMap_.erase(it);
-        } else {
-            it++;
-        }
+    for (const auto &idMapKey : GetIdMapKeysBySessId(sessionId)) {
+        event.content = GetOwnerFromSessName(idMapKey);
+        PostChannelEvent(idMapKey, event);
+        EraseSessIdMapItem(idMapKey);
     }
 }
 
@@ -533,10 +839,8 @@ void SoftbusChannelAdapter::OnSoftbusBytesReceived(int32_t sessionId, const void
     AVTransEvent event = {EventType::EVENT_DATA_RECEIVED, dataStr, peerDevId};
 
     std::lock_guard<std::mutex> lock(idMapMutex_);
-    for (auto it = devId2SessIdMap_.begin(); it != devId2SessIdMap_.end(); it++) {
-        if (it->second == sessionId) {
-            std::thread(&SoftbusChannelAdapter::SendChannelEvent, this, it->first, event).detach();
-        }
+    for (const auto &idMapKey : GetIdMapKeysBySessId(sessionId)) {
+        PostChannelEvent(idMapKey, event);
     }
 }
 
@@ -547,15 +851,54 @@ void SoftbusChannelAdapter::OnSoftbusStreamReceived(int32_t sessionId, const Str
     TRUE_RETURN(data == nullptr, "input data is nullptr.");
     TRUE_RETURN(ext == nullptr, "input ext data is nullptr.");
 
-    std::lock_guard<std::mutex> lock(idMapMutex_);
-    for (auto it = devId2SessIdMap_.begin(); it != devId2SessIdMap_.end(); it++) {
-        if (it->second == sessionId) {
-            std::lock_guard<std::mutex> lock(listenerMtx_);
-            ISoftbusChannelListener *listener = listenerMap_[it->first];
-            TRUE_RETURN(listener == nullptr, "Can not find channel listener.");
-            listener->OnStreamReceived(data, ext);
+    std::shared_ptr<const StreamDispatcherTable> table = std::atomic_load(&streamTable_);
+    TRUE_RETURN(table == nullptr, "Stream dispatcher table is empty.");
+    auto found = table->find(sessionId);
+    TRUE_RETURN(found == table->end(), "Can not find channel listener.");
+    for (const auto &dispatcher : found->second) {
+        dispatcher->PushFrame(data, ext);
+    }
+}
+
+void SoftbusChannelAdapter::DeliverStream(const std::string &sessName, const StreamData *data, const StreamData *ext)
+{
+    ISoftbusChannelListener *listener = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(listenerMtx_);
+        auto found = listenerMap_.find(sessName);
+        if (found != listenerMap_.end()) {
+            listener = found->second;
+        }
+    }
+    TRUE_RETURN(listener == nullptr, "Can not find channel listener.");
+    listener->OnStreamReceived(data, ext);
+}
+
+void SoftbusChannelAdapter::DeliverStreamPayload(const std::string &sessName, std::shared_ptr<uint8_t> payload,
+    uint32_t size, const StreamData *ext)
+{
+    ISoftbusChannelListener *listener = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(listenerMtx_);
+        auto found = listenerMap_.find(sessName);
+        if (found != listenerMap_.end()) {
+            listener = found->second;
         }
     }
+    TRUE_RETURN(listener == nullptr, "Can not find channel listener.");
+    listener->OnStreamPayloadReceived(std::move(payload), size, ext);
+}
+
+int32_t SoftbusChannelAdapter::GetStreamStats(const std::string &sessName, const std::string &peerDevId,
+    SoftbusStreamStats &stats)
+{
+    std::lock_guard<std::mutex> lock(streamMtx_);
+    auto found = streamDispatchers_.find(sessName + "_" + peerDevId);
+    if (found == streamDispatchers_.end()) {
+        return ERR_DH_AVT_INVALID_PARAM;
+    }
+    stats = found->second->GetStats();
+    return DH_AVT_SUCCESS;
 }
 
 void SoftbusChannelAdapter::OnSoftbusTimeSyncResult(const TimeSyncResultInfo *info, int32_t result)
@@ -588,15 +931,16 @@ void SoftbusChannelAdapter::OnSoftbusTimeSyncResult(const TimeSyncResultInfo *in
 std::string SoftbusChannelAdapter::GetPeerDevIdBySessId(int32_t sessionId)
 {
     std::lock_guard<std::mutex> lock(idMapMutex_);
-    for (auto it = devId2SessIdMap_.begin(); it != devId2SessIdMap_.end(); it++) {
-        if (it->second != sessionId) {
-            continue;
-        }
-        std::string::size_type position = (it->first).find_last_of("_");
+    auto keysIter = sessId2IdMapKeys_.find(sessionId);
+    if (keysIter == sessId2IdMapKeys_.end()) {
+        return EMPTY_STRING;
+    }
+    for (const auto &idMapKey : keysIter->second) {
+        std::string::size_type position = idMapKey.find_last_of("_");
         if (position == std::string::npos) {
             continue;
         }
-        std::string peerDevId = (it->first).substr(position + 1);
+        std::string peerDevId = idMapKey.substr(position + 1);
         if (peerDevId != AV_TRANS_SPECIAL_DEVICE_ID) {
             return peerDevId;
         }
@@ -619,7 +963,6 @@ std::string SoftbusChannelAdapter::GetOwnerFromSessName(const std::string &sessN
 void SoftbusChannelAdapter::SendChannelEvent(const std::string &sessName, const AVTransEvent event)
 {
     AVTRANS_LOGI("SendChannelEvent event.type_%{public}" PRId32, event.type);
-    pthread_setname_np(pthread_self(), SEND_CHANNEL_EVENT);
 
     ISoftbusChannelListener *listener = nullptr;
     {
@@ -18,6 +18,7 @@
 #include "av_sync_utils.h"
 
 #include "av_trans_constants.h"
+#include "av_trans_errno.h"
 #include "cJSON.h"
 
 using namespace testing::ext;
@@ -147,5 +148,148 @@ HWTEST_F(AvSyncUtilsTest, UnmarshalSharedMemory_002, TestSize.Level0)
     cJSON_free(cjson3);
     cJSON_Delete(cJsonObj3);
 }
+HWTEST_F(AvSyncUtilsTest, MapAVTransSharedMemory_001, TestSize.Level0)
+{
+    AVTransSharedMemory memory = { 0, 0, "" };
+    AVTransMappedMemory mapped;
+    EXPECT_NE(0, MapAVTransSharedMemory(memory, mapped));
+    EXPECT_TRUE(IsInValidMappedMemory(mapped));
+    UnmapAVTransSharedMemory(mapped);
+    EXPECT_EQ(nullptr, mapped.base);
+}
+
+HWTEST_F(AvSyncUtilsTest, ClockUnitRing_001, TestSize.Level0)
+{
+    AVTransSharedMemory memory = CreateAVTransSharedMemory("clockRingTest", AV_SYNC_CLOCK_RING_MEM_SIZE);
+    ASSERT_FALSE(IsInValidSharedMemory(memory));
+    AVTransMappedMemory mapped;
+    ASSERT_EQ(0, MapAVTransSharedMemory(memory, mapped));
+
+    AVSyncClockUnit readUnit = { 0, 1, 0 };
+    EXPECT_NE(0, ReadClockUnitFromMemory(mapped, readUnit));
+
+    AVSyncClockUnit writeUnit = { 0, 0, 0 };
+    for (uint32_t i = 1; i <= MAX_CLOCK_UNIT_COUNT + 3; i++) {
+        writeUnit.frameNum = i;
+        writeUnit.pts = static_cast<int64_t>(i) * 100;
+        EXPECT_EQ(0, WriteClockUnitToMemory(mapped, writeUnit));
+    }
+    EXPECT_EQ(3, writeUnit.index);
+    EXPECT_EQ(0, ReadClockUnitFromMemory(mapped, readUnit));
+    EXPECT_EQ(MAX_CLOCK_UNIT_COUNT + 3, readUnit.frameNum);
+    EXPECT_EQ((MAX_CLOCK_UNIT_COUNT + 3) * 100, readUnit.pts);
+
+    UnmapAVTransSharedMemory(mapped);
+    CloseAVTransSharedMemory(memory);
+}
+
+HWTEST_F(AvSyncUtilsTest, FrameInfo_001, TestSize.Level0)
+{
+    AVTransSharedMemory memory = CreateAVTransSharedMemory("frameInfoTest", AV_SYNC_FRAME_INFO_MEM_SIZE);
+    ASSERT_FALSE(IsInValidSharedMemory(memory));
+    AVTransMappedMemory mapped;
+    ASSERT_EQ(0, MapAVTransSharedMemory(memory, mapped));
+
+    uint32_t frameNum = 0;
+    int64_t timestamp = 0;
+    EXPECT_NE(0, ReadFrameInfoFromMemory(mapped, frameNum, timestamp));
+    EXPECT_EQ(0, WriteFrameInfoToMemory(mapped, 10, 1000));
+    EXPECT_EQ(0, ReadFrameInfoFromMemory(mapped, frameNum, timestamp));
+    EXPECT_EQ(10, frameNum);
+    EXPECT_EQ(1000, timestamp);
+
+    EXPECT_EQ(0, ResetSharedMemory(mapped));
+    EXPECT_NE(0, ReadFrameInfoFromMemory(mapped, frameNum, timestamp));
+
+    UnmapAVTransSharedMemory(mapped);
+    CloseAVTransSharedMemory(memory);
+}
+
+HWTEST_F(AvSyncUtilsTest, LegacyLayout_001, TestSize.Level0)
+{
+    AVTransSharedMemory clockMemory = CreateAVTransSharedMemory("legacyClockTest", AV_SYNC_V1_CLOCK_RING_MEM_SIZE);
+    ASSERT_FALSE(IsInValidSharedMemory(clockMemory));
+    AVSyncClockUnit writeUnit = { 0, 0, 0 };
+    for (uint32_t i = 1; i <= MAX_CLOCK_UNIT_COUNT + 3; i++) {
+        writeUnit.frameNum = i;
+        writeUnit.pts = static_cast<int64_t>(i) * 100;
+        EXPECT_EQ(0, WriteClockUnitToMemory(clockMemory, writeUnit));
+    }
+    AVSyncClockUnit readUnit = { 0, 1, 0 };
+    EXPECT_EQ(0, ReadClockUnitFromMemory(clockMemory, readUnit));
+    EXPECT_EQ(MAX_CLOCK_UNIT_COUNT + 3, readUnit.frameNum);
+    EXPECT_EQ((MAX_CLOCK_UNIT_COUNT + 3) * 100, readUnit.pts);
+    CloseAVTransSharedMemory(clockMemory);
+
+    AVTransSharedMemory infoMemory = CreateAVTransSharedMemory("legacyInfoTest", AV_SYNC_V1_FRAME_INFO_MEM_SIZE);
+    ASSERT_FALSE(IsInValidSharedMemory(infoMemory));
+    uint32_t frameNum = 0;
+    int64_t timestamp = 0;
+    EXPECT_EQ(0, WriteFrameInfoToMemory(infoMemory, 10, 1000));
+    EXPECT_EQ(0, ReadFrameInfoFromMemory(infoMemory, frameNum, timestamp));
+    EXPECT_EQ(10, frameNum);
+    EXPECT_EQ(1000, timestamp);
+    EXPECT_EQ(0, ResetSharedMemory(infoMemory));
+    EXPECT_NE(0, ReadFrameInfoFromMemory(infoMemory, frameNum, timestamp));
+    CloseAVTransSharedMemory(infoMemory);
+}
+
+HWTEST_F(AvSyncUtilsTest, FrameRing_001, TestSize.Level0)
+{
+    EXPECT_EQ(0U, GetFrameRingMemSize(0, 16));
+    EXPECT_EQ(0U, GetFrameRingMemSize(2, MAX_FRAME_RING_SLOT_SIZE + 1));
+
+    uint32_t slotNum = 2;
+    uint32_t slotSize = 16;
+    AVTransSharedMemory memory = CreateAVTransSharedMemory("frameRingTest", GetFrameRingMemSize(slotNum, slotSize));
+    ASSERT_FALSE(IsInValidSharedMemory(memory));
+    AVTransMappedMemory mapped;
+    ASSERT_EQ(0, MapAVTransSharedMemory(memory, mapped));
+    EXPECT_NE(0, CheckFrameRingMemory(mapped));
+    ASSERT_EQ(0, InitFrameRingMemory(mapped, slotNum, slotSize));
+    AVFrameRingGeometry geometry;
+    ASSERT_EQ(0, CheckFrameRingMemory(mapped, geometry));
+    EXPECT_EQ(slotNum, geometry.slotNum);
+    EXPECT_EQ(slotSize, geometry.slotSize);
+
+    uint8_t frame[] = { 1, 2, 3, 4 };
+    AVFrameRingInfo info;
+    info.dataSize = sizeof(frame);
+    info.width = 1920;
+    info.pts = 1000;
+    bool isNotify = false;
+    EXPECT_EQ(0, WriteFrameToRing(mapped, geometry, info, frame, isNotify));
+    EXPECT_TRUE(isNotify);
+    EXPECT_EQ(0, WriteFrameToRing(mapped, geometry, info, frame, isNotify));
+    EXPECT_FALSE(isNotify);
+    EXPECT_EQ(ERR_DH_AVT_SHARED_RING_FULL, WriteFrameToRing(mapped, geometry, info, frame, isNotify));
+
+    uint8_t data[16] = { 0 };
+    AVFrameRingInfo readInfo;
+    EXPECT_EQ(ERR_DH_AVT_INVALID_PARAM, ReadFrameFromRing(mapped, readInfo, data, 1));
+    EXPECT_EQ(0, ReadFrameFromRing(mapped, readInfo, data, sizeof(data)));
+    EXPECT_EQ(sizeof(frame), readInfo.dataSize);
+    EXPECT_EQ(1920U, readInfo.width);
+    EXPECT_EQ(1000, readInfo.pts);
+    EXPECT_EQ(3, data[2]);
+    EXPECT_EQ(0, ReadFrameFromRing(mapped, readInfo, data, sizeof(data)));
+    EXPECT_EQ(ERR_DH_AVT_SHARED_RING_EMPTY, ReadFrameFromRing(mapped, readInfo, data, sizeof(data)));
+
+    AVFrameRingStatistics stats;
+    EXPECT_EQ(0, GetFrameRingStatistics(mapped, stats));
+    EXPECT_EQ(2U, stats.writeCount);
+    EXPECT_EQ(2U, stats.readCount);
+    EXPECT_EQ(1U, stats.overflowCount);
+    EXPECT_LE(stats.avgLatencyNs, stats.maxLatencyNs);
+
+    // a reader rewriting the shared header must not change where the writer writes
+    ASSERT_EQ(0, InitFrameRingMemory(mapped, slotNum, 1));
+    EXPECT_EQ(0, WriteFrameToRing(mapped, geometry, info, frame, isNotify));
+    AVFrameRingGeometry badGeometry = { MAX_FRAME_RING_SLOT_NUM, slotSize };
+    EXPECT_EQ(ERR_DH_AVT_INVALID_PARAM, WriteFrameToRing(mapped, badGeometry, info, frame, isNotify));
+
+    UnmapAVTransSharedMemory(mapped);
+    CloseAVTransSharedMemory(memory);
+}
 }
 }
\ No newline at end of file
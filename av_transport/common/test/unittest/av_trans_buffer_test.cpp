@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "av_trans_buffer.h"
+
+using namespace testing::ext;
+namespace OHOS {
+namespace DistributedHardware {
+using namespace std;
+class AvTransBufferTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+};
+
+void AvTransBufferTest::SetUpTestCase()
+{
+}
+
+void AvTransBufferTest::TearDownTestCase()
+{
+}
+
+void AvTransBufferTest::SetUp()
+{
+    AVTransBufferPool::GetInstance().SetConfig(AVTransBufferPoolConfig());
+    AVTransBufferPool::GetInstance().ResetStats();
+}
+
+void AvTransBufferTest::TearDown()
+{
+    AVTransBufferPool::GetInstance().Clear();
+}
+
+HWTEST_F(AvTransBufferTest, BufferPoolAlloc_001, TestSize.Level0)
+{
+    auto &pool = AVTransBufferPool::GetInstance();
+    uint8_t *first = pool.Alloc(1000);
+    ASSERT_NE(nullptr, first);
+    pool.Free(first);
+    uint8_t *second = pool.Alloc(BUFFER_POOL_MIN_BLOCK_SIZE);
+    EXPECT_EQ(first, second);
+    pool.Free(second);
+
+    auto stats = pool.GetStats();
+    EXPECT_EQ(1, stats.hitCount);
+    EXPECT_EQ(1, stats.missCount);
+    EXPECT_EQ(2, stats.recycleCount);
+    EXPECT_EQ(BUFFER_POOL_MIN_BLOCK_SIZE, stats.cachedBytes);
+}
+
+HWTEST_F(AvTransBufferTest, BufferPoolAlloc_002, TestSize.Level0)
+{
+    auto &pool = AVTransBufferPool::GetInstance();
+    AVTransBufferPoolConfig config;
+    config.maxBlocksPerClass = 1;
+    pool.SetConfig(config);
+
+    uint8_t *first = pool.Alloc(BUFFER_POOL_MIN_BLOCK_SIZE);
+    uint8_t *second = pool.Alloc(BUFFER_POOL_MIN_BLOCK_SIZE);
+    pool.Free(first);
+    pool.Free(second);
+    auto stats = pool.GetStats();
+    EXPECT_EQ(1, stats.recycleCount);
+    EXPECT_EQ(1, stats.dropCount);
+
+    uint8_t *large = pool.Alloc(BUFFER_POOL_MAX_BLOCK_SIZE + 1);
+    ASSERT_NE(nullptr, large);
+    pool.Free(large);
+    EXPECT_EQ(2, pool.GetStats().dropCount);
+    EXPECT_EQ(nullptr, pool.Alloc(UINT32_MAX));
+}
+
+HWTEST_F(AvTransBufferTest, CreateBufferData_001, TestSize.Level0)
+{
+    {
+        AVTransBuffer buffer;
+        auto bufData = buffer.CreateBufferData(CAPACITY_MAX_LENGTH);
+        ASSERT_NE(nullptr, bufData);
+        EXPECT_NE(nullptr, bufData->GetAddress());
+    }
+    AVTransBuffer buffer;
+    auto bufData = buffer.CreateBufferData(CAPACITY_MAX_LENGTH);
+    ASSERT_NE(nullptr, bufData);
+    EXPECT_EQ(1, AVTransBufferPool::GetInstance().GetStats().hitCount);
+}
+} // namespace DistributedHardware
+} // namespace OHOS
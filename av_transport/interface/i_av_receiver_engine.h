@@ -112,6 +112,20 @@ public:
      * @return Returns BOOL(0)
      */
     virtual bool ReStartDumpMediaData() = 0;
+
+    /**
+     * @brief Get the output statistics of the receiver engine over the recent sliding window.
+     *        Only the video output collects them, an audio receiver engine returns an error.
+     * @param statistics  json string with p50/p90/p99/max, rates and drop counts, values in microseconds.
+     * @return Returns DH_AVT_SUCCESS(0) if successful, otherwise returns other error code.
+     */
+    virtual int32_t GetOutputStatistics(std::string &statistics) = 0;
+
+    /**
+     * @brief Reset the output statistics of the receiver engine, the stream keeps running.
+     * @return Returns DH_AVT_SUCCESS(0) if successful, otherwise returns other error code.
+     */
+    virtual int32_t ResetOutputStatistics() = 0;
 };
 } // DistributedHardware
 } // OHOS
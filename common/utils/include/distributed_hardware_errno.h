@@ -81,6 +81,7 @@ namespace DistributedHardware {
 
     /* Task errno, range: [-10700, -10799] */
     constexpr int32_t ERR_DH_FWK_TASK_TIMEOUT = -10700;
+    constexpr int32_t ERR_DH_FWK_TASK_QUEUE_FULL = -10701;
 
     /* DistributedHardwareService errno, range: [-10800, -10899] */
     constexpr int32_t ERR_DH_FWK_SERVICE_IPC_WRITE_PARA_FAIL = -10800;
@@ -20,6 +20,7 @@
 #include <string>
 #include <memory>
 #include <mutex>
+#include <unordered_set>
 #include <vector>
 
 #include "device_manager_callback.h"
@@ -27,6 +28,13 @@
 
 namespace OHOS {
 namespace DistributedHardware {
+struct TrustedDevice {
+    std::string networkId;
+    std::string uuid;
+    std::string udid;
+    uint16_t deviceType;
+};
+
 class AccessManager : public std::enable_shared_from_this<AccessManager>,
     public DmInitCallback,
     public DeviceStateCallback,
@@ -59,7 +67,13 @@ private:
     int32_t InitDeviceManager();
     int32_t UnInitDeviceManager();
     int32_t RegDevTrustChangeCallback();
+    std::vector<TrustedDevice> ResolveTrustedDevices(const std::vector<DmDeviceInfo> &deviceList);
+    void SubmitTrustedDeviceOnline(const std::vector<TrustedDevice> &devices, int64_t startTime);
+    /* Return true and forget the uuid if its seeded online task has not run yet */
+    bool TakePendingSeededDevice(const std::string &uuid);
     std::mutex accessMutex_;
+    std::mutex seededMutex_;
+    std::unordered_set<std::string> pendingSeededUuids_;
 };
 } // namespace DistributedHardware
 } // namespace OHOS
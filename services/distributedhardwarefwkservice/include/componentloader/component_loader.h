@@ -18,6 +18,7 @@
 
 #include <atomic>
 #include <map>
+#include <mutex>
 #include <vector>
 
 #include "single_instance.h"
@@ -45,6 +46,8 @@ struct CompHandler {
     int32_t sinkSaId;
     void *hardwareHandler;
     std::vector<ResourceDesc> resourceDesc;
+    std::string sourceLoc;
+    std::string sinkLoc;
 };
 }
 
@@ -66,7 +69,7 @@ class ComponentLoader {
     DECLARE_SINGLE_INSTANCE_BASE(ComponentLoader);
 
 public:
-    ComponentLoader() : isLocalVersionInit_(false) {}
+    ComponentLoader() : isLocalVersionInit_(false), isLazyLoad_(false) {}
     ~ComponentLoader() {}
 
 public:
@@ -83,10 +86,13 @@ public:
     int32_t GetSourceSaId(const DHType dhType);
     DHType GetDHTypeBySrcSaId(const int32_t saId);
     std::map<std::string, bool> GetCompResourceDesc();
+    /* so name -> dlopen cost in ms of the libraries loaded so far */
+    std::map<std::string, int64_t> GetSoLoadCosts();
 
 private:
     void *GetHandler(const std::string &soName);
     void GetAllHandler(std::map<DHType, CompConfig> &dhtypeMap);
+    void LoadCompHandler(CompHandler &compHandler, const CompConfig &config, bool isLazyLoad);
     int32_t ReleaseHandler(void *&handler);
     int32_t GetCompPathAndVersion(const std::string &jsonStr, std::map<DHType, CompConfig> &dhtypeMap);
     CompVersion GetCompVersionFromComConfig(const CompConfig& cCfg);
@@ -103,6 +109,11 @@ private:
     std::map<DHType, CompHandler> compHandlerMap_;
     std::atomic<bool> isLocalVersionInit_;
     std::map<std::string, bool> resDescMap_;
+    /* In lazy load mode the source and sink libraries are only loaded on the first GetSource/GetSink */
+    std::atomic<bool> isLazyLoad_;
+    std::mutex compHandlerMutex_;
+    std::mutex soLoadCostMutex_;
+    std::map<std::string, int64_t> soLoadCosts_;
 };
 } // namespace DistributedHardware
 } // namespace OHOS
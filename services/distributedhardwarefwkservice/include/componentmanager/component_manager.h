@@ -17,6 +17,7 @@
 #define OHOS_DISTRIBUTED_HARDWARE_COMPONENT_MANAGER_H
 
 #include <atomic>
+#include <functional>
 #include <map>
 #include <set>
 #include <unordered_map>
@@ -24,6 +25,7 @@
 #include <future>
 
 #include "single_instance.h"
+#include "thread_pool.h"
 #include "component_monitor.h"
 #include "capability_info.h"
 #include "device_type.h"
@@ -42,7 +44,15 @@
 
 namespace OHOS {
 namespace DistributedHardware {
-using ActionResult = std::unordered_map<DHType, std::shared_future<int32_t>>;
+/*
+ * Result of a component lifecycle call. A start call is skipped if it is cancelled before it starts running,
+ * stop and release calls are never cancelled.
+ */
+struct ActionTask {
+    std::shared_future<int32_t> result;
+    std::shared_ptr<std::atomic<bool>> isCancelled;
+};
+using ActionResult = std::unordered_map<DHType, ActionTask>;
 class ComponentManager {
     DECLARE_SINGLE_INSTANCE_BASE(ComponentManager);
 
@@ -104,6 +114,7 @@ private:
     ActionResult StartSink(DHType dhType);
     ActionResult StopSink();
     bool WaitForResult(const Action &action, ActionResult result);
+    ActionTask SubmitAction(const Action &action, DHType dhType, std::function<int32_t()> func);
     int32_t GetEnableParam(const std::string &networkId, const std::string &uuid, const std::string &dhId,
         DHType dhType, EnableParam &param);
     int32_t GetVersionFromVerMgr(const std::string &uuid, const DHType dhType, std::string &version, bool isSink);
@@ -149,6 +160,8 @@ private:
     sptr<LowLatencyListener> lowLatencyListener_ = nullptr;
 
     std::atomic<bool> isUnInitTimeOut_;
+    // runs the component lifecycle calls, which may block long, apart from the ffrt workers waiting on them
+    OHOS::ThreadPool actionPool_;
     // record the remote device business state, {{deviceUUID, dhId}, BusinessState}.
     std::map<std::pair<std::string, std::string>, BusinessState> dhBizStates_;
     std::mutex bizStateMtx_;
@@ -33,6 +33,12 @@ public:
     bool IsInit();
     int32_t SendOnLineEvent(const std::string &networkId, const std::string &uuid, const std::string &udid,
         uint16_t deviceType);
+    /*
+     * The device is already saved to DHContext and marked real time online by the caller,
+     * such as the trusted device bootstrap
+     */
+    int32_t SendSeededOnLineEvent(const std::string &networkId, const std::string &uuid, const std::string &udid,
+        uint16_t deviceType);
     int32_t SendOffLineEvent(const std::string &networkId, const std::string &uuid, const std::string &udid,
         uint16_t deviceType);
     int32_t GetComponentVersion(std::unordered_map<DHType, std::string> &versionMap);
@@ -45,6 +51,8 @@ private:
     bool Init();
     void CheckExitSAOrNot();
     void ExitDHFWK();
+    int32_t DoOnLineEvent(const std::string &networkId, const std::string &uuid, const std::string &udid,
+        uint16_t deviceType);
 
 private:
     std::atomic<bool> isInit_ = false;
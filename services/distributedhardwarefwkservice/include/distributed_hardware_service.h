@@ -16,6 +16,9 @@
 #ifndef OHOS_DISTRIBUTED_HARDWARE_SERVICE_H
 #define OHOS_DISTRIBUTED_HARDWARE_SERVICE_H
 
+#include <array>
+#include <mutex>
+
 #include "event_handler.h"
 #include "ipc_object_stub.h"
 #include "system_ability.h"
@@ -60,6 +63,7 @@ protected:
 private:
     bool Init();
     std::string QueryDhSysSpec(const std::string &targetKey, std::string &attrs);
+    std::string QueryLocalSysSpecInner(const QueryLocalSysSpecType spec, const std::string &deviceId);
     void InitLocalDevInfo();
     bool DoBusinessInit();
     bool IsDepSAStart();
@@ -68,6 +72,16 @@ private:
     bool registerToService_ = false;
     ServiceRunningState state_ = ServiceRunningState::STATE_NOT_START;
     std::shared_ptr<OHOS::AppExecFwk::EventHandler> eventHandler_ = nullptr;
+
+    /* Answer of QueryLocalSysSpec, valid while the local capability version stays the same */
+    struct SysSpecCacheEntry {
+        bool isValid = false;
+        std::string deviceId;
+        uint64_t capVersion = 0;
+        std::string sysSpec;
+    };
+    std::mutex sysSpecCacheMtx_;
+    std::array<SysSpecCacheEntry, static_cast<size_t>(QueryLocalSysSpecType::MAX)> sysSpecCache_;
 };
 } // namespace DistributedHardware
 } // namespace OHOS
@@ -16,8 +16,12 @@
 #ifndef OHOS_DISTRIBUTED_HARDWARE_LOCAL_HARDWARE_MANAGER_H
 #define OHOS_DISTRIBUTED_HARDWARE_LOCAL_HARDWARE_MANAGER_H
 
+#include <atomic>
+#include <condition_variable>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
 #include <vector>
 
 #include "capability_info.h"
@@ -28,6 +32,13 @@
 
 namespace OHOS {
 namespace DistributedHardware {
+struct CapabilityInfoDiff {
+    std::vector<std::shared_ptr<CapabilityInfo>> added;
+    std::vector<std::shared_ptr<CapabilityInfo>> changed;
+    std::vector<std::shared_ptr<CapabilityInfo>> unchanged;
+    std::vector<std::string> removedKeys;
+};
+
 class LocalHardwareManager {
     DECLARE_SINGLE_INSTANCE_BASE(LocalHardwareManager);
 
@@ -38,18 +49,34 @@ public:
     void UnInit();
 
 private:
-    void QueryLocalHardware(const DHType dhType, IHardwareHandler *hardwareHandler);
+    void DiscoverLocalHardware(const DHType dhType, int64_t deadline, uint64_t generation);
+    /* Retries until dhItems are found or the deadline(ms, 0 for none) passes */
+    void QueryLocalHardware(const DHType dhType, IHardwareHandler *hardwareHandler, int64_t deadline = 0);
+    bool IsDiscoveryStopped(uint64_t generation);
+    void FinishDiscovery();
+    void PublishLocalHardware(const DHType dhType);
     void AddLocalCapabilityInfo(const std::vector<DHItem> &dhItems, const DHType dhType,
                                 std::vector<std::shared_ptr<CapabilityInfo>> &capabilityInfos);
     void AddLocalMetaCapInfo(const std::vector<DHItem> &dhItems, const DHType dhType,
         std::vector<std::shared_ptr<MetaCapabilityInfo>> &metaCapInfos);
-    void CheckNonExistCapabilityInfo(const std::vector<DHItem> &dhItems, const DHType dhType);
+    /* Syncs the stored local capabilities of dhType with the queried ones, stale records are removed */
+    void ReconcileCapabilityInfo(const std::vector<DHItem> &dhItems, const DHType dhType);
+    void DiffCapabilityInfo(const std::vector<std::shared_ptr<CapabilityInfo>> &capabilityInfos,
+        const CapabilityInfoMap &storedCapInfos, CapabilityInfoDiff &diff);
     void GetLocalCapabilityMapByPrefix(const DHType dhType, CapabilityInfoMap &capabilityInfoMap);
 
 private:
+    /* Discovery of each DHType runs concurrently, guards the maps below */
+    std::mutex localHardwareMutex_;
     std::map<DHType, IHardwareHandler*> compToolFuncsMap_;
     std::map<DHType, std::shared_ptr<PluginListener>> pluginListenerMap_;
     std::unordered_map<DHType, std::vector<DHItem>> localDHItemsMap_;
+
+    /* A discovery task outliving Init stops once UnInit moves the generation on, UnInit waits for it to return */
+    std::atomic<uint64_t> discoveryGeneration_ {0};
+    std::mutex discoveryMutex_;
+    std::condition_variable discoveryCond_;
+    uint32_t runningDiscoveryCount_ = 0;
 };
 } // namespace DistributedHardware
 } // namespace OHOS
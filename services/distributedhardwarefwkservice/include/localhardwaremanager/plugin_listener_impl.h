@@ -16,21 +16,58 @@
 #ifndef OHOS_DISTRIBUTED_HARDWARE_PLUGIN_LISTENER_IMPL_H
 #define OHOS_DISTRIBUTED_HARDWARE_PLUGIN_LISTENER_IMPL_H
 
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
 #include "device_type.h"
 #include "ihardware_handler.h"
 
 namespace OHOS {
 namespace DistributedHardware {
-class PluginListenerImpl : public PluginListener {
+struct PluginEvent {
+    bool isPlugin;
+    std::string attrs;
+    std::string subtype;
+};
+
+struct PluginBatchStats {
+    uint64_t batchCount = 0;
+    uint64_t eventCount = 0;
+    uint32_t lastBatchSize = 0;
+    uint32_t maxBatchSize = 0;
+};
+
+/*
+ * Plug and unplug events of one DHType are coalesced within a window, the last event of each dhId wins.
+ * Each batch makes one capability update and one publish, a window of 0 handles every event at once.
+ */
+class PluginListenerImpl : public PluginListener, public std::enable_shared_from_this<PluginListenerImpl> {
 public:
-    explicit PluginListenerImpl(const DHType type) : dhType_(type) {}
+    explicit PluginListenerImpl(const DHType type);
     virtual ~PluginListenerImpl() = default;
 
     virtual void PluginHardware(const std::string &dhId, const std::string &attrs, const std::string &subtype) override;
     virtual void UnPluginHardware(const std::string &dhId) override;
+    void FlushPendingEvents();
+    PluginBatchStats GetBatchStats();
+
+private:
+    void AddPendingEvent(const std::string &dhId, const PluginEvent &event);
+    bool SchedulePendingEventsFlush();
+    void PublishPluginMessage(const std::vector<std::string> &dhIds);
 
 private:
     DHType dhType_;
+    int32_t coalesceWindowMs_;
+    std::mutex eventMutex_;
+    std::map<std::string, PluginEvent> pendingEvents_;
+    bool isFlushScheduled_ = false;
+    PluginBatchStats batchStats_;
+    // serializes the flushes so the batches are applied in the order they were taken
+    std::mutex flushMutex_;
 };
 } // namespace DistributedHardware
 } // namespace OHOS
@@ -19,6 +19,8 @@
 #include <condition_variable>
 #include <map>
 #include <set>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "kvstore_observer.h"
 
@@ -54,6 +56,8 @@ public:
     int32_t RemoveCapabilityInfoInDB(const std::string &deviceId);
     /* Deleting Database Records by key */
     int32_t RemoveCapabilityInfoByKey(const std::string &key);
+    /* Removes the keys in batches of at most MAX_DB_RECORD_SIZE, fails if any batch fails */
+    int32_t RemoveCapabilityInfoByKeys(const std::vector<std::string> &keys);
     /* Delete data from memory cache */
     int32_t RemoveCapabilityInfoInMem(const std::string &deviceId);
     /* Queries distributed hardware information based on filter criteria. */
@@ -64,6 +68,8 @@ public:
     bool HasCapability(const std::string &deviceId, const std::string &dhId);
     void GetCapabilitiesByDeviceId(const std::string &deviceId,
         std::vector<std::shared_ptr<CapabilityInfo>> &resInfos);
+    /* Version of the in-memory capabilities of the device, changes whenever any of them is added or removed */
+    uint64_t GetDeviceCapabilityVersion(const std::string &deviceId);
 
     /* Queries capability information based on deviceId and dhId. */
     int32_t GetCapability(const std::string &deviceId, const std::string &dhId,
@@ -96,11 +102,29 @@ private:
     void HandleCapabilityUpdateChange(const std::vector<DistributedKv::Entry> &updateRecords);
     void HandleCapabilityDeleteChange(const std::vector<DistributedKv::Entry> &deleteRecords);
     std::vector<DistributedKv::Entry> GetEntriesByKeys(const std::vector<std::string> &keys);
+    /* The following helpers keep globalCapInfoMap_ and its indexes consistent, call them with the lock held */
+    void PutCapabilityInMem(const std::shared_ptr<CapabilityInfo> &capInfo);
+    void EraseCapabilityInMem(const std::string &key);
+    void EraseDeviceCapabilitiesInMem(const std::string &deviceId);
+    void AddCapabilityIndex(const std::shared_ptr<CapabilityInfo> &capInfo);
+    void RemoveCapabilityIndex(const std::shared_ptr<CapabilityInfo> &capInfo);
+    void UpdateDeviceCapabilityVersion(const std::string &deviceId);
+    void GetKeysByDeviceId(const std::string &deviceId, std::vector<std::string> &keys);
+    bool GetCandidateKeysByFilters(const std::map<CapabilityInfoFilter, std::string> &filters,
+        std::vector<std::string> &keys);
 
 private:
+    using CapabilityKeySet = std::unordered_set<std::string>;
     mutable std::mutex capInfoMgrMutex_;
     std::shared_ptr<DBAdapter> dbAdapterPtr_;
     CapabilityInfoMap globalCapInfoMap_;
+    /* deviceId -> dhType -> capability keys, serves both deviceId and (deviceId, dhType) lookups */
+    std::unordered_map<std::string, std::unordered_map<DHType, CapabilityKeySet>> deviceIdIndex_;
+    /* dhType -> capability keys */
+    std::unordered_map<DHType, CapabilityKeySet> dhTypeIndex_;
+    /* deviceId -> capability version, kept after the device capabilities are erased so versions never repeat */
+    std::unordered_map<std::string, uint64_t> deviceCapVersions_;
+    uint64_t capVersionSeq_ = 0;
 
     std::shared_ptr<CapabilityInfoManager::CapabilityInfoManagerEventHandler> eventHandler_;
 };
@@ -47,11 +47,18 @@ public:
     int32_t GetDataByKeyPrefix(const std::string &keyPrefix, std::vector<std::string> &values);
     int32_t PutData(const std::string &key, const std::string &value);
     int32_t PutDataBatch(const std::vector<std::string> &keys, const std::vector<std::string> &values);
+    /*
+     * Write-behind put, the value is skipped if it matches the digest of the last known value of the key,
+     * otherwise it is kept dirty and flushed with PutDataBatch once enough entries or time accumulate.
+     */
+    int32_t PutDataDeferred(const std::string &key, const std::string &value);
+    int32_t FlushDirtyData();
     void SyncDBForRecover();
     virtual void OnRemoteDied() override;
     void DeleteKvStore();
     int32_t RemoveDeviceData(const std::string &deviceId);
     int32_t RemoveDataByKey(const std::string &key);
+    int32_t RemoveDataBatch(const std::vector<std::string> &keys);
     std::vector<DistributedKv::Entry> GetEntriesByKeys(const std::vector<std::string> &keys);
     bool SyncDataByNetworkId(const std::string &networkId);
     bool ClearDataWhenPeerLogout(const std::string &peerudid, const std::string &peeruuid);
@@ -68,6 +75,11 @@ private:
     bool DBDiedOpt(int32_t &times);
     void SyncByNotFound(const std::string &key);
     std::string GetNetworkIdByKey(const std::string &key);
+    int32_t PutDataBatchInner(const std::vector<std::string> &keys, const std::vector<std::string> &values);
+    /* The following helpers are called with writeBehindMutex_ held */
+    int32_t FlushDirtyDataInner();
+    void ScheduleDirtyDataFlush();
+    void UpdateValueDigest(const std::string &key, const std::string &value);
 
 private:
     DistributedKv::AppId appId_;
@@ -78,6 +90,16 @@ private:
     std::mutex dbAdapterMutex_;
     bool isAutoSync_ {false};
     DistributedKv::DataType dataType_ {DistributedKv::DataType::TYPE_DYNAMICAL};
+
+    /* Lock order: writeBehindMutex_ before dbAdapterMutex_ */
+    std::mutex writeBehindMutex_;
+    /* key -> hash of the value last written to or read from the kv store */
+    std::unordered_map<std::string, size_t> valueDigests_;
+    /* key -> value not flushed to the kv store yet */
+    std::map<std::string, std::string> dirtyEntries_;
+    bool isFlushScheduled_ {false};
+    /* failed flushes in a row, the retry delay doubles with each */
+    uint32_t flushRetryTimes_ {0};
 };
 } // namespace DistributedHardware
 } // namespace OHOS
@@ -16,6 +16,7 @@
 #ifndef OHOS_DISTRIBUTED_HARDWARE_TASK_H
 #define OHOS_DISTRIBUTED_HARDWARE_TASK_H
 
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <set>
@@ -54,6 +55,10 @@ public:
     const std::weak_ptr<Task> GetFatherTask();
     void SetFatherTask(std::shared_ptr<Task> fatherTask);
 
+    /* The callback runs once when the task body finishes, which may be after DoTask has returned */
+    void SetFinishCallback(std::function<void()> finishCallback);
+    void NotifyTaskFinish();
+
 private:
     std::string id_;
     // the remote device networkid
@@ -72,6 +77,7 @@ private:
 
     std::mutex taskMtx_;
     std::vector<std::shared_ptr<Task>> childrenTasks_;
+    std::function<void()> finishCallback_;
 
     TaskState taskState_ { TaskState::INIT };
 };
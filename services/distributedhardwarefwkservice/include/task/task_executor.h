@@ -16,31 +16,79 @@
 #ifndef OHOS_DISTRIBUTED_HARDWARE_TASK_EXECUTOR_H
 #define OHOS_DISTRIBUTED_HARDWARE_TASK_EXECUTOR_H
 
+#include <atomic>
 #include <condition_variable>
+#include <deque>
 #include <mutex>
-#include <queue>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
 #include "task.h"
 #include "single_instance.h"
 
 namespace OHOS {
 namespace DistributedHardware {
+/*
+ * Tasks of one device run one at a time in push order, a task keeps its device busy until its body finishes.
+ * Only the children of the running task, such as the disable tasks an offline task waits for, run inside it.
+ * Between devices, the device whose next task has the higher priority goes first: offline and disable ahead
+ * of online, and online ahead of enable.
+ */
+enum class TaskPriority : uint32_t {
+    HIGH = 0,
+    NORMAL = 1,
+    LOW = 2,
+    MAX = 3
+};
+
+struct TaskExecutorStats {
+    uint32_t queueDepth = 0;
+    uint32_t maxQueueDepth = 0;
+    uint64_t pushedCount = 0;
+    uint64_t rejectedCount = 0;
+    uint64_t executedCount = 0;
+    int64_t totalWaitTimeMs = 0;
+    int64_t maxWaitTimeMs = 0;
+};
+
 class TaskExecutor {
 DECLARE_SINGLE_INSTANCE_BASE(TaskExecutor);
 public:
     explicit TaskExecutor();
     ~TaskExecutor();
-    void PushTask(const std::shared_ptr<Task> task);
+    /* Returns ERR_DH_FWK_TASK_QUEUE_FULL when the task is rejected by backpressure, the task is then finished. */
+    int32_t PushTask(const std::shared_ptr<Task> task);
+    TaskExecutorStats GetStats();
 
 private:
+    struct TaskItem {
+        std::shared_ptr<Task> task;
+        TaskPriority priority;
+        uint64_t seq;
+        int64_t enqueueTime;
+    };
+    static TaskPriority GetTaskPriority(const std::shared_ptr<Task> &task);
+    static bool IsAheadOf(const TaskItem &item, const TaskItem &other);
+    void RejectTask(const std::shared_ptr<Task> &task);
+    std::deque<TaskItem>::iterator FindReadyTask(const std::string &uuid, std::deque<TaskItem> &lane);
+    bool PopReadyTask(TaskItem &item);
     std::shared_ptr<Task> PopTask();
+    void FinishTask(const std::shared_ptr<Task> &task);
     void TriggerTask();
 
 private:
-    std::queue<std::shared_ptr<Task>> taskQueue_;
+    /* Pending tasks of each device by uuid, in push order */
+    std::unordered_map<std::string, std::deque<TaskItem>> deviceLanes_;
+    /* Ids of the running tasks of each device by uuid, a later one is a child of the one before it */
+    std::unordered_map<std::string, std::vector<std::string>> runningTasks_;
+    uint32_t queueDepth_ = 0;
+    TaskExecutorStats stats_;
     std::mutex taskQueueMtx_;
     std::condition_variable condVar_;
-    bool taskThreadFlag_;
+    std::atomic<bool> taskThreadFlag_;
+    std::vector<std::thread> workers_;
 };
 } // namespace DistributedHardware
 } // namespace OHOS
@@ -17,7 +17,10 @@
 #define OHOS_DISTRIBUTED_HARDWARE_COMM_TOOL_H
 
 #include <cstdint>
+#include <mutex>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 #include <memory>
 
@@ -48,7 +51,8 @@ public:
      * @param remoteNetworkId the target device network id
      */
     void TriggerReqFullDHCaps(const std::string &remoteNetworkId);
-    void GetAndSendLocalFullCaps(const std::string &reqNetworkId);
+    /* reply only the caps changed against capsDigest if the requester carries one, else reply full caps */
+    void GetAndSendLocalFullCaps(const std::string &reqNetworkId, const std::string &capsDigest = "");
     FullCapsRsp ParseAndSaveRemoteDHCaps(const std::string &remoteCaps);
 
     class DHCommToolEventHandler : public AppExecFwk::EventHandler {
@@ -64,9 +68,16 @@ public:
     std::shared_ptr<DHCommTool::DHCommToolEventHandler> GetEventHandler();
     const std::shared_ptr<DHTransport> GetDHTransportPtr();
 
+private:
+    /* keep only the removed keys the responder owns and our digest carried, then disable and remove them */
+    void RemoveRemoteDHCaps(FullCapsRsp &capsRsp);
+
 private:
     std::shared_ptr<DHTransport> dhTransportPtr_;
     std::shared_ptr<DHCommTool::DHCommToolEventHandler> eventHandler_;
+    std::mutex reqDigestMtx_;
+    /* keys carried in the caps digest of the pending request, by remote networkId */
+    std::unordered_map<std::string, std::unordered_set<std::string>> reqDigestKeys_;
 };
 } // DistributedHardware
 } // OHOS
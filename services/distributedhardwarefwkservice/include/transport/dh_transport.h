@@ -29,6 +29,7 @@
 namespace OHOS {
 namespace DistributedHardware {
 class DHCommTool;
+class DHCompressor;
 class DHTransport {
 public:
     explicit DHTransport(std::shared_ptr<DHCommTool> dhCommToolPtr);
@@ -50,7 +51,9 @@ private:
     bool IsDeviceSessionOpened(const std::string &remoteDevId, int32_t &socketId);
     std::string GetRemoteNetworkIdBySocketId(int32_t socketId);
     void ClearDeviceSocketOpened(const std::string &remoteDevId);
-    void HandleReceiveMessage(const std::string &payload);
+    void HandleReceiveMessage(const std::string &rawPayload);
+    std::shared_ptr<DHCompressor> GetSocketCompressor(int32_t socketId);
+    void RemoveSocketCompressor(int32_t socketId);
 
 private:
     std::mutex rmtSocketIdMtx_;
@@ -60,6 +63,11 @@ private:
     std::string localSocketName_;
     std::atomic<bool> isSocketSvrCreateFlag_;
     std::weak_ptr<DHCommTool> dhCommToolWPtr_;
+    std::mutex compressorMtx_;
+    // reuse the zlib streams for the lifetime of the socket, <socketId, compressor>
+    std::map<int32_t, std::shared_ptr<DHCompressor>> socketCompressors_;
+    // compress with the preset dictionary, only if all peers accept it
+    std::atomic<bool> compressDictEnable_;
 };
 } // DistributedHardware
 } // OHOS
@@ -18,6 +18,7 @@
 
 #include <cstdint>
 #include <string>
+#include <unordered_map>
 #include <cJSON.h>
 
 #include "capability_info.h"
@@ -28,25 +29,50 @@ const char* const CAPS_RSP_NETWORKID_KEY = "networkId";
 const char* const CAPS_RSP_CAPS_KEY = "caps";
 const char* const COMM_MSG_CODE_KEY = "code";
 const char* const COMM_MSG_MSG_KEY = "msg";
+const char* const COMM_MSG_CAPS_DIGEST_KEY = "capsDigest";
+const char* const CAPS_RSP_IS_DELTA_KEY = "isDelta";
+const char* const CAPS_RSP_REMOVED_KEYS_KEY = "removedKeys";
 
 struct FullCapsRsp {
     // the networkd id of rsp from which device
     std::string networkId;
-    // the full dh caps
+    // the full dh caps, or only the changed caps if isDelta
     std::vector<std::shared_ptr<CapabilityInfo>> caps;
-    FullCapsRsp() : networkId(""), caps({}) {}
+    // true if the rsp answers a digest, caps absent from the rsp and removedKeys are unchanged
+    bool isDelta;
+    // keys of the requester digest which no longer exist on the rsp device
+    std::vector<std::string> removedKeys;
+    FullCapsRsp() : networkId(""), caps({}), isDelta(false), removedKeys({}) {}
     FullCapsRsp(std::string networkId, std::vector<std::shared_ptr<CapabilityInfo>> caps) : networkId(networkId),
-        caps(caps) {}
+        caps(caps), isDelta(false), removedKeys({}) {}
 };
 
 void ToJson(cJSON *jsonObject, const FullCapsRsp &capsRsp);
 void FromJson(const cJSON *jsonObject, FullCapsRsp &capsRsp);
 
+struct CapsDigest {
+    // capability key -> sha256 of the capability json
+    std::unordered_map<std::string, std::string> hashes;
+};
+
+void ToJson(cJSON *jsonObject, const CapsDigest &capsDigest);
+void FromJson(const cJSON *jsonObject, CapsDigest &capsDigest);
+
+std::string GetCapabilityHash(const std::shared_ptr<CapabilityInfo> &cap);
+std::string GetCapsDigestString(const std::vector<std::shared_ptr<CapabilityInfo>> &caps);
+/* Fill the caps whose hash differs from the digest and the digest keys which are gone into a delta rsp */
+void GetDeltaCaps(const CapsDigest &capsDigest, const std::vector<std::shared_ptr<CapabilityInfo>> &localCaps,
+    FullCapsRsp &capsRsp);
+
 struct CommMsg {
     int32_t code;
     std::string msg;
-    CommMsg() : code(-1), msg("") {}
-    CommMsg(int32_t code, std::string msg) : code(code), msg(msg) {}
+    // optional, digest of the caps the requester already holds, ignored by the peer of old version
+    std::string capsDigest;
+    CommMsg() : code(-1), msg(""), capsDigest("") {}
+    CommMsg(int32_t code, std::string msg) : code(code), msg(msg), capsDigest("") {}
+    CommMsg(int32_t code, std::string msg, std::string capsDigest) : code(code), msg(msg),
+        capsDigest(capsDigest) {}
 };
 
 void ToJson(cJSON *jsonObject, const CommMsg &commMsg);
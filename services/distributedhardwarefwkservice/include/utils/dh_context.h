@@ -20,7 +20,9 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
+#include <vector>
 #include <shared_mutex>
 
 #ifdef POWER_MANAGER_ENABLE
@@ -66,6 +68,19 @@ struct DeviceIdEntry {
     }
 };
 
+/**
+ * Immutable snapshot of the online devices. Writers build a new table and publish it atomically,
+ * readers load the current table without taking any lock and look it up through the hash indexes.
+ */
+struct DeviceIdTable {
+    std::set<DeviceIdEntry> entries;
+    std::unordered_map<std::string, const DeviceIdEntry *> networkIdIndex;
+    std::unordered_map<std::string, const DeviceIdEntry *> uuidIndex;
+    std::unordered_map<std::string, const DeviceIdEntry *> udidIndex;
+    std::unordered_map<std::string, const DeviceIdEntry *> udidHashIndex;
+    std::unordered_map<std::string, const DeviceIdEntry *> deviceIdIndex;
+};
+
 class DHContext {
 DECLARE_SINGLE_INSTANCE_BASE(DHContext);
 public:
@@ -75,6 +90,11 @@ public:
 
     /* Save online device UUID and networkId when devices online */
     void AddOnlineDevice(const std::string &udid, const std::string &uuid, const std::string &networkId);
+    /*
+     * Save a batch of online devices with one table update and mark them real time online,
+     * only networkId, uuid and udid need to be set
+     */
+    size_t AddOnlineDevices(const std::vector<DeviceIdEntry> &idEntries);
     void RemoveOnlineDeviceIdEntryByNetworkId(const std::string &networkId);
     bool IsDeviceOnline(const std::string &uuid);
     size_t GetOnlineCount();
@@ -133,12 +153,17 @@ private:
         sptr<IRemoteObject> AsObject() override;
     };
     void RegisDHFWKIsomerismListener();
+    std::shared_ptr<const DeviceIdTable> GetDeviceIdTable() const;
+    void UpdateDeviceIdTable(std::set<DeviceIdEntry> &&entries);
+    static const DeviceIdEntry *FindDeviceIdEntry(
+        const std::unordered_map<std::string, const DeviceIdEntry *> &index, const std::string &key);
 private:
     DeviceInfo devInfo_ { "", "", "", "", "", "", 0 };
     std::mutex devMutex_;
 
-    std::set<DeviceIdEntry> devIdEntrySet_;
-    std::shared_mutex onlineDevMutex_;
+    /* Readers only load the snapshot, onlineDevMutex_ serializes the writers */
+    std::shared_ptr<const DeviceIdTable> devIdTable_ = std::make_shared<DeviceIdTable>();
+    std::mutex onlineDevMutex_;
 
     std::set<std::string> realTimeOnLineNetworkIdSet_;
     std::shared_mutex realTimeNetworkIdMutex_;
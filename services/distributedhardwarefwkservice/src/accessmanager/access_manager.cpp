@@ -15,11 +15,14 @@
 
 #include "access_manager.h"
 
+#include <atomic>
+#include <cinttypes>
 #include <new>
 #include <unistd.h>
 #include <vector>
 
 #include "device_manager.h"
+#include "ffrt.h"
 
 #include "anonymous_string.h"
 #include "constants.h"
@@ -36,6 +39,16 @@ namespace DistributedHardware {
 
 constexpr int32_t DH_RETRY_INIT_DM_COUNT = 6;
 constexpr int32_t DH_RETRY_INIT_DM_INTERVAL_US = 1000 * 500;
+constexpr size_t TRUSTED_ONLINE_BATCH_SIZE = 4;
+constexpr uint64_t TRUSTED_ONLINE_BATCH_INTERVAL_US = 1000 * 100;
+namespace {
+    struct ResolveProgress {
+        ffrt::mutex mutex;
+        ffrt::condition_variable cond;
+        std::vector<TrustedDevice> devices;
+        size_t finishedCount = 0;
+    };
+}
 AccessManager::~AccessManager()
 {
     UnInit();
@@ -68,6 +81,10 @@ int32_t AccessManager::Init()
 int32_t AccessManager::UnInit()
 {
     DHLOGI("start");
+    {
+        std::lock_guard<std::mutex> lock(seededMutex_);
+        pendingSeededUuids_.clear();
+    }
     if (UnInitDeviceManager() != DH_FWK_SUCCESS) {
         DHLOGE("UnInitDeviceManager failed");
         return ERR_DH_FWK_ACCESS_UNINIT_DM_FAILED;
@@ -146,6 +163,14 @@ void AccessManager::OnDeviceOffline(const DmDeviceInfo &deviceInfo)
     if (!IsIdLengthValid(udid)) {
         return;
     }
+    if (TakePendingSeededDevice(uuid)) {
+        // the device was only seeded, it never went online, so there is nothing to offline
+        DHContext::GetInstance().RemoveOnlineDeviceIdEntryByNetworkId(networkId);
+        DHContext::GetInstance().DeleteRealTimeOnlineDeviceNetworkId(networkId);
+        DHLOGI("drop seeded device before online, networkId: %{public}s, uuid: %{public}s",
+            GetAnonyString(networkId).c_str(), GetAnonyString(uuid).c_str());
+        return;
+    }
 
     auto ret = DistributedHardwareManagerFactory::GetInstance().SendOffLineEvent(networkId, uuid, udid,
         deviceInfo.deviceTypeId);
@@ -202,21 +227,106 @@ void AccessManager::OnDeviceTrustChange(const std::string &peerudid, const std::
 
 void AccessManager::CheckTrustedDeviceOnline()
 {
+    int64_t startTime = GetCurrentTime();
     std::vector<DmDeviceInfo> deviceList;
     DeviceManager::GetInstance().GetTrustedDeviceList(DH_FWK_PKG_NAME, "", deviceList);
     if (deviceList.size() == 0 || deviceList.size() > MAX_ONLINE_DEVICE_SIZE) {
         DHLOGE("DeviceList size is invalid!");
         return;
     }
-    for (const auto &deviceInfo : deviceList) {
-        const auto networkId = std::string(deviceInfo.networkId);
-        const auto uuid = GetUUIDByDm(networkId);
-        const auto udid = GetUDIDByDm(networkId);
-        DHLOGI("Send trusted device online, networkId = %{public}s, uuid = %{public}s, udid = %{public}s",
-            GetAnonyString(networkId).c_str(), GetAnonyString(uuid).c_str(), GetAnonyString(udid).c_str());
-        DistributedHardwareManagerFactory::GetInstance().SendOnLineEvent(networkId, uuid, udid,
-            deviceInfo.deviceTypeId);
+    std::vector<TrustedDevice> devices = ResolveTrustedDevices(deviceList);
+    if (devices.empty()) {
+        DHLOGI("No trusted device need to online");
+        return;
+    }
+    std::vector<DeviceIdEntry> idEntries;
+    for (const auto &device : devices) {
+        idEntries.push_back(DeviceIdEntry { .networkId = device.networkId, .uuid = device.uuid, .udid = device.udid });
+    }
+    size_t seededCount = DHContext::GetInstance().AddOnlineDevices(idEntries);
+    DHLOGI("Resolve trusted devices cost time: %{public}" PRId64 " ms, trusted: %{public}zu, seeded: %{public}zu",
+        GetCurrentTime() - startTime, deviceList.size(), seededCount);
+    SubmitTrustedDeviceOnline(devices, startTime);
+}
+
+std::vector<TrustedDevice> AccessManager::ResolveTrustedDevices(const std::vector<DmDeviceInfo> &deviceList)
+{
+    // the DeviceManager queries of each device run concurrently instead of one round-trip after another
+    auto progress = std::make_shared<ResolveProgress>();
+    progress->devices.resize(deviceList.size());
+    for (size_t i = 0; i < deviceList.size(); i++) {
+        TrustedDevice device = { std::string(deviceList[i].networkId), "", "", deviceList[i].deviceTypeId };
+        ffrt::submit([device, i, progress]() mutable {
+            device.uuid = GetUUIDByDm(device.networkId);
+            device.udid = GetUDIDByDm(device.networkId);
+            std::lock_guard<ffrt::mutex> lock(progress->mutex);
+            progress->devices[i] = device;
+            progress->finishedCount++;
+            progress->cond.notify_all();
+        });
+    }
+    {
+        std::unique_lock<ffrt::mutex> lock(progress->mutex);
+        progress->cond.wait(lock, [&progress, &deviceList] { return progress->finishedCount == deviceList.size(); });
     }
+    std::vector<TrustedDevice> devices;
+    for (const auto &device : progress->devices) {
+        if (!IsIdLengthValid(device.uuid) || !IsIdLengthValid(device.udid)) {
+            DHLOGE("Resolve trusted device failed, networkId = %{public}s", GetAnonyString(device.networkId).c_str());
+            continue;
+        }
+        if (DHContext::GetInstance().IsDeviceOnline(device.uuid)) {
+            DHLOGW("device is already online, uuid = %{public}s", GetAnonyString(device.uuid).c_str());
+            continue;
+        }
+        devices.push_back(device);
+    }
+    return devices;
+}
+
+void AccessManager::SubmitTrustedDeviceOnline(const std::vector<TrustedDevice> &devices, int64_t startTime)
+{
+    // a few devices per interval, so the online tasks of all trusted devices do not start at the same time
+    auto remainCount = std::make_shared<std::atomic<size_t>>(devices.size());
+    auto successCount = std::make_shared<std::atomic<size_t>>(0);
+    size_t totalCount = devices.size();
+    {
+        std::lock_guard<std::mutex> lock(seededMutex_);
+        for (const auto &device : devices) {
+            pendingSeededUuids_.insert(device.uuid);
+        }
+    }
+    std::weak_ptr<AccessManager> weakSelf = shared_from_this();
+    for (size_t i = 0; i < devices.size(); i++) {
+        TrustedDevice device = devices[i];
+        uint64_t delayUs = static_cast<uint64_t>(i / TRUSTED_ONLINE_BATCH_SIZE) * TRUSTED_ONLINE_BATCH_INTERVAL_US;
+        ffrt::submit([weakSelf, device, remainCount, successCount, totalCount, startTime]() {
+            auto self = weakSelf.lock();
+            int32_t ret = ERR_DH_FWK_HARDWARE_MANAGER_DEVICE_REPEAT_OFFLINE;
+            if (self == nullptr || !self->TakePendingSeededDevice(device.uuid)) {
+                DHLOGW("seeded device is already offline, uuid = %{public}s", GetAnonyString(device.uuid).c_str());
+            } else {
+                DHLOGI("Send trusted device online, networkId = %{public}s, uuid = %{public}s, udid = %{public}s",
+                    GetAnonyString(device.networkId).c_str(), GetAnonyString(device.uuid).c_str(),
+                    GetAnonyString(device.udid).c_str());
+                ret = DistributedHardwareManagerFactory::GetInstance().SendSeededOnLineEvent(device.networkId,
+                    device.uuid, device.udid, device.deviceType);
+            }
+            if (ret == DH_FWK_SUCCESS) {
+                (*successCount)++;
+            }
+            if (--(*remainCount) == 0) {
+                DHLOGI("Trusted device online finished, total: %{public}zu, success: %{public}zu, cost time: "
+                    "%{public}" PRId64 " ms", totalCount, successCount->load(), GetCurrentTime() - startTime);
+            }
+        }, {}, {}, ffrt::task_attr().delay(delayUs));
+    }
+}
+
+bool AccessManager::TakePendingSeededDevice(const std::string &uuid)
+{
+    std::lock_guard<std::mutex> lock(seededMutex_);
+    return pendingSeededUuids_.erase(uuid) > 0;
 }
 
 int32_t AccessManager::Dump(const std::vector<std::string> &argsStr, std::string &result)
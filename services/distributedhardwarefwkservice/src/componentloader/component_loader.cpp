@@ -19,6 +19,7 @@
 #include <dlfcn.h>
 #include <fstream>
 #include <string>
+#include <thread>
 
 #include "config_policy_utils.h"
 
@@ -65,6 +66,7 @@ const std::string DEFAULT_TYPE = "UNKNOWN";
 const std::string DEFAULT_LOC = "";
 const int32_t DEFAULT_SA_ID = -1;
 const std::string DEFAULT_VERSION = "1.0";
+const std::string COMPONENT_LAZY_LOAD_PARAM = "sys.dhfwk.component.lazyload.enable";
 
 std::map<std::string, DHType> g_mapDhTypeName = {
     { "UNKNOWN", DHType::UNKNOWN },
@@ -91,9 +93,16 @@ int32_t ComponentLoader::Init()
 {
     DHLOGI("start");
     DHTraceStart(COMPONENT_LOAD_START);
+    int64_t startTime = GetCurrentTime();
+    bool isLazyLoad = false;
+    if (!GetSysPara(COMPONENT_LAZY_LOAD_PARAM.c_str(), isLazyLoad)) {
+        isLazyLoad = false;
+    }
+    isLazyLoad_.store(isLazyLoad);
     int32_t ret = ParseConfig();
     StoreLocalDHVersionInDB();
     DHTraceEnd();
+    DHLOGI("end, isLazyLoad: %{public}d, cost: %{public}" PRId64 " ms", isLazyLoad, GetCurrentTime() - startTime);
 
     return ret;
 }
@@ -372,6 +381,7 @@ void *ComponentLoader::GetHandler(const std::string &soName)
         DHLOGE("File canonicalization failed, soName: %{public}s", soName.c_str());
         return nullptr;
     }
+    int64_t startTime = GetCurrentTime();
     void *pHandler = dlopen(soName.c_str(), RTLD_LAZY | RTLD_NODELETE);
     if (pHandler == nullptr) {
         DHLOGE("so: %{public}s load failed, failed reason: %{public}s", soName.c_str(), dlerror());
@@ -379,31 +389,68 @@ void *ComponentLoader::GetHandler(const std::string &soName)
             "dhfwk so open failed, soname : " + soName);
         return nullptr;
     }
+    int64_t cost = GetCurrentTime() - startTime;
+    DHLOGI("so: %{public}s load cost: %{public}" PRId64 " ms", soName.c_str(), cost);
+    std::lock_guard<std::mutex> lock(soLoadCostMutex_);
+    soLoadCosts_[soName] = cost;
     return pHandler;
 }
 
+void ComponentLoader::LoadCompHandler(CompHandler &compHandler, const CompConfig &config, bool isLazyLoad)
+{
+    compHandler.hardwareHandler = GetHandler(config.compHandlerLoc);
+    if (isLazyLoad) {
+        return;
+    }
+    compHandler.sourceHandler = GetHandler(config.compSourceLoc);
+    compHandler.sinkHandler = GetHandler(config.compSinkLoc);
+}
+
 void ComponentLoader::GetAllHandler(std::map<DHType, CompConfig> &dhtypeMap)
 {
-    std::map<DHType, CompConfig>::iterator itor;
-    for (itor = dhtypeMap.begin(); itor != dhtypeMap.end(); ++itor) {
+    std::vector<CompHandler> compHandlers;
+    std::vector<const CompConfig *> compConfigs;
+    for (const auto &item : dhtypeMap) {
         CompHandler comHandler;
-        comHandler.type = itor->second.type;
-        comHandler.hardwareHandler = GetHandler(itor->second.compHandlerLoc);
-        comHandler.sourceHandler = GetHandler(itor->second.compSourceLoc);
-        comHandler.sourceSaId = itor->second.compSourceSaId;
-        comHandler.sinkHandler = GetHandler(itor->second.compSinkLoc);
-        comHandler.sinkSaId = itor->second.compSinkSaId;
-        std::vector<ResourceDesc> compResourceDesc = itor->second.compResourceDesc;
-        for (auto it = compResourceDesc.begin(); it != compResourceDesc.end(); it++) {
-            resDescMap_[it->subtype] = it->sensitiveValue;
+        comHandler.type = item.second.type;
+        comHandler.hardwareHandler = nullptr;
+        comHandler.sourceHandler = nullptr;
+        comHandler.sourceSaId = item.second.compSourceSaId;
+        comHandler.sourceLoc = item.second.compSourceLoc;
+        comHandler.sinkHandler = nullptr;
+        comHandler.sinkSaId = item.second.compSinkSaId;
+        comHandler.sinkLoc = item.second.compSinkLoc;
+        for (const auto &desc : item.second.compResourceDesc) {
+            resDescMap_[desc.subtype] = desc.sensitiveValue;
+        }
+        comHandler.resourceDesc = item.second.compResourceDesc;
+        compHandlers.push_back(comHandler);
+        compConfigs.push_back(&item.second);
+    }
+
+    // the libraries of different components are independent, dlopen them in parallel to cut the startup time
+    bool isLazyLoad = isLazyLoad_.load();
+    std::vector<std::thread> loadThreads;
+    for (size_t i = 0; i < compHandlers.size(); i++) {
+        loadThreads.emplace_back([this, &compHandlers, &compConfigs, i, isLazyLoad]() {
+            LoadCompHandler(compHandlers[i], *compConfigs[i], isLazyLoad);
+        });
+    }
+    for (auto &loadThread : loadThreads) {
+        if (loadThread.joinable()) {
+            loadThread.join();
         }
-        comHandler.resourceDesc = itor->second.compResourceDesc;
-        compHandlerMap_[itor->second.type] = comHandler;
+    }
+
+    std::lock_guard<std::mutex> lock(compHandlerMutex_);
+    for (const auto &comHandler : compHandlers) {
+        compHandlerMap_[comHandler.type] = comHandler;
     }
 }
 
 int32_t ComponentLoader::GetHardwareHandler(const DHType dhType, IHardwareHandler *&hardwareHandlerPtr)
 {
+    std::lock_guard<std::mutex> lock(compHandlerMutex_);
     if (compHandlerMap_.find(dhType) == compHandlerMap_.end()) {
         DHLOGE("DHType not exist, dhType: %{public}" PRIu32, (uint32_t)dhType);
         return ERR_DH_FWK_LOADER_HANDLER_IS_NULL;
@@ -428,11 +475,16 @@ int32_t ComponentLoader::GetHardwareHandler(const DHType dhType, IHardwareHandle
 
 int32_t ComponentLoader::GetSource(const DHType dhType, IDistributedHardwareSource *&sourcePtr)
 {
+    std::lock_guard<std::mutex> lock(compHandlerMutex_);
     if (compHandlerMap_.find(dhType) == compHandlerMap_.end()) {
         DHLOGE("DHType not exist, dhType: %{public}" PRIu32, (uint32_t)dhType);
         return ERR_DH_FWK_LOADER_HANDLER_IS_NULL;
     }
 
+    if (compHandlerMap_[dhType].sourceHandler == nullptr && isLazyLoad_.load()) {
+        compHandlerMap_[dhType].sourceHandler = GetHandler(compHandlerMap_[dhType].sourceLoc);
+    }
+
     if (compHandlerMap_[dhType].sourceHandler == nullptr) {
         DHLOGE("sourceHandler is null.");
         return ERR_DH_FWK_LOADER_HANDLER_IS_NULL;
@@ -452,11 +504,16 @@ int32_t ComponentLoader::GetSource(const DHType dhType, IDistributedHardwareSour
 
 int32_t ComponentLoader::GetSink(const DHType dhType, IDistributedHardwareSink *&sinkPtr)
 {
+    std::lock_guard<std::mutex> lock(compHandlerMutex_);
     if (compHandlerMap_.find(dhType) == compHandlerMap_.end()) {
         DHLOGE("DHType not exist, dhType: %{public}" PRIu32, (uint32_t)dhType);
         return ERR_DH_FWK_LOADER_HANDLER_IS_NULL;
     }
 
+    if (compHandlerMap_[dhType].sinkHandler == nullptr && isLazyLoad_.load()) {
+        compHandlerMap_[dhType].sinkHandler = GetHandler(compHandlerMap_[dhType].sinkLoc);
+    }
+
     if (compHandlerMap_[dhType].sinkHandler == nullptr) {
         DHLOGE("sinkHandler is null.");
         return ERR_DH_FWK_LOADER_HANDLER_IS_NULL;
@@ -549,7 +606,10 @@ int32_t ComponentLoader::UnInit()
         ret += ReleaseSource(iter->first);
         ret += ReleaseSink(iter->first);
     }
-    compHandlerMap_.clear();
+    {
+        std::lock_guard<std::mutex> lock(compHandlerMutex_);
+        compHandlerMap_.clear();
+    }
     resDescMap_.clear();
     DHTraceEnd();
     return ret;
@@ -557,6 +617,7 @@ int32_t ComponentLoader::UnInit()
 
 int32_t ComponentLoader::ReleaseHardwareHandler(const DHType dhType)
 {
+    std::lock_guard<std::mutex> lock(compHandlerMutex_);
     if (!IsDHTypeExist(dhType)) {
         return ERR_DH_FWK_TYPE_NOT_EXIST;
     }
@@ -571,9 +632,15 @@ int32_t ComponentLoader::ReleaseHardwareHandler(const DHType dhType)
 
 int32_t ComponentLoader::ReleaseSource(const DHType dhType)
 {
+    std::lock_guard<std::mutex> lock(compHandlerMutex_);
     if (!IsDHTypeExist(dhType)) {
         return ERR_DH_FWK_TYPE_NOT_EXIST;
     }
+    if (compHandlerMap_[dhType].sourceHandler == nullptr && isLazyLoad_.load() &&
+        !compHandlerMap_[dhType].sourceLoc.empty()) {
+        DHLOGI("source not loaded yet, dhType: %{public}#X", dhType);
+        return DH_FWK_SUCCESS;
+    }
     int32_t ret = ReleaseHandler(compHandlerMap_[dhType].sourceHandler);
     if (ret) {
         DHLOGE("fail, dhType: %{public}#X", dhType);
@@ -585,9 +652,15 @@ int32_t ComponentLoader::ReleaseSource(const DHType dhType)
 
 int32_t ComponentLoader::ReleaseSink(const DHType dhType)
 {
+    std::lock_guard<std::mutex> lock(compHandlerMutex_);
     if (!IsDHTypeExist(dhType)) {
         return ERR_DH_FWK_TYPE_NOT_EXIST;
     }
+    if (compHandlerMap_[dhType].sinkHandler == nullptr && isLazyLoad_.load() &&
+        !compHandlerMap_[dhType].sinkLoc.empty()) {
+        DHLOGI("sink not loaded yet, dhType: %{public}#X", dhType);
+        return DH_FWK_SUCCESS;
+    }
     int32_t ret = ReleaseHandler(compHandlerMap_[dhType].sinkHandler);
     if (ret) {
         DHLOGE("fail, dhType: %{public}#X", dhType);
@@ -631,5 +704,11 @@ std::map<std::string, bool> ComponentLoader::GetCompResourceDesc()
 {
     return resDescMap_;
 }
+
+std::map<std::string, int64_t> ComponentLoader::GetSoLoadCosts()
+{
+    std::lock_guard<std::mutex> lock(soLoadCostMutex_);
+    return soLoadCosts_;
+}
 } // namespace DistributedHardware
 } // namespace OHOS
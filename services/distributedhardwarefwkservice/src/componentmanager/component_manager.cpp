@@ -19,7 +19,6 @@
 #include <future>
 #include <pthread.h>
 #include <string>
-#include <thread>
 
 #include "ffrt.h"
 #include "ipc_object_stub.h"
@@ -64,22 +63,26 @@ namespace {
     constexpr int32_t ENABLE_PARAM_RETRY_TIME = 500 * 1000;
     constexpr int32_t INVALID_SA_ID = -1;
     constexpr int32_t UNINIT_COMPONENT_TIMEOUT_SECONDS = 2;
+    constexpr int32_t ACTION_POOL_THREAD_NUM = 8;
     const std::string MONITOR_TASK_TIMER_ID = "monitor_task_timer_id";
 }
 
 ComponentManager::ComponentManager() : compSource_({}), compSink_({}), compSrcSaId_({}),
     compMonitorPtr_(std::make_shared<ComponentMonitor>()),
     lowLatencyListener_(sptr<LowLatencyListener>(new(std::nothrow) LowLatencyListener())),
-    isUnInitTimeOut_(false), dhBizStates_({}), dhStateListener_(std::make_shared<DHStateListener>()),
+    isUnInitTimeOut_(false), actionPool_("DHCompAction"), dhBizStates_({}),
+    dhStateListener_(std::make_shared<DHStateListener>()),
     dataSyncTriggerListener_(std::make_shared<DHDataSyncTriggerListener>()),
     dhCommToolPtr_(std::make_shared<DHCommTool>()), needRefreshTaskParams_({})
 {
     DHLOGI("Ctor ComponentManager");
+    actionPool_.Start(ACTION_POOL_THREAD_NUM);
 }
 
 ComponentManager::~ComponentManager()
 {
     DHLOGD("Dtor ComponentManager");
+    actionPool_.Stop();
     compMonitorPtr_.reset();
     compMonitorPtr_ = nullptr;
     lowLatencyListener_ = nullptr;
@@ -298,7 +301,7 @@ void ComponentManager::StopPrivacy()
 ActionResult ComponentManager::StartSource()
 {
     DHLOGI("start.");
-    std::unordered_map<DHType, std::shared_future<int32_t>> futures;
+    ActionResult futures;
     std::string uuid = DHContext::GetInstance().GetDeviceInfo().uuid;
     for (const auto &item : compSource_) {
         if (item.second == nullptr) {
@@ -308,12 +311,10 @@ ActionResult ComponentManager::StartSource()
         CompVersion compversion;
         VersionManager::GetInstance().GetCompVersion(uuid, item.first, compversion);
         auto params = compversion.sourceVersion;
-        std::promise<int32_t> p;
-        std::future<int32_t> f = p.get_future();
-        std::thread([p = std::move(p), item, params] () mutable {
-            p.set_value(item.second->InitSource(params));
-        }).detach();
-        futures.emplace(item.first, f.share());
+        IDistributedHardwareSource *sourcePtr = item.second;
+        futures.emplace(item.first, SubmitAction(Action::START_SOURCE, item.first, [sourcePtr, params]() {
+            return sourcePtr->InitSource(params);
+        }));
     }
     return futures;
 }
@@ -321,7 +322,7 @@ ActionResult ComponentManager::StartSource()
 ActionResult ComponentManager::StartSource(DHType dhType)
 {
     DHLOGI("Start Source, dhType: %{public}" PRIu32, (uint32_t)dhType);
-    std::unordered_map<DHType, std::shared_future<int32_t>> futures;
+    ActionResult futures;
     if (compSource_.find(dhType) == compSource_.end()) {
         DHLOGE("Component for DHType: %{public}" PRIu32 " not init source handler", (uint32_t)dhType);
         return futures;
@@ -334,12 +335,10 @@ ActionResult ComponentManager::StartSource(DHType dhType)
     CompVersion compVersion;
     VersionManager::GetInstance().GetCompVersion(uuid, dhType, compVersion);
     auto params = compVersion.sourceVersion;
-    std::promise<int32_t> p;
-    std::future<int32_t> f = p.get_future();
-    std::thread([p = std::move(p), this, dhType, params] () mutable {
-        p.set_value(compSource_[dhType]->InitSource(params));
-    }).detach();
-    futures.emplace(dhType, f.share());
+    IDistributedHardwareSource *sourcePtr = compSource_[dhType];
+    futures.emplace(dhType, SubmitAction(Action::START_SOURCE, dhType, [sourcePtr, params]() {
+        return sourcePtr->InitSource(params);
+    }));
 
     return futures;
 }
@@ -347,7 +346,7 @@ ActionResult ComponentManager::StartSource(DHType dhType)
 ActionResult ComponentManager::StartSink()
 {
     DHLOGI("start.");
-    std::unordered_map<DHType, std::shared_future<int32_t>> futures;
+    ActionResult futures;
     std::string uuid = DHContext::GetInstance().GetDeviceInfo().uuid;
     for (const auto &item : compSink_) {
         if (item.second == nullptr) {
@@ -357,12 +356,10 @@ ActionResult ComponentManager::StartSink()
         CompVersion compversion;
         VersionManager::GetInstance().GetCompVersion(uuid, item.first, compversion);
         auto params = compversion.sinkVersion;
-        std::promise<int32_t> p;
-        std::future<int32_t> f = p.get_future();
-        std::thread([p = std::move(p), item, params] () mutable {
-            p.set_value(item.second->InitSink(params));
-        }).detach();
-        futures.emplace(item.first, f.share());
+        IDistributedHardwareSink *sinkPtr = item.second;
+        futures.emplace(item.first, SubmitAction(Action::START_SINK, item.first, [sinkPtr, params]() {
+            return sinkPtr->InitSink(params);
+        }));
         if (cameraCompPrivacy_ == nullptr && item.first == DHType::CAMERA) {
             cameraCompPrivacy_ = std::make_shared<ComponentPrivacy>();
             item.second->RegisterPrivacyResources(cameraCompPrivacy_);
@@ -378,7 +375,7 @@ ActionResult ComponentManager::StartSink()
 ActionResult ComponentManager::StartSink(DHType dhType)
 {
     DHLOGI("Start Sink, dhType: %{public}" PRIu32, (uint32_t)dhType);
-    std::unordered_map<DHType, std::shared_future<int32_t>> futures;
+    ActionResult futures;
     if (compSink_.find(dhType) == compSink_.end()) {
         DHLOGE("Component for DHType: %{public}" PRIu32 " not init sink handler", (uint32_t)dhType);
         return futures;
@@ -391,12 +388,10 @@ ActionResult ComponentManager::StartSink(DHType dhType)
     CompVersion compVersion;
     VersionManager::GetInstance().GetCompVersion(uuid, dhType, compVersion);
     auto params = compVersion.sinkVersion;
-    std::promise<int32_t> p;
-    std::future<int32_t> f = p.get_future();
-    std::thread([p = std::move(p), this, dhType, params] () mutable {
-        p.set_value(compSink_[dhType]->InitSink(params));
-    }).detach();
-    futures.emplace(dhType, f.share());
+    IDistributedHardwareSink *sinkPtr = compSink_[dhType];
+    futures.emplace(dhType, SubmitAction(Action::START_SINK, dhType, [sinkPtr, params]() {
+        return sinkPtr->InitSink(params);
+    }));
     if (cameraCompPrivacy_ == nullptr && dhType == DHType::CAMERA) {
         cameraCompPrivacy_ = std::make_shared<ComponentPrivacy>();
         compSink_[dhType]->RegisterPrivacyResources(cameraCompPrivacy_);
@@ -412,18 +407,16 @@ ActionResult ComponentManager::StartSink(DHType dhType)
 ActionResult ComponentManager::StopSource()
 {
     DHLOGI("start.");
-    std::unordered_map<DHType, std::shared_future<int32_t>> futures;
+    ActionResult futures;
     for (const auto &item : compSource_) {
         if (item.second == nullptr) {
             DHLOGE("comp source ptr is null");
             continue;
         }
-        std::promise<int32_t> p;
-        std::future<int32_t> f = p.get_future();
-        std::thread([p = std::move(p), item] () mutable {
-            p.set_value(item.second->ReleaseSource());
-        }).detach();
-        futures.emplace(item.first, f.share());
+        IDistributedHardwareSource *sourcePtr = item.second;
+        futures.emplace(item.first, SubmitAction(Action::STOP_SOURCE, item.first, [sourcePtr]() {
+            return sourcePtr->ReleaseSource();
+        }));
     }
     return futures;
 }
@@ -431,38 +424,64 @@ ActionResult ComponentManager::StopSource()
 ActionResult ComponentManager::StopSink()
 {
     DHLOGI("start.");
-    std::unordered_map<DHType, std::shared_future<int32_t>> futures;
+    ActionResult futures;
     for (const auto &item : compSink_) {
         if (item.second == nullptr) {
             DHLOGE("comp sink ptr is null");
             continue;
         }
-        std::promise<int32_t> p;
-        std::future<int32_t> f = p.get_future();
-        std::thread([p = std::move(p), item] () mutable {
-            p.set_value(item.second->ReleaseSink());
+        IDistributedHardwareSink *sinkPtr = item.second;
+        DHType dhType = item.first;
+        // the result is the one of ReleaseSink, unregistering the plugin listener is best effort
+        futures.emplace(item.first, SubmitAction(Action::STOP_SINK, item.first, [sinkPtr, dhType]() {
+            int32_t ret = sinkPtr->ReleaseSink();
             IHardwareHandler *hardwareHandler = nullptr;
-            int32_t status = ComponentLoader::GetInstance().GetHardwareHandler(item.first, hardwareHandler);
+            int32_t status = ComponentLoader::GetInstance().GetHardwareHandler(dhType, hardwareHandler);
             if (status != DH_FWK_SUCCESS || hardwareHandler == nullptr) {
-                DHLOGE("GetHardwareHandler %{public}#X failed", item.first);
-                return status;
+                DHLOGE("GetHardwareHandler %{public}#X failed", dhType);
+                return ret;
             }
             hardwareHandler->UnRegisterPluginListener();
-            return status;
-        }).detach();
-        futures.emplace(item.first, f.share());
+            return ret;
+        }));
     }
     return futures;
 }
 
+ActionTask ComponentManager::SubmitAction(const Action &action, DHType dhType, std::function<int32_t()> func)
+{
+    auto isCancelled = std::make_shared<std::atomic<bool>>(false);
+    auto promise = std::make_shared<std::promise<int32_t>>();
+    ActionTask task { promise->get_future().share(), isCancelled };
+    // the callers wait on the result, from ffrt tasks too, so the call must not need an ffrt worker to run
+    actionPool_.AddTask([action, dhType, func, isCancelled, promise]() {
+        if (isCancelled->load()) {
+            DHLOGW("action = %{public}d, compType = %{public}#X, CANCELLED", static_cast<int32_t>(action), dhType);
+            promise->set_value(ERR_DH_FWK_TASK_TIMEOUT);
+            return;
+        }
+        int64_t startTime = GetCurrentTime();
+        int32_t ret = func();
+        DHLOGI("action = %{public}d, compType = %{public}#X, cost = %{public}" PRId64 " ms.",
+            static_cast<int32_t>(action), dhType, GetCurrentTime() - startTime);
+        promise->set_value(ret);
+    });
+    return task;
+}
+
 bool ComponentManager::WaitForResult(const Action &action, ActionResult actionsResult)
 {
     DHLOGD("start.");
     auto ret = true;
+    // all the actions run in parallel, so they share one deadline
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(UNINIT_COMPONENT_TIMEOUT_SECONDS);
     for (auto &iter : actionsResult) {
-        std::future_status status = iter.second.wait_for(std::chrono::seconds(UNINIT_COMPONENT_TIMEOUT_SECONDS));
+        if (!iter.second.result.valid()) {
+            continue;
+        }
+        std::future_status status = iter.second.result.wait_until(deadline);
         if (status == std::future_status::ready) {
-            auto result = iter.second.get();
+            auto result = iter.second.result.get();
             DHLOGI("action = %{public}d, compType = %{public}#X, READY, ret = %{public}d.",
                 static_cast<int32_t>(action), iter.first, result);
             if (result != DH_FWK_SUCCESS) {
@@ -474,7 +493,10 @@ bool ComponentManager::WaitForResult(const Action &action, ActionResult actionsR
         if (status == std::future_status::timeout) {
             DHLOGI("action = %{public}d, compType = %{public}#X, TIMEOUT", static_cast<int32_t>(action), iter.first);
             if (action == Action::STOP_SOURCE || action == Action::STOP_SINK) {
+                // the component must still be released, the stop call runs to the end
                 isUnInitTimeOut_ = true;
+            } else if (iter.second.isCancelled != nullptr) {
+                iter.second.isCancelled->store(true);
             }
         }
 
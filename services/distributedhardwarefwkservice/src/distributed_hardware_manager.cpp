@@ -115,7 +115,12 @@ int32_t DistributedHardwareManager::SendOnLineEvent(const std::string &networkId
         .dhType = DHType::UNKNOWN
     };
     auto task = TaskFactory::GetInstance().CreateTask(TaskType::ON_LINE, taskParam, nullptr);
-    TaskExecutor::GetInstance().PushTask(task);
+    int32_t ret = TaskExecutor::GetInstance().PushTask(task);
+    if (ret != DH_FWK_SUCCESS) {
+        DHLOGE("Push online task failed, networkId = %{public}s, ret = %{public}d",
+            GetAnonyString(networkId).c_str(), ret);
+        return ret;
+    }
     return DH_FWK_SUCCESS;
 }
 
@@ -137,7 +142,9 @@ int32_t DistributedHardwareManager::SendOffLineEvent(const std::string &networkI
         .dhType = DHType::UNKNOWN
     };
     auto task = TaskFactory::GetInstance().CreateTask(TaskType::OFF_LINE, taskParam, nullptr);
-    TaskExecutor::GetInstance().PushTask(task);
+    if (TaskExecutor::GetInstance().PushTask(task) != DH_FWK_SUCCESS) {
+        DHLOGE("Push offline task failed, networkId = %{public}s", GetAnonyString(networkId).c_str());
+    }
     Publisher::GetInstance().PublishMessage(DHTopic::TOPIC_DEV_OFFLINE, networkId);
 
     HiSysEventWriteCompOfflineMsg(DHFWK_DEV_OFFLINE, OHOS::HiviewDFX::HiSysEvent::EventType::BEHAVIOR,
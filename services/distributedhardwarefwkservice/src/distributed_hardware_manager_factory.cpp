@@ -172,7 +172,30 @@ int32_t DistributedHardwareManagerFactory::SendOnLineEvent(const std::string &ne
 
     DHContext::GetInstance().AddOnlineDevice(udid, uuid, networkId);
     DHContext::GetInstance().AddRealTimeOnlineDeviceNetworkId(networkId);
+    return DoOnLineEvent(networkId, uuid, udid, deviceType);
+}
+
+int32_t DistributedHardwareManagerFactory::SendSeededOnLineEvent(const std::string &networkId,
+    const std::string &uuid, const std::string &udid, uint16_t deviceType)
+{
+    if (!IsIdLengthValid(networkId) || !IsIdLengthValid(uuid) || !IsIdLengthValid(udid)) {
+        return ERR_DH_FWK_PARA_INVALID;
+    }
+    if (flagUnInit_.load()) {
+        DHLOGE("is in uniniting, can not process online event.");
+        return ERR_DH_FWK_HARDWARE_MANAGER_INIT_FAILED;
+    }
+    // the seeded entry is gone only if the device went offline meanwhile, it must not be onlined again
+    if (!DHContext::GetInstance().IsDeviceOnline(uuid)) {
+        DHLOGW("device is not seeded or already offline, uuid = %{public}s", GetAnonyString(uuid).c_str());
+        return ERR_DH_FWK_HARDWARE_MANAGER_DEVICE_REPEAT_OFFLINE;
+    }
+    return DoOnLineEvent(networkId, uuid, udid, deviceType);
+}
 
+int32_t DistributedHardwareManagerFactory::DoOnLineEvent(const std::string &networkId, const std::string &uuid,
+    const std::string &udid, uint16_t deviceType)
+{
     if (!isInit_.load() && !Init()) {
         DHLOGE("distributedHardwareMgr is null");
         return ERR_DH_FWK_HARDWARE_MANAGER_INIT_FAILED;
@@ -181,9 +181,37 @@ int32_t DistributedHardwareService::PublishMessage(const DHTopic topic, const st
 
 std::string DistributedHardwareService::QueryLocalSysSpec(const QueryLocalSysSpecType spec)
 {
-    DeviceInfo localDevInfo = DHContext::GetInstance().GetDeviceInfo();
+    uint32_t index = static_cast<uint32_t>(spec);
+    if (index >= static_cast<uint32_t>(QueryLocalSysSpecType::MAX)) {
+        DHLOGE("Invalid sys spec type: %{public}" PRIu32, index);
+        return "";
+    }
+    std::string deviceId = DHContext::GetInstance().GetDeviceInfo().deviceId;
+    // read the version before querying, a change during the query only makes the stored answer stale
+    uint64_t capVersion = CapabilityInfoManager::GetInstance()->GetDeviceCapabilityVersion(deviceId);
+    {
+        std::lock_guard<std::mutex> lock(sysSpecCacheMtx_);
+        const SysSpecCacheEntry &entry = sysSpecCache_[index];
+        if (entry.isValid && entry.capVersion == capVersion && entry.deviceId == deviceId) {
+            return entry.sysSpec;
+        }
+    }
+
+    std::string sysSpec = QueryLocalSysSpecInner(spec, deviceId);
+    std::lock_guard<std::mutex> lock(sysSpecCacheMtx_);
+    SysSpecCacheEntry &entry = sysSpecCache_[index];
+    entry.isValid = true;
+    entry.deviceId = deviceId;
+    entry.capVersion = capVersion;
+    entry.sysSpec = sysSpec;
+    return sysSpec;
+}
+
+std::string DistributedHardwareService::QueryLocalSysSpecInner(const QueryLocalSysSpecType spec,
+    const std::string &deviceId)
+{
     std::vector<std::shared_ptr<CapabilityInfo>> resInfos;
-    CapabilityInfoManager::GetInstance()->GetCapabilitiesByDeviceId(localDevInfo.deviceId, resInfos);
+    CapabilityInfoManager::GetInstance()->GetCapabilitiesByDeviceId(deviceId, resInfos);
     DHType targetDhType = DHType::UNKNOWN;
     std::string targetKey = "";
     switch (spec) {
@@ -15,7 +15,10 @@
 
 #include "local_hardware_manager.h"
 
-#include <unistd.h>
+#include <chrono>
+#include <set>
+
+#include "ffrt.h"
 
 #include "anonymous_string.h"
 #include "capability_info_manager.h"
@@ -34,8 +37,16 @@
 namespace OHOS {
 namespace DistributedHardware {
 namespace {
-    constexpr int32_t QUERY_INTERVAL_TIME = 1000 * 1000; // 1s
+    constexpr int64_t QUERY_INTERVAL_TIME_MS = 1000;
     constexpr int32_t QUERY_RETRY_MAX_TIMES = 3;
+    constexpr int64_t QUERY_HARDWARE_TIMEOUT_MS = 3 * 1000;
+
+    /* ffrt aware, the query tasks and the waiter may all run on ffrt workers */
+    struct QueryProgress {
+        ffrt::mutex mutex;
+        ffrt::condition_variable cond;
+        std::set<DHType> finishedTypes;
+    };
 }
 #undef DH_LOG_TAG
 #define DH_LOG_TAG "LocalHardwareManager"
@@ -49,58 +60,144 @@ void LocalHardwareManager::Init()
 {
     DHLOGI("start");
     std::vector<DHType> allCompTypes = ComponentLoader::GetInstance().GetAllCompTypes();
-    localDHItemsMap_.clear();
+    {
+        std::lock_guard<std::mutex> lock(localHardwareMutex_);
+        localDHItemsMap_.clear();
+    }
     int64_t allQueryStartTime = GetCurrentTime();
+    int64_t deadline = allQueryStartTime + QUERY_HARDWARE_TIMEOUT_MS;
+    auto progress = std::make_shared<QueryProgress>();
+    uint64_t generation = discoveryGeneration_.load();
+    {
+        std::lock_guard<std::mutex> lock(discoveryMutex_);
+        runningDiscoveryCount_ += static_cast<uint32_t>(allCompTypes.size());
+    }
     for (auto dhType : allCompTypes) {
-        int64_t singleQueryStartTime = GetCurrentTime();
-        IHardwareHandler *hardwareHandler = nullptr;
-        int32_t status = ComponentLoader::GetInstance().GetHardwareHandler(dhType, hardwareHandler);
-        if (status != DH_FWK_SUCCESS || hardwareHandler == nullptr) {
-            DHLOGE("GetHardwareHandler %{public}#X failed", dhType);
-            continue;
-        }
-        if (hardwareHandler->Initialize() != DH_FWK_SUCCESS) {
-            DHLOGE("Initialize %{public}#X failed", dhType);
-            continue;
+        ffrt::submit([this, dhType, deadline, generation, progress]() {
+            DiscoverLocalHardware(dhType, deadline, generation);
+            FinishDiscovery();
+            std::lock_guard<ffrt::mutex> lock(progress->mutex);
+            progress->finishedTypes.insert(dhType);
+            progress->cond.notify_all();
+        });
+    }
+    {
+        int64_t waitTime = deadline - GetCurrentTime();
+        if (waitTime < 0) {
+            waitTime = 0;
         }
-
-        DHQueryTraceStart(dhType);
-        QueryLocalHardware(dhType, hardwareHandler);
-        DHTraceEnd();
-        if (!hardwareHandler->IsSupportPlugin()) {
-            DHLOGI("hardwareHandler is not support hot swap plugin, release!");
-            ComponentLoader::GetInstance().ReleaseHardwareHandler(dhType);
-            hardwareHandler = nullptr;
-        } else {
-            compToolFuncsMap_[dhType] = hardwareHandler;
-            std::shared_ptr<PluginListener> listener = std::make_shared<PluginListenerImpl>(dhType);
-            pluginListenerMap_[dhType] = listener;
-            hardwareHandler->RegisterPluginListener(listener);
+        std::unique_lock<ffrt::mutex> lock(progress->mutex);
+        progress->cond.wait_for(lock, std::chrono::milliseconds(waitTime),
+            [&progress, &allCompTypes]() { return progress->finishedTypes.size() >= allCompTypes.size(); });
+        for (auto dhType : allCompTypes) {
+            if (progress->finishedTypes.count(dhType) == 0) {
+                DHLOGW("query %{public}#X hardware timeout, publish it once the query finishes", dhType);
+            }
         }
-        int64_t singleQueryEndTime = GetCurrentTime();
-        DHLOGI("query %{public}#X hardware cost time: %{public}" PRIu64 " ms",
-            dhType, singleQueryEndTime - singleQueryStartTime);
     }
     int64_t allQueryEndTime = GetCurrentTime();
     DHLOGI("query all local hardware cost time: %{public}" PRIu64 " ms", allQueryEndTime - allQueryStartTime);
-    std::vector<std::shared_ptr<CapabilityInfo>> capabilityInfos;
-    std::vector<std::shared_ptr<MetaCapabilityInfo>> metaCapInfos;
-    for (const auto &localDHItems : localDHItemsMap_) {
-        AddLocalCapabilityInfo(localDHItems.second, localDHItems.first, capabilityInfos);
-        AddLocalMetaCapInfo(localDHItems.second, localDHItems.first, metaCapInfos);
-    }
-    CapabilityInfoManager::GetInstance()->AddCapability(capabilityInfos);
-    MetaInfoManager::GetInstance()->AddMetaCapInfos(metaCapInfos);
 }
 
 void LocalHardwareManager::UnInit()
 {
     DHLOGI("start");
+    discoveryGeneration_++;
+    {
+        // the component libraries are unloaded after this returns, no discovery task may still use a handler
+        std::unique_lock<std::mutex> lock(discoveryMutex_);
+        if (runningDiscoveryCount_ > 0) {
+            DHLOGI("wait for %{public}" PRIu32 " discovery tasks to stop", runningDiscoveryCount_);
+        }
+        discoveryCond_.wait(lock, [this]() { return runningDiscoveryCount_ == 0; });
+    }
+    std::lock_guard<std::mutex> lock(localHardwareMutex_);
     compToolFuncsMap_.clear();
     pluginListenerMap_.clear();
 }
 
-void LocalHardwareManager::QueryLocalHardware(const DHType dhType, IHardwareHandler *hardwareHandler)
+bool LocalHardwareManager::IsDiscoveryStopped(uint64_t generation)
+{
+    return generation != discoveryGeneration_.load();
+}
+
+void LocalHardwareManager::FinishDiscovery()
+{
+    {
+        std::lock_guard<std::mutex> lock(discoveryMutex_);
+        if (runningDiscoveryCount_ > 0) {
+            runningDiscoveryCount_--;
+        }
+    }
+    discoveryCond_.notify_all();
+}
+
+void LocalHardwareManager::DiscoverLocalHardware(const DHType dhType, int64_t deadline, uint64_t generation)
+{
+    int64_t singleQueryStartTime = GetCurrentTime();
+    IHardwareHandler *hardwareHandler = nullptr;
+    int32_t status = ComponentLoader::GetInstance().GetHardwareHandler(dhType, hardwareHandler);
+    if (status != DH_FWK_SUCCESS || hardwareHandler == nullptr) {
+        DHLOGE("GetHardwareHandler %{public}#X failed", dhType);
+        return;
+    }
+    if (hardwareHandler->Initialize() != DH_FWK_SUCCESS) {
+        DHLOGE("Initialize %{public}#X failed", dhType);
+        return;
+    }
+
+    DHQueryTraceStart(dhType);
+    QueryLocalHardware(dhType, hardwareHandler, deadline);
+    DHTraceEnd();
+    if (IsDiscoveryStopped(generation)) {
+        DHLOGW("local hardware manager is uninit, drop %{public}#X hardware", dhType);
+        return;
+    }
+    // publish as soon as this type is done, instead of waiting for the slowest component. the capabilities are
+    // reconciled before the plugin listener is registered, so no hot-plug flush of this type runs meanwhile
+    PublishLocalHardware(dhType);
+    if (!hardwareHandler->IsSupportPlugin()) {
+        DHLOGI("hardwareHandler is not support hot swap plugin, release!");
+        ComponentLoader::GetInstance().ReleaseHardwareHandler(dhType);
+        hardwareHandler = nullptr;
+    } else {
+        std::shared_ptr<PluginListener> listener = std::make_shared<PluginListenerImpl>(dhType);
+        {
+            std::lock_guard<std::mutex> lock(localHardwareMutex_);
+            if (IsDiscoveryStopped(generation)) {
+                DHLOGW("local hardware manager is uninit, skip %{public}#X plugin listener", dhType);
+                return;
+            }
+            compToolFuncsMap_[dhType] = hardwareHandler;
+            pluginListenerMap_[dhType] = listener;
+        }
+        hardwareHandler->RegisterPluginListener(listener);
+    }
+    int64_t singleQueryEndTime = GetCurrentTime();
+    DHLOGI("query %{public}#X hardware cost time: %{public}" PRIu64 " ms",
+        dhType, singleQueryEndTime - singleQueryStartTime);
+}
+
+void LocalHardwareManager::PublishLocalHardware(const DHType dhType)
+{
+    std::vector<DHItem> dhItems;
+    {
+        std::lock_guard<std::mutex> lock(localHardwareMutex_);
+        auto iter = localDHItemsMap_.find(dhType);
+        if (iter == localDHItemsMap_.end() || iter->second.empty()) {
+            DHLOGW("No local hardware to publish, dhType: %{public}#X", dhType);
+            return;
+        }
+        dhItems = iter->second;
+    }
+    ReconcileCapabilityInfo(dhItems, dhType);
+    std::vector<std::shared_ptr<MetaCapabilityInfo>> metaCapInfos;
+    AddLocalMetaCapInfo(dhItems, dhType, metaCapInfos);
+    MetaInfoManager::GetInstance()->AddMetaCapInfos(metaCapInfos);
+}
+
+void LocalHardwareManager::QueryLocalHardware(const DHType dhType, IHardwareHandler *hardwareHandler,
+    int64_t deadline)
 {
     std::vector<DHItem> dhItems;
     int32_t retryTimes = QUERY_RETRY_MAX_TIMES;
@@ -113,14 +210,14 @@ void LocalHardwareManager::QueryLocalHardware(const DHType dhType, IHardwareHand
         dhItems = hardwareHandler->Query();
         if (dhItems.empty()) {
             DHLOGE("Query hardwareHandler and obtain empty, dhType: %{public}#X", dhType);
-            usleep(QUERY_INTERVAL_TIME);
+            if (deadline > 0 && GetCurrentTime() + QUERY_INTERVAL_TIME_MS > deadline) {
+                DHLOGE("Query hardwareHandler deadline reached, dhType: %{public}#X", dhType);
+                return;
+            }
+            ffrt::this_task::sleep_for(std::chrono::milliseconds(QUERY_INTERVAL_TIME_MS));
         } else {
             DHLOGI("Query hardwareHandler success, dhType: %{public}#X!, size: %{public}zu", dhType, dhItems.size());
-            /*
-             * Failed to delete data when the device restarts or other exception situation.
-             * So check and remove the non-exist local capabilityInfo.
-             */
-            CheckNonExistCapabilityInfo(dhItems, dhType);
+            std::lock_guard<std::mutex> lock(localHardwareMutex_);
             localDHItemsMap_[dhType] = dhItems;
             break;
         }
@@ -161,40 +258,62 @@ void LocalHardwareManager::AddLocalMetaCapInfo(const std::vector<DHItem> &dhItem
     }
 }
 
-void LocalHardwareManager::CheckNonExistCapabilityInfo(const std::vector<DHItem> &dhItems, const DHType dhType)
+void LocalHardwareManager::ReconcileCapabilityInfo(const std::vector<DHItem> &dhItems, const DHType dhType)
 {
-    DHLOGI("start");
-    if (dhType != DHType::INPUT) {
-        DHLOGI("This dhType is not input and no need check!");
-        return;
+    /*
+     * Failed to delete data when the device restarts or other exception situation.
+     * So diff the stored local capabilityInfo with the queried one and remove the non-exist ones.
+     */
+    CapabilityInfoMap storedCapInfos;
+    GetLocalCapabilityMapByPrefix(dhType, storedCapInfos);
+    std::vector<std::shared_ptr<CapabilityInfo>> capabilityInfos;
+    AddLocalCapabilityInfo(dhItems, dhType, capabilityInfos);
+    CapabilityInfoDiff diff;
+    DiffCapabilityInfo(capabilityInfos, storedCapInfos, diff);
+    DHLOGI("dhType: %{public}#X, added: %{public}zu, changed: %{public}zu, unchanged: %{public}zu, "
+        "removed: %{public}zu", dhType, diff.added.size(), diff.changed.size(), diff.unchanged.size(),
+        diff.removedKeys.size());
+
+    if (!diff.removedKeys.empty() &&
+        CapabilityInfoManager::GetInstance()->RemoveCapabilityInfoByKeys(diff.removedKeys) != DH_FWK_SUCCESS) {
+        DHLOGE("Remove non-exist capability infos failed, dhType: %{public}#X", dhType);
+    }
+    // the unchanged records are already stored, only the memory cache needs them
+    if (!diff.unchanged.empty()) {
+        CapabilityInfoManager::GetInstance()->AddCapabilityInMem(diff.unchanged);
     }
-    CapabilityInfoMap allLocalCapabilityInfos;
-    GetLocalCapabilityMapByPrefix(dhType, allLocalCapabilityInfos);
-    for (auto capabilityInfo : allLocalCapabilityInfos) {
-        std::shared_ptr<CapabilityInfo> capabilityValue = capabilityInfo.second;
-        if (capabilityValue == nullptr) {
-            DHLOGE("capabilityInfo value is nullptr");
+    std::vector<std::shared_ptr<CapabilityInfo>> upsertCapInfos = diff.added;
+    upsertCapInfos.insert(upsertCapInfos.end(), diff.changed.begin(), diff.changed.end());
+    if (!upsertCapInfos.empty()) {
+        CapabilityInfoManager::GetInstance()->AddCapability(upsertCapInfos);
+    }
+}
+
+void LocalHardwareManager::DiffCapabilityInfo(const std::vector<std::shared_ptr<CapabilityInfo>> &capabilityInfos,
+    const CapabilityInfoMap &storedCapInfos, CapabilityInfoDiff &diff)
+{
+    std::unordered_map<std::string, std::shared_ptr<CapabilityInfo>> storedIndex(storedCapInfos.begin(),
+        storedCapInfos.end());
+    for (const auto &capInfo : capabilityInfos) {
+        if (capInfo == nullptr) {
             continue;
         }
-        DHLOGI("The key in allLocalCapabilityInfos is %{public}s", capabilityValue->GetAnonymousKey().c_str());
-        bool isExist = false;
-        for (auto dhItem : dhItems) {
-            DHLOGI("This data key is: %{public}s, dhItem: %{public}s", capabilityValue->GetAnonymousKey().c_str(),
-                GetAnonyString(dhItem.dhId).c_str());
-            if (capabilityValue->GetDHId() == dhItem.dhId) {
-                DHLOGI("This data is exist, no need removed key: %{public}s",
-                    capabilityValue->GetAnonymousKey().c_str());
-                isExist = true;
-                break;
-            }
+        auto iter = storedIndex.find(capInfo->GetKey());
+        if (iter == storedIndex.end()) {
+            diff.added.push_back(capInfo);
+            continue;
         }
-        if (!isExist) {
-            DHLOGI("This data is non-exist, it should be removed, key: %{public}s",
-                capabilityValue->GetAnonymousKey().c_str());
-            CapabilityInfoManager::GetInstance()->RemoveCapabilityInfoByKey(capabilityValue->GetKey());
+        if (iter->second != nullptr && iter->second->Compare(*capInfo)) {
+            diff.unchanged.push_back(capInfo);
+        } else {
+            diff.changed.push_back(capInfo);
         }
+        storedIndex.erase(iter);
+    }
+    for (const auto &item : storedIndex) {
+        DHLOGI("This data is non-exist, it should be removed, key: %{public}s", GetAnonyString(item.first).c_str());
+        diff.removedKeys.push_back(item.first);
     }
-    DHLOGI("end");
 }
 
 void LocalHardwareManager::GetLocalCapabilityMapByPrefix(const DHType dhType, CapabilityInfoMap &capabilityInfoMap)
@@ -203,13 +322,15 @@ void LocalHardwareManager::GetLocalCapabilityMapByPrefix(const DHType dhType, Ca
     if (!IsIdLengthValid(localDeviceId)) {
         return;
     }
-    if (DHTypePrefixMap.find(dhType) == DHTypePrefixMap.end()) {
-        DHLOGE("DHTypePrefixMap can not find dhType: %{public}#X", dhType);
-        return;
+    // not every DHType has a dhId prefix, so read the local records and filter them by type
+    std::string localCapabilityPrefix = localDeviceId + RESOURCE_SEPARATOR;
+    CapabilityInfoMap localCapabilityInfos;
+    CapabilityInfoManager::GetInstance()->GetDataByKeyPrefix(localCapabilityPrefix, localCapabilityInfos);
+    for (const auto &item : localCapabilityInfos) {
+        if (item.second != nullptr && item.second->GetDHType() == dhType) {
+            capabilityInfoMap.insert(item);
+        }
     }
-    std::string prefix = DHTypePrefixMap.find(dhType)->second;
-    std::string localCapabilityPrefix = localDeviceId + RESOURCE_SEPARATOR + prefix;
-    CapabilityInfoManager::GetInstance()->GetDataByKeyPrefix(localCapabilityPrefix, capabilityInfoMap);
 }
 } // namespace DistributedHardware
 } // namespace OHOS
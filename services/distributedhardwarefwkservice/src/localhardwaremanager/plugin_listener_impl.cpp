@@ -15,6 +15,11 @@
 
 #include "plugin_listener_impl.h"
 
+#include <algorithm>
+#include <cinttypes>
+
+#include "ffrt.h"
+
 #include "anonymous_string.h"
 #include "capability_info.h"
 #include "capability_info_manager.h"
@@ -30,6 +35,23 @@ namespace DistributedHardware {
 #undef DH_LOG_TAG
 #define DH_LOG_TAG "PluginListenerImpl"
 
+namespace {
+    const char *PLUGIN_COALESCE_WINDOW_KEY = "sys.dhfwk.plugin.coalesce.window.ms";
+    constexpr int32_t DEFAULT_COALESCE_WINDOW_MS = 100;
+    constexpr int32_t MAX_COALESCE_WINDOW_MS = 1000;
+    constexpr uint64_t US_PER_MS = 1000;
+    constexpr size_t MAX_PENDING_EVENT_NUM = 64;
+}
+
+PluginListenerImpl::PluginListenerImpl(const DHType type) : dhType_(type),
+    coalesceWindowMs_(DEFAULT_COALESCE_WINDOW_MS)
+{
+    int32_t windowMs = DEFAULT_COALESCE_WINDOW_MS;
+    if (GetSysPara(PLUGIN_COALESCE_WINDOW_KEY, windowMs) && windowMs >= 0 && windowMs <= MAX_COALESCE_WINDOW_MS) {
+        coalesceWindowMs_ = windowMs;
+    }
+}
+
 void PluginListenerImpl::PluginHardware(const std::string &dhId, const std::string &attrs, const std::string &subtype)
 {
     if (!IsIdLengthValid(dhId) || !IsMessageLengthValid(attrs)) {
@@ -40,16 +62,7 @@ void PluginListenerImpl::PluginHardware(const std::string &dhId, const std::stri
         DHLOGI("System is in sleeping, drop it");
         return;
     }
-    std::vector<std::shared_ptr<CapabilityInfo>> capabilityInfos;
-    std::string deviceId = DHContext::GetInstance().GetDeviceInfo().deviceId;
-    std::string devName = DHContext::GetInstance().GetDeviceInfo().deviceName;
-    uint16_t devType = DHContext::GetInstance().GetDeviceInfo().deviceType;
-    std::shared_ptr<CapabilityInfo> dhCapabilityInfo =
-        std::make_shared<CapabilityInfo>(dhId, deviceId, devName, devType, dhType_, attrs, subtype);
-    capabilityInfos.push_back(dhCapabilityInfo);
-
-    CapabilityInfoManager::GetInstance()->AddCapability(capabilityInfos);
-    Publisher::GetInstance().PublishMessage(DHTopic::TOPIC_PHY_DEV_PLUGIN, dhId);
+    AddPendingEvent(dhId, PluginEvent { true, attrs, subtype });
     DHLOGI("plugin end, dhId: %{public}s", GetAnonyString(dhId).c_str());
 }
 
@@ -63,16 +76,114 @@ void PluginListenerImpl::UnPluginHardware(const std::string &dhId)
         DHLOGI("System is in sleeping, drop it");
         return;
     }
-    std::string deviceId = DHContext::GetInstance().GetDeviceInfo().deviceId;
-    std::shared_ptr<CapabilityInfo> capability = nullptr;
-    auto ret = CapabilityInfoManager::GetInstance()->GetCapability(deviceId, dhId, capability);
-    if ((ret != DH_FWK_SUCCESS) || (capability == nullptr)) {
-        DHLOGE("GetCapability failed, deviceId =%{public}s, dhId = %{public}s, errCode = %{public}d",
-            GetAnonyString(deviceId).c_str(), GetAnonyString(dhId).c_str(), ret);
+    AddPendingEvent(dhId, PluginEvent { false, "", "" });
+    DHLOGI("unplugin end, dhId: %{public}s", GetAnonyString(dhId).c_str());
+}
+
+void PluginListenerImpl::AddPendingEvent(const std::string &dhId, const PluginEvent &event)
+{
+    bool isFlushNow = false;
+    {
+        std::lock_guard<std::mutex> lock(eventMutex_);
+        pendingEvents_[dhId] = event;
+        isFlushNow = (coalesceWindowMs_ == 0) || (pendingEvents_.size() >= MAX_PENDING_EVENT_NUM);
+        if (!isFlushNow) {
+            isFlushNow = !SchedulePendingEventsFlush();
+        }
+    }
+    if (isFlushNow) {
+        FlushPendingEvents();
+    }
+}
+
+bool PluginListenerImpl::SchedulePendingEventsFlush()
+{
+    if (isFlushScheduled_) {
+        return true;
+    }
+    std::weak_ptr<PluginListenerImpl> weakSelf = weak_from_this();
+    if (weakSelf.expired()) {
+        DHLOGW("listener is not owned by a shared_ptr, can not delay the flush");
+        return false;
+    }
+    isFlushScheduled_ = true;
+    ffrt::submit([weakSelf]() {
+        auto self = weakSelf.lock();
+        if (self == nullptr) {
+            return;
+        }
+        self->FlushPendingEvents();
+    }, {}, {}, ffrt::task_attr().delay(static_cast<uint64_t>(coalesceWindowMs_) * US_PER_MS));
+    return true;
+}
+
+void PluginListenerImpl::FlushPendingEvents()
+{
+    std::lock_guard<std::mutex> flushLock(flushMutex_);
+    std::map<std::string, PluginEvent> events;
+    {
+        std::lock_guard<std::mutex> lock(eventMutex_);
+        events.swap(pendingEvents_);
+        isFlushScheduled_ = false;
+    }
+    if (events.empty()) {
         return;
     }
-    CapabilityInfoManager::GetInstance()->RemoveCapabilityInfoByKey(capability->GetKey());
-    DHLOGI("unplugin end, dhId: %{public}s", GetAnonyString(dhId).c_str());
+    std::string deviceId = DHContext::GetInstance().GetDeviceInfo().deviceId;
+    std::string devName = DHContext::GetInstance().GetDeviceInfo().deviceName;
+    uint16_t devType = DHContext::GetInstance().GetDeviceInfo().deviceType;
+    std::vector<std::shared_ptr<CapabilityInfo>> capabilityInfos;
+    std::vector<std::string> pluginDhIds;
+    std::vector<std::string> removeKeys;
+    for (const auto &item : events) {
+        const std::string &dhId = item.first;
+        if (item.second.isPlugin) {
+            capabilityInfos.push_back(std::make_shared<CapabilityInfo>(dhId, deviceId, devName, devType, dhType_,
+                item.second.attrs, item.second.subtype));
+            pluginDhIds.push_back(dhId);
+            continue;
+        }
+        std::shared_ptr<CapabilityInfo> capability = nullptr;
+        auto ret = CapabilityInfoManager::GetInstance()->GetCapability(deviceId, dhId, capability);
+        if ((ret != DH_FWK_SUCCESS) || (capability == nullptr)) {
+            DHLOGE("GetCapability failed, deviceId =%{public}s, dhId = %{public}s, errCode = %{public}d",
+                GetAnonyString(deviceId).c_str(), GetAnonyString(dhId).c_str(), ret);
+            continue;
+        }
+        removeKeys.push_back(capability->GetKey());
+    }
+    if (!capabilityInfos.empty()) {
+        CapabilityInfoManager::GetInstance()->AddCapability(capabilityInfos);
+    }
+    if (!removeKeys.empty() &&
+        CapabilityInfoManager::GetInstance()->RemoveCapabilityInfoByKeys(removeKeys) != DH_FWK_SUCCESS) {
+        DHLOGE("Remove unplugged capability infos failed, dhType: %{public}#X", dhType_);
+    }
+    PublishPluginMessage(pluginDhIds);
+
+    std::lock_guard<std::mutex> lock(eventMutex_);
+    uint32_t batchSize = static_cast<uint32_t>(events.size());
+    batchStats_.batchCount++;
+    batchStats_.eventCount += batchSize;
+    batchStats_.lastBatchSize = batchSize;
+    batchStats_.maxBatchSize = std::max(batchStats_.maxBatchSize, batchSize);
+    DHLOGI("flush plugin events, dhType: %{public}#X, batch size: %{public}u, plugin: %{public}zu, unplugin: "
+        "%{public}zu, batch count: %{public}" PRIu64 ", max batch size: %{public}u", dhType_, batchSize,
+        capabilityInfos.size(), removeKeys.size(), batchStats_.batchCount, batchStats_.maxBatchSize);
+}
+
+void PluginListenerImpl::PublishPluginMessage(const std::vector<std::string> &dhIds)
+{
+    // the subscribers expect one dhId per message, the capabilities of the batch are already saved
+    for (const auto &dhId : dhIds) {
+        Publisher::GetInstance().PublishMessage(DHTopic::TOPIC_PHY_DEV_PLUGIN, dhId);
+    }
+}
+
+PluginBatchStats PluginListenerImpl::GetBatchStats()
+{
+    std::lock_guard<std::mutex> lock(eventMutex_);
+    return batchStats_;
 }
 } // namespace DistributedHardware
 } // namespace OHOS
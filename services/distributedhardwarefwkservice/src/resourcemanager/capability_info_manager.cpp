@@ -15,6 +15,8 @@
 
 #include "capability_info_manager.h"
 
+#include <algorithm>
+
 #include "anonymous_string.h"
 #include "capability_utils.h"
 #include "constants.h"
@@ -141,7 +143,7 @@ int32_t CapabilityInfoManager::SyncDeviceInfoFromDB(const std::string &deviceId)
             DHLOGE("Get capability ptr by value failed");
             continue;
         }
-        globalCapInfoMap_[capabilityInfo->GetKey()] = capabilityInfo;
+        PutCapabilityInMem(capabilityInfo);
     }
     return DH_FWK_SUCCESS;
 }
@@ -178,7 +180,7 @@ int32_t CapabilityInfoManager::SyncRemoteCapabilityInfos()
                 DHLOGE("local device info not need sync from db");
                 continue;
             }
-            globalCapInfoMap_[capabilityInfo->GetKey()] = capabilityInfo;
+            PutCapabilityInMem(capabilityInfo);
         }
     }
     return DH_FWK_SUCCESS;
@@ -195,34 +197,19 @@ int32_t CapabilityInfoManager::AddCapability(const std::vector<std::shared_ptr<C
         DHLOGE("dbAdapterPtr_ is null");
         return ERR_DH_FWK_RESOURCE_DB_ADAPTER_POINTER_NULL;
     }
-    std::vector<std::string> keys;
-    std::vector<std::string> values;
-    std::string key;
-    std::string data;
+    int32_t ret = DH_FWK_SUCCESS;
     for (auto &resInfo : resInfos) {
         if (resInfo == nullptr) {
             continue;
         }
-        key = resInfo->GetKey();
-        globalCapInfoMap_[key] = resInfo;
-        if (dbAdapterPtr_->GetDataByKey(key, data) == DH_FWK_SUCCESS &&
-            IsCapInfoJsonEqual<CapabilityInfo>(data, resInfo->ToJsonString())) {
-            DHLOGD("this record is exist, Key: %{public}s", resInfo->GetAnonymousKey().c_str());
-            continue;
+        PutCapabilityInMem(resInfo);
+        // unchanged records are filtered by the db adapter digests, changed ones are flushed in batches
+        if (dbAdapterPtr_->PutDataDeferred(resInfo->GetKey(), resInfo->ToJsonString()) != DH_FWK_SUCCESS) {
+            DHLOGE("Fail to storage to kv, Key: %{public}s", resInfo->GetAnonymousKey().c_str());
+            ret = ERR_DH_FWK_RESOURCE_DB_ADAPTER_OPERATION_FAIL;
         }
-        DHLOGI("AddCapability, Key: %{public}s", resInfo->GetAnonymousKey().c_str());
-        keys.push_back(key);
-        values.push_back(resInfo->ToJsonString());
-    }
-    if (keys.empty() || values.empty()) {
-        DHLOGD("Records are empty, No need add data to db!");
-        return DH_FWK_SUCCESS;
     }
-    if (dbAdapterPtr_->PutDataBatch(keys, values) != DH_FWK_SUCCESS) {
-        DHLOGE("Fail to storage batch to kv");
-        return ERR_DH_FWK_RESOURCE_DB_ADAPTER_OPERATION_FAIL;
-    }
-    return DH_FWK_SUCCESS;
+    return ret;
 }
 
 int32_t CapabilityInfoManager::AddCapabilityInMem(const std::vector<std::shared_ptr<CapabilityInfo>> &resInfos)
@@ -238,7 +225,7 @@ int32_t CapabilityInfoManager::AddCapabilityInMem(const std::vector<std::shared_
         }
         const std::string key = resInfo->GetKey();
         DHLOGI("AddCapabilityInMem, Key: %{public}s", resInfo->GetAnonymousKey().c_str());
-        globalCapInfoMap_[key] = resInfo;
+        PutCapabilityInMem(resInfo);
     }
     return DH_FWK_SUCCESS;
 }
@@ -255,14 +242,7 @@ int32_t CapabilityInfoManager::RemoveCapabilityInfoInDB(const std::string &devic
         return ERR_DH_FWK_RESOURCE_DB_ADAPTER_POINTER_NULL;
     }
     // 1. Clear the cache in the memory.
-    for (auto iter = globalCapInfoMap_.begin(); iter != globalCapInfoMap_.end();) {
-        if (!IsCapKeyMatchDeviceId(iter->first, deviceId)) {
-            iter++;
-            continue;
-        }
-        DHLOGI("Clear globalCapInfoMap_ iter: %{public}s", GetAnonyString(iter->first).c_str());
-        globalCapInfoMap_.erase(iter++);
-    }
+    EraseDeviceCapabilitiesInMem(deviceId);
     // 2. Delete the corresponding record from the database(use UUID).
     if (dbAdapterPtr_->RemoveDeviceData(deviceId) != DH_FWK_SUCCESS) {
         DHLOGE("Remove capability Device Data failed, deviceId: %{public}s", GetAnonyString(deviceId).c_str());
@@ -283,7 +263,7 @@ int32_t CapabilityInfoManager::RemoveCapabilityInfoByKey(const std::string &key)
         return ERR_DH_FWK_RESOURCE_DB_ADAPTER_POINTER_NULL;
     }
     // 1. Clear the cache in the memory.
-    globalCapInfoMap_.erase(key);
+    EraseCapabilityInMem(key);
 
     // 2. Delete the corresponding record from the database.(use key)
     if (dbAdapterPtr_->RemoveDataByKey(key) != DH_FWK_SUCCESS) {
@@ -293,6 +273,34 @@ int32_t CapabilityInfoManager::RemoveCapabilityInfoByKey(const std::string &key)
     return DH_FWK_SUCCESS;
 }
 
+int32_t CapabilityInfoManager::RemoveCapabilityInfoByKeys(const std::vector<std::string> &keys)
+{
+    if (keys.empty()) {
+        DHLOGE("Keys is empty!");
+        return ERR_DH_FWK_PARA_INVALID;
+    }
+    DHLOGI("Remove capability infos, size: %{public}zu", keys.size());
+    std::lock_guard<std::mutex> lock(capInfoMgrMutex_);
+    if (dbAdapterPtr_ == nullptr) {
+        DHLOGE("dbAdapterPtr_ is null");
+        return ERR_DH_FWK_RESOURCE_DB_ADAPTER_POINTER_NULL;
+    }
+    for (const auto &key : keys) {
+        EraseCapabilityInMem(key);
+    }
+    int32_t ret = DH_FWK_SUCCESS;
+    for (size_t start = 0; start < keys.size(); start += MAX_DB_RECORD_SIZE) {
+        size_t end = std::min(keys.size(), start + static_cast<size_t>(MAX_DB_RECORD_SIZE));
+        std::vector<std::string> batchKeys(keys.begin() + start, keys.begin() + end);
+        if (dbAdapterPtr_->RemoveDataBatch(batchKeys) != DH_FWK_SUCCESS) {
+            DHLOGE("Remove capability data batch failed, start: %{public}zu, size: %{public}zu", start,
+                batchKeys.size());
+            ret = ERR_DH_FWK_RESOURCE_DB_ADAPTER_OPERATION_FAIL;
+        }
+    }
+    return ret;
+}
+
 int32_t CapabilityInfoManager::RemoveCapabilityInfoInMem(const std::string &deviceId)
 {
     if (!IsIdLengthValid(deviceId)) {
@@ -300,13 +308,7 @@ int32_t CapabilityInfoManager::RemoveCapabilityInfoInMem(const std::string &devi
     }
     DHLOGI("remove capability device info in memory, deviceId: %{public}s", GetAnonyString(deviceId).c_str());
     std::lock_guard<std::mutex> lock(capInfoMgrMutex_);
-    for (auto iter = globalCapInfoMap_.begin(); iter != globalCapInfoMap_.end();) {
-        if (!IsCapKeyMatchDeviceId(iter->first, deviceId)) {
-            iter++;
-            continue;
-        }
-        globalCapInfoMap_.erase(iter++);
-    }
+    EraseDeviceCapabilitiesInMem(deviceId);
     return DH_FWK_SUCCESS;
 }
 
@@ -315,21 +317,154 @@ std::map<std::string, std::shared_ptr<CapabilityInfo>> CapabilityInfoManager::Qu
 {
     std::lock_guard<std::mutex> lock(capInfoMgrMutex_);
     std::map<std::string, std::shared_ptr<CapabilityInfo>> capMap;
-    for (auto &info : globalCapInfoMap_) {
-        bool isMatch = true;
+    std::vector<std::string> candidateKeys;
+    auto isMatchFilters = [this, &filters](const std::shared_ptr<CapabilityInfo> &capInfo) {
         for (auto &filter : filters) {
-            if (!IsCapabilityMatchFilter(info.second, filter.first, filter.second)) {
-                isMatch = false;
-                break;
+            if (!IsCapabilityMatchFilter(capInfo, filter.first, filter.second)) {
+                return false;
             }
         }
-        if (isMatch) {
-            capMap.emplace(info.first, info.second);
+        return true;
+    };
+    if (!GetCandidateKeysByFilters(filters, candidateKeys)) {
+        for (auto &info : globalCapInfoMap_) {
+            if (isMatchFilters(info.second)) {
+                capMap.emplace(info.first, info.second);
+            }
+        }
+        return capMap;
+    }
+    for (const auto &key : candidateKeys) {
+        auto iter = globalCapInfoMap_.find(key);
+        if (iter != globalCapInfoMap_.end() && isMatchFilters(iter->second)) {
+            capMap.emplace(iter->first, iter->second);
         }
     }
     return capMap;
 }
 
+bool CapabilityInfoManager::GetCandidateKeysByFilters(const std::map<CapabilityInfoFilter, std::string> &filters,
+    std::vector<std::string> &keys)
+{
+    auto deviceIdIter = filters.find(CapabilityInfoFilter::FILTER_DEVICE_ID);
+    auto dhIdIter = filters.find(CapabilityInfoFilter::FILTER_DH_ID);
+    auto dhTypeIter = filters.find(CapabilityInfoFilter::FILTER_DH_TYPE);
+    if (deviceIdIter != filters.end() && dhIdIter != filters.end()) {
+        keys.emplace_back(GetCapabilityKey(deviceIdIter->second, dhIdIter->second));
+        return true;
+    }
+    if (deviceIdIter != filters.end()) {
+        auto devIter = deviceIdIndex_.find(deviceIdIter->second);
+        if (devIter == deviceIdIndex_.end()) {
+            return true;
+        }
+        if (dhTypeIter == filters.end()) {
+            GetKeysByDeviceId(deviceIdIter->second, keys);
+            return true;
+        }
+        auto typeIter = devIter->second.find(static_cast<DHType>(std::stoi(dhTypeIter->second)));
+        if (typeIter != devIter->second.end()) {
+            keys.assign(typeIter->second.begin(), typeIter->second.end());
+        }
+        return true;
+    }
+    if (dhTypeIter != filters.end()) {
+        auto typeIter = dhTypeIndex_.find(static_cast<DHType>(std::stoi(dhTypeIter->second)));
+        if (typeIter != dhTypeIndex_.end()) {
+            keys.assign(typeIter->second.begin(), typeIter->second.end());
+        }
+        return true;
+    }
+    return false;
+}
+
+void CapabilityInfoManager::PutCapabilityInMem(const std::shared_ptr<CapabilityInfo> &capInfo)
+{
+    if (capInfo == nullptr) {
+        return;
+    }
+    const std::string key = capInfo->GetKey();
+    auto iter = globalCapInfoMap_.find(key);
+    if (iter != globalCapInfoMap_.end() && iter->second != nullptr) {
+        RemoveCapabilityIndex(iter->second);
+    }
+    globalCapInfoMap_[key] = capInfo;
+    AddCapabilityIndex(capInfo);
+    UpdateDeviceCapabilityVersion(capInfo->GetDeviceId());
+}
+
+void CapabilityInfoManager::EraseCapabilityInMem(const std::string &key)
+{
+    auto iter = globalCapInfoMap_.find(key);
+    if (iter == globalCapInfoMap_.end()) {
+        return;
+    }
+    if (iter->second != nullptr) {
+        RemoveCapabilityIndex(iter->second);
+        UpdateDeviceCapabilityVersion(iter->second->GetDeviceId());
+    }
+    globalCapInfoMap_.erase(iter);
+}
+
+void CapabilityInfoManager::EraseDeviceCapabilitiesInMem(const std::string &deviceId)
+{
+    std::vector<std::string> keys;
+    GetKeysByDeviceId(deviceId, keys);
+    for (const auto &key : keys) {
+        DHLOGI("Clear globalCapInfoMap_ iter: %{public}s", GetAnonyString(key).c_str());
+        EraseCapabilityInMem(key);
+    }
+    deviceIdIndex_.erase(deviceId);
+}
+
+void CapabilityInfoManager::UpdateDeviceCapabilityVersion(const std::string &deviceId)
+{
+    deviceCapVersions_[deviceId] = ++capVersionSeq_;
+}
+
+void CapabilityInfoManager::AddCapabilityIndex(const std::shared_ptr<CapabilityInfo> &capInfo)
+{
+    const std::string key = capInfo->GetKey();
+    deviceIdIndex_[capInfo->GetDeviceId()][capInfo->GetDHType()].insert(key);
+    dhTypeIndex_[capInfo->GetDHType()].insert(key);
+}
+
+void CapabilityInfoManager::RemoveCapabilityIndex(const std::shared_ptr<CapabilityInfo> &capInfo)
+{
+    const std::string key = capInfo->GetKey();
+    auto devIter = deviceIdIndex_.find(capInfo->GetDeviceId());
+    if (devIter != deviceIdIndex_.end()) {
+        auto typeIter = devIter->second.find(capInfo->GetDHType());
+        if (typeIter != devIter->second.end()) {
+            typeIter->second.erase(key);
+            if (typeIter->second.empty()) {
+                devIter->second.erase(typeIter);
+            }
+        }
+        if (devIter->second.empty()) {
+            deviceIdIndex_.erase(devIter);
+        }
+    }
+    auto typeIter = dhTypeIndex_.find(capInfo->GetDHType());
+    if (typeIter != dhTypeIndex_.end()) {
+        typeIter->second.erase(key);
+        if (typeIter->second.empty()) {
+            dhTypeIndex_.erase(typeIter);
+        }
+    }
+}
+
+void CapabilityInfoManager::GetKeysByDeviceId(const std::string &deviceId, std::vector<std::string> &keys)
+{
+    auto devIter = deviceIdIndex_.find(deviceId);
+    if (devIter == deviceIdIndex_.end()) {
+        return;
+    }
+    for (const auto &typeKeys : devIter->second) {
+        keys.insert(keys.end(), typeKeys.second.begin(), typeKeys.second.end());
+    }
+}
+
 void CapabilityInfoManager::OnChange(const DistributedKv::ChangeNotification &changeNotification)
 {
     DHLOGI("CapabilityInfoManager: DB data OnChange");
@@ -401,7 +536,7 @@ void CapabilityInfoManager::HandleCapabilityAddChange(const std::vector<Distribu
 
         const auto keyString = capPtr->GetKey();
         DHLOGI("Add capability key: %{public}s", capPtr->GetAnonymousKey().c_str());
-        globalCapInfoMap_[keyString] = capPtr;
+        PutCapabilityInMem(capPtr);
         TaskParam taskParam = {
             .networkId = networkId,
             .uuid = uuid,
@@ -445,7 +580,7 @@ void CapabilityInfoManager::HandleCapabilityUpdateChange(const std::vector<Distr
         }
         const auto keyString = capPtr->GetKey();
         DHLOGI("Update capability key: %{public}s", capPtr->GetAnonymousKey().c_str());
-        globalCapInfoMap_[keyString] = capPtr;
+        PutCapabilityInMem(capPtr);
         TaskParam taskParam = {
             .networkId = networkId,
             .uuid = uuid,
@@ -491,7 +626,7 @@ void CapabilityInfoManager::HandleCapabilityDeleteChange(const std::vector<Distr
         auto task = TaskFactory::GetInstance().CreateTask(TaskType::DISABLE, taskParam, nullptr);
         TaskExecutor::GetInstance().PushTask(task);
         DHLOGI("Delete capability key: %{public}s", capPtr->GetAnonymousKey().c_str());
-        globalCapInfoMap_.erase(keyString);
+        EraseCapabilityInMem(keyString);
     }
 }
 
@@ -546,13 +681,26 @@ void CapabilityInfoManager::GetCapabilitiesByDeviceId(const std::string &deviceI
         return;
     }
     std::lock_guard<std::mutex> lock(capInfoMgrMutex_);
-    for (auto &capabilityInfo : globalCapInfoMap_) {
-        if (IsCapKeyMatchDeviceId(capabilityInfo.first, deviceId)) {
-            resInfos.emplace_back(capabilityInfo.second);
+    std::vector<std::string> keys;
+    GetKeysByDeviceId(deviceId, keys);
+    for (const auto &key : keys) {
+        auto iter = globalCapInfoMap_.find(key);
+        if (iter != globalCapInfoMap_.end()) {
+            resInfos.emplace_back(iter->second);
         }
     }
 }
 
+uint64_t CapabilityInfoManager::GetDeviceCapabilityVersion(const std::string &deviceId)
+{
+    std::lock_guard<std::mutex> lock(capInfoMgrMutex_);
+    auto iter = deviceCapVersions_.find(deviceId);
+    if (iter == deviceCapVersions_.end()) {
+        return 0;
+    }
+    return iter->second;
+}
+
 bool CapabilityInfoManager::HasCapability(const std::string &deviceId, const std::string &dhId)
 {
     if (!IsIdLengthValid(deviceId) || !IsIdLengthValid(dhId)) {
@@ -603,11 +751,15 @@ int32_t CapabilityInfoManager::GetDataByKey(const std::string &key, std::shared_
 int32_t CapabilityInfoManager::GetDataByDHType(const DHType dhType, CapabilityInfoMap &capabilityMap)
 {
     std::lock_guard<std::mutex> lock(capInfoMgrMutex_);
-    for (const auto &capInfo : globalCapInfoMap_) {
-        if (capInfo.second->GetDHType() != dhType) {
-            continue;
+    auto typeIter = dhTypeIndex_.find(dhType);
+    if (typeIter == dhTypeIndex_.end()) {
+        return DH_FWK_SUCCESS;
+    }
+    for (const auto &key : typeIter->second) {
+        auto iter = globalCapInfoMap_.find(key);
+        if (iter != globalCapInfoMap_.end() && iter->second != nullptr && iter->second->GetDHType() == dhType) {
+            capabilityMap[iter->first] = iter->second;
         }
-        capabilityMap[capInfo.first] = capInfo.second;
     }
     return DH_FWK_SUCCESS;
 }
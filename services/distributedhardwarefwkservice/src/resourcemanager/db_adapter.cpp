@@ -15,8 +15,12 @@
 
 #include "db_adapter.h"
 
+#include <algorithm>
+#include <functional>
 #include <vector>
 
+#include "ffrt.h"
+
 #include "anonymous_string.h"
 #include "capability_info.h"
 #include "capability_info_manager.h"
@@ -41,6 +45,15 @@ namespace {
     constexpr int32_t DIED_CHECK_MAX_TIMES = 300;
     constexpr int32_t DIED_CHECK_INTERVAL = 100 * 1000; // 100ms
     const std::string DATABASE_DIR = "/data/service/el1/public/database/";
+    constexpr size_t WRITE_BEHIND_MAX_DIRTY_NUM = 32;
+    constexpr uint64_t WRITE_BEHIND_FLUSH_DELAY_US = 100 * 1000; // 100ms
+    constexpr uint64_t WRITE_BEHIND_MAX_RETRY_DELAY_US = 5 * 1000 * 1000; // 5s
+    constexpr uint32_t WRITE_BEHIND_MAX_BACKOFF_SHIFT = 6;
+
+    size_t GetValueDigest(const std::string &value)
+    {
+        return std::hash<std::string>{}(value);
+    }
 }
 
 DBAdapter::DBAdapter(const std::string &appId, const std::string &storeId,
@@ -158,6 +171,9 @@ int32_t DBAdapter::InitLocal()
 void DBAdapter::UnInit()
 {
     DHLOGI("DBAdapter UnInit");
+    if (FlushDirtyData() != DH_FWK_SUCCESS) {
+        DHLOGE("Flush dirty data before uninit failed, storeId: %{public}s", storeId_.storeId.c_str());
+    }
     std::lock_guard<std::mutex> lock(dbAdapterMutex_);
     if (kvStoragePtr_ == nullptr) {
         DHLOGE("kvStoragePtr_ is null");
@@ -173,6 +189,11 @@ void DBAdapter::UnInit()
 int32_t DBAdapter::ReInit(bool isAutoSync)
 {
     DHLOGI("ReInit DB, storeId: %{public}s", storeId_.storeId.c_str());
+    {
+        // the recovered store may not hold what was written before, so compare against it again
+        std::lock_guard<std::mutex> writeLock(writeBehindMutex_);
+        valueDigests_.clear();
+    }
     std::lock_guard<std::mutex> lock(dbAdapterMutex_);
     if (kvStoragePtr_ == nullptr) {
         DHLOGE("kvStoragePtr_ is null");
@@ -244,6 +265,14 @@ int32_t DBAdapter::GetDataByKey(const std::string &key, std::string &data)
     }
     DHLOGI("Get data by key: %{public}s, storeId: %{public}s, dataType: %{public}d",
         GetAnonyString(key).c_str(), storeId_.storeId.c_str(), static_cast<int32_t>(this->dataType_));
+    {
+        std::lock_guard<std::mutex> writeLock(writeBehindMutex_);
+        auto iter = dirtyEntries_.find(key);
+        if (iter != dirtyEntries_.end()) {
+            data = iter->second;
+            return DH_FWK_SUCCESS;
+        }
+    }
     std::lock_guard<std::mutex> lock(dbAdapterMutex_);
     if (kvStoragePtr_ == nullptr) {
         DHLOGE("kvStoragePtr_ is null");
@@ -274,6 +303,8 @@ int32_t DBAdapter::GetDataByKeyPrefix(const std::string &keyPrefix, std::vector<
 {
     DHLOGI("Get data by key prefix: %{public}s, storeId: %{public}s, dataType: %{public}d",
         GetAnonyString(keyPrefix).c_str(), storeId_.storeId.c_str(), static_cast<int32_t>(this->dataType_));
+    std::lock_guard<std::mutex> writeLock(writeBehindMutex_);
+    FlushDirtyDataInner();
     std::lock_guard<std::mutex> lock(dbAdapterMutex_);
     if (kvStoragePtr_ == nullptr) {
         DHLOGE("kvStoragePtr_ is null");
@@ -303,6 +334,7 @@ int32_t DBAdapter::GetDataByKeyPrefix(const std::string &keyPrefix, std::vector<
     }
     for (const auto& item : allEntries) {
         values.push_back(item.value.ToString());
+        UpdateValueDigest(item.key.ToString(), values.back());
     }
     return DH_FWK_SUCCESS;
 }
@@ -312,6 +344,10 @@ int32_t DBAdapter::PutData(const std::string &key, const std::string &value)
     if (!IsIdLengthValid(key) || !IsMessageLengthValid(value)) {
         return ERR_DH_FWK_PARA_INVALID;
     }
+    std::lock_guard<std::mutex> writeLock(writeBehindMutex_);
+    // a direct put supersedes the pending value of the key
+    dirtyEntries_.erase(key);
+    valueDigests_.erase(key);
     std::lock_guard<std::mutex> lock(dbAdapterMutex_);
     if (kvStoragePtr_ == nullptr) {
         DHLOGE("kvStoragePtr_ is null");
@@ -324,6 +360,9 @@ int32_t DBAdapter::PutData(const std::string &key, const std::string &value)
         DHLOGE("Put kv to db failed, ret: %{public}d", status);
         return ERR_DH_FWK_RESOURCE_KV_STORAGE_OPERATION_FAIL;
     }
+    if (status == DistributedKv::Status::SUCCESS) {
+        UpdateValueDigest(key, value);
+    }
     return DH_FWK_SUCCESS;
 }
 
@@ -332,6 +371,106 @@ int32_t DBAdapter::PutDataBatch(const std::vector<std::string> &keys, const std:
     if (!IsArrayLengthValid(keys) || !IsArrayLengthValid(values)) {
         return ERR_DH_FWK_PARA_INVALID;
     }
+    std::lock_guard<std::mutex> writeLock(writeBehindMutex_);
+    for (const auto &key : keys) {
+        dirtyEntries_.erase(key);
+        valueDigests_.erase(key);
+    }
+    int32_t ret = PutDataBatchInner(keys, values);
+    if (ret != DH_FWK_SUCCESS) {
+        return ret;
+    }
+    for (size_t i = 0; i < keys.size(); i++) {
+        UpdateValueDigest(keys[i], values[i]);
+    }
+    return DH_FWK_SUCCESS;
+}
+
+int32_t DBAdapter::PutDataDeferred(const std::string &key, const std::string &value)
+{
+    if (!IsIdLengthValid(key) || !IsMessageLengthValid(value)) {
+        return ERR_DH_FWK_PARA_INVALID;
+    }
+    std::lock_guard<std::mutex> writeLock(writeBehindMutex_);
+    auto iter = valueDigests_.find(key);
+    if (iter != valueDigests_.end() && iter->second == GetValueDigest(value)) {
+        DHLOGD("Value not changed, key: %{public}s", GetAnonyString(key).c_str());
+        return DH_FWK_SUCCESS;
+    }
+    dirtyEntries_[key] = value;
+    UpdateValueDigest(key, value);
+    if (dirtyEntries_.size() >= WRITE_BEHIND_MAX_DIRTY_NUM) {
+        return FlushDirtyDataInner();
+    }
+    ScheduleDirtyDataFlush();
+    return DH_FWK_SUCCESS;
+}
+
+int32_t DBAdapter::FlushDirtyData()
+{
+    std::lock_guard<std::mutex> writeLock(writeBehindMutex_);
+    return FlushDirtyDataInner();
+}
+
+int32_t DBAdapter::FlushDirtyDataInner()
+{
+    if (dirtyEntries_.empty()) {
+        return DH_FWK_SUCCESS;
+    }
+    std::vector<std::string> keys;
+    std::vector<std::string> values;
+    for (const auto &item : dirtyEntries_) {
+        keys.push_back(item.first);
+        values.push_back(item.second);
+    }
+    int32_t ret = PutDataBatchInner(keys, values);
+    if (ret != DH_FWK_SUCCESS) {
+        // keep the entries dirty for the next flush, but do not trust their digests any more
+        DHLOGE("Flush dirty data failed, size: %{public}zu, ret: %{public}d", keys.size(), ret);
+        for (const auto &key : keys) {
+            valueDigests_.erase(key);
+        }
+        // a closed store is flushed again by the next write after init, retry the others with backoff
+        if (ret != ERR_DH_FWK_RESOURCE_KV_STORAGE_POINTER_NULL) {
+            flushRetryTimes_++;
+            ScheduleDirtyDataFlush();
+        }
+        return ret;
+    }
+    DHLOGI("Flush dirty data success, storeId: %{public}s, size: %{public}zu", storeId_.storeId.c_str(),
+        keys.size());
+    dirtyEntries_.clear();
+    flushRetryTimes_ = 0;
+    return DH_FWK_SUCCESS;
+}
+
+void DBAdapter::ScheduleDirtyDataFlush()
+{
+    if (isFlushScheduled_) {
+        return;
+    }
+    isFlushScheduled_ = true;
+    uint64_t delayUs = std::min(WRITE_BEHIND_FLUSH_DELAY_US <<
+        std::min(flushRetryTimes_, WRITE_BEHIND_MAX_BACKOFF_SHIFT), WRITE_BEHIND_MAX_RETRY_DELAY_US);
+    std::weak_ptr<DBAdapter> weakSelf = shared_from_this();
+    ffrt::submit([weakSelf]() {
+        auto self = weakSelf.lock();
+        if (self == nullptr) {
+            return;
+        }
+        std::lock_guard<std::mutex> writeLock(self->writeBehindMutex_);
+        self->isFlushScheduled_ = false;
+        self->FlushDirtyDataInner();
+    }, {}, {}, ffrt::task_attr().delay(delayUs));
+}
+
+void DBAdapter::UpdateValueDigest(const std::string &key, const std::string &value)
+{
+    valueDigests_[key] = GetValueDigest(value);
+}
+
+int32_t DBAdapter::PutDataBatchInner(const std::vector<std::string> &keys, const std::vector<std::string> &values)
+{
     std::lock_guard<std::mutex> lock(dbAdapterMutex_);
     if (kvStoragePtr_ == nullptr) {
         DHLOGE("kvStoragePtr_ is null");
@@ -470,6 +609,9 @@ bool DBAdapter::DBDiedOpt(int32_t &times)
 
 void DBAdapter::DeleteKvStore()
 {
+    std::lock_guard<std::mutex> writeLock(writeBehindMutex_);
+    dirtyEntries_.clear();
+    valueDigests_.clear();
     std::lock_guard<std::mutex> lock(dbAdapterMutex_);
     DistributedKv::Status status = kvDataMgr_.DeleteKvStore(appId_, storeId_);
     if (status != DistributedKv::Status::SUCCESS) {
@@ -485,6 +627,9 @@ int32_t DBAdapter::RemoveDeviceData(const std::string &deviceId)
     if (!IsIdLengthValid(deviceId)) {
         return ERR_DH_FWK_PARA_INVALID;
     }
+    std::lock_guard<std::mutex> writeLock(writeBehindMutex_);
+    FlushDirtyDataInner();
+    valueDigests_.clear();
     std::lock_guard<std::mutex> lock(dbAdapterMutex_);
     if (kvStoragePtr_ == nullptr) {
         DHLOGE("kvStoragePtr_ is null");
@@ -504,6 +649,9 @@ int32_t DBAdapter::RemoveDataByKey(const std::string &key)
     if (!IsIdLengthValid(key)) {
         return ERR_DH_FWK_PARA_INVALID;
     }
+    std::lock_guard<std::mutex> writeLock(writeBehindMutex_);
+    dirtyEntries_.erase(key);
+    valueDigests_.erase(key);
     std::lock_guard<std::mutex> lock(dbAdapterMutex_);
     if (kvStoragePtr_ == nullptr) {
         DHLOGE("kvStoragePtr_ is null");
@@ -519,12 +667,39 @@ int32_t DBAdapter::RemoveDataByKey(const std::string &key)
     return DH_FWK_SUCCESS;
 }
 
+int32_t DBAdapter::RemoveDataBatch(const std::vector<std::string> &keys)
+{
+    if (keys.empty() || !IsArrayLengthValid(keys)) {
+        return ERR_DH_FWK_PARA_INVALID;
+    }
+    std::lock_guard<std::mutex> writeLock(writeBehindMutex_);
+    std::vector<DistributedKv::Key> kvKeys;
+    for (const auto &key : keys) {
+        dirtyEntries_.erase(key);
+        valueDigests_.erase(key);
+        kvKeys.emplace_back(key);
+    }
+    std::lock_guard<std::mutex> lock(dbAdapterMutex_);
+    if (kvStoragePtr_ == nullptr) {
+        DHLOGE("kvStoragePtr_ is null");
+        return ERR_DH_FWK_RESOURCE_KV_STORAGE_POINTER_NULL;
+    }
+    DistributedKv::Status status = kvStoragePtr_->DeleteBatch(kvKeys);
+    if (status != DistributedKv::Status::SUCCESS) {
+        DHLOGE("Remove data batch failed, ret: %{public}d", status);
+        return ERR_DH_FWK_RESOURCE_KV_STORAGE_OPERATION_FAIL;
+    }
+    DHLOGD("Remove data batch success, size: %{public}zu", keys.size());
+    return DH_FWK_SUCCESS;
+}
+
 std::vector<DistributedKv::Entry> DBAdapter::GetEntriesByKeys(const std::vector<std::string> &keys)
 {
     if (!IsArrayLengthValid(keys)) {
         return {};
     }
     DHLOGI("call");
+    FlushDirtyData();
     std::vector<DistributedKv::Entry> entries;
     {
         std::lock_guard<std::mutex> lock(dbAdapterMutex_);
@@ -568,6 +743,9 @@ bool DBAdapter::SyncDataByNetworkId(const std::string &networkId)
 bool DBAdapter::ClearDataWhenPeerLogout(const std::string &peerudid, const std::string &peeruuid)
 {
     DHLOGI("Clear cloudData start.");
+    std::lock_guard<std::mutex> writeLock(writeBehindMutex_);
+    FlushDirtyDataInner();
+    valueDigests_.clear();
     std::lock_guard<std::mutex> lock(dbAdapterMutex_);
     if (kvStoragePtr_ == nullptr) {
         DHLOGE("kvStoragePtr_ is nullptr!");
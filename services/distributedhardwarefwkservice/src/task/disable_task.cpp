@@ -51,7 +51,11 @@ DisableTask::~DisableTask()
 
 void DisableTask::DoTask()
 {
-    ffrt::submit([this]() { this->DoTaskInner(); });
+    auto task = shared_from_this();
+    ffrt::submit([this, task]() {
+        this->DoTaskInner();
+        task->NotifyTaskFinish();
+    });
 }
 
 void DisableTask::DoTaskInner()
@@ -50,7 +50,11 @@ EnableTask::~EnableTask()
 
 void EnableTask::DoTask()
 {
-    ffrt::submit([this]() { this->DoTaskInner(); });
+    auto task = shared_from_this();
+    ffrt::submit([this, task]() {
+        this->DoTaskInner();
+        task->NotifyTaskFinish();
+    });
 }
 
 void EnableTask::DoTaskInner()
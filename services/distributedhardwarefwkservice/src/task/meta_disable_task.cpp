@@ -48,7 +48,11 @@ MetaDisableTask::~MetaDisableTask()
 
 void MetaDisableTask::DoTask()
 {
-    ffrt::submit([this]() { this->DoTaskInner(); });
+    auto task = shared_from_this();
+    ffrt::submit([this, task]() {
+        this->DoTaskInner();
+        task->NotifyTaskFinish();
+    });
 }
 
 void MetaDisableTask::DoTaskInner()
@@ -56,7 +56,11 @@ OffLineTask::~OffLineTask()
 
 void OffLineTask::DoTask()
 {
-    ffrt::submit([this]() { this->DoTaskInner(); });
+    auto task = shared_from_this();
+    ffrt::submit([this, task]() {
+        this->DoTaskInner();
+        task->NotifyTaskFinish();
+    });
 }
 
 void OffLineTask::DoTaskInner()
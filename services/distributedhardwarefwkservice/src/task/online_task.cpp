@@ -76,6 +76,7 @@ void OnLineTask::DoTask()
     SetTaskState(TaskState::SUCCESS);
     DHLOGD("finish online task, remove it, id = %{public}s.", GetId().c_str());
     TaskBoard::GetInstance().RemoveTask(this->GetId());
+    NotifyTaskFinish();
 }
 
 void OnLineTask::DoSyncInfo()
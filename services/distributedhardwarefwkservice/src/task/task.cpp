@@ -111,5 +111,23 @@ void Task::SetFatherTask(std::shared_ptr<Task> fatherTask)
 {
     this->fatherTask_ = fatherTask;
 }
+
+void Task::SetFinishCallback(std::function<void()> finishCallback)
+{
+    std::lock_guard<std::mutex> lock(taskMtx_);
+    this->finishCallback_ = std::move(finishCallback);
+}
+
+void Task::NotifyTaskFinish()
+{
+    std::function<void()> finishCallback = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(taskMtx_);
+        finishCallback.swap(this->finishCallback_);
+    }
+    if (finishCallback != nullptr) {
+        finishCallback();
+    }
+}
 } // namespace DistributedHardware
 } // namespace OHOS
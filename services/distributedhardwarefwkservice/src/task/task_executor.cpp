@@ -15,70 +15,196 @@
 
 #include "task_executor.h"
 
+#include <algorithm>
+#include <cinttypes>
 #include <pthread.h>
-#include <thread>
-
-#include "ffrt.h"
 
+#include "anonymous_string.h"
 #include "constants.h"
 #include "dh_context.h"
+#include "dh_utils_tool.h"
 #include "distributed_hardware_errno.h"
 #include "distributed_hardware_log.h"
+#include "offline_task.h"
+#include "task_board.h"
 
 namespace OHOS {
 namespace DistributedHardware {
 namespace {
     const uint32_t MAX_TASK_QUEUE_LENGTH = 256;
+    /* Offline and disable tasks may exceed MAX_TASK_QUEUE_LENGTH up to this hard limit */
+    const uint32_t MAX_HIGH_PRIORITY_TASK_QUEUE_LENGTH = 512;
+    const uint32_t TASK_EXECUTOR_WORKER_NUM = 4;
 }
 IMPLEMENT_SINGLE_INSTANCE(TaskExecutor);
 TaskExecutor::TaskExecutor() : taskThreadFlag_(true)
 {
     DHLOGI("Ctor TaskExecutor");
-    ffrt::submit([this]() { this->TriggerTask(); });
+    /* Online tasks sync the DB in place, dispatch on a few dedicated threads so one device does not stall others */
+    for (uint32_t i = 0; i < TASK_EXECUTOR_WORKER_NUM; i++) {
+        workers_.emplace_back([this]() { this->TriggerTask(); });
+    }
 }
 
 TaskExecutor::~TaskExecutor()
 {
     DHLOGI("Dtor TaskExecutor");
     taskThreadFlag_ = false;
+    condVar_.notify_all();
+    for (auto &worker : workers_) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
 }
 
-void TaskExecutor::PushTask(const std::shared_ptr<Task> task)
+TaskPriority TaskExecutor::GetTaskPriority(const std::shared_ptr<Task> &task)
+{
+    switch (task->GetTaskType()) {
+        case TaskType::OFF_LINE:
+        case TaskType::DISABLE:
+        case TaskType::META_DISABLE:
+            return TaskPriority::HIGH;
+        case TaskType::ON_LINE:
+            return TaskPriority::NORMAL;
+        default:
+            return TaskPriority::LOW;
+    }
+}
+
+bool TaskExecutor::IsAheadOf(const TaskItem &item, const TaskItem &other)
+{
+    if (item.priority != other.priority) {
+        return static_cast<uint32_t>(item.priority) < static_cast<uint32_t>(other.priority);
+    }
+    return item.seq < other.seq;
+}
+
+int32_t TaskExecutor::PushTask(const std::shared_ptr<Task> task)
 {
     if (task == nullptr) {
         DHLOGE("Task is null");
-        return;
+        return ERR_DH_FWK_PARA_INVALID;
     }
 
+    TaskPriority priority = GetTaskPriority(task);
     {
-        DHLOGI("Push task: %{public}s", task->GetId().c_str());
+        DHLOGI("Push task: %{public}s, priority: %{public}u", task->GetId().c_str(),
+            static_cast<uint32_t>(priority));
         std::unique_lock<std::mutex> lock(taskQueueMtx_);
-        if (taskQueue_.size() > MAX_TASK_QUEUE_LENGTH) {
-            DHLOGE("Task queue is full");
-            return;
+        uint32_t maxLength = (priority == TaskPriority::HIGH) ? MAX_HIGH_PRIORITY_TASK_QUEUE_LENGTH :
+            MAX_TASK_QUEUE_LENGTH;
+        if (queueDepth_ >= maxLength) {
+            stats_.rejectedCount++;
+            lock.unlock();
+            DHLOGE("Task queue is full, reject task: %{public}s", task->GetId().c_str());
+            RejectTask(task);
+            return ERR_DH_FWK_TASK_QUEUE_FULL;
         }
-        taskQueue_.push(task);
+        deviceLanes_[task->GetUUID()].push_back({ task, priority, stats_.pushedCount, GetCurrentTime() });
+        queueDepth_++;
+        stats_.pushedCount++;
+        stats_.maxQueueDepth = std::max(stats_.maxQueueDepth, queueDepth_);
     }
 
     condVar_.notify_one();
+    return DH_FWK_SUCCESS;
+}
+
+void TaskExecutor::RejectTask(const std::shared_ptr<Task> &task)
+{
+    task->SetTaskState(TaskState::FAIL);
+    std::shared_ptr<Task> father = task->GetFatherTask().lock();
+    if (father != nullptr && father->GetTaskType() == TaskType::OFF_LINE) {
+        std::static_pointer_cast<OffLineTask>(father)->NotifyFatherFinish(task->GetId());
+    }
+    TaskBoard::GetInstance().RemoveTask(task->GetId());
+}
+
+TaskExecutorStats TaskExecutor::GetStats()
+{
+    std::lock_guard<std::mutex> lock(taskQueueMtx_);
+    TaskExecutorStats stats = stats_;
+    stats.queueDepth = queueDepth_;
+    return stats;
+}
+
+std::deque<TaskExecutor::TaskItem>::iterator TaskExecutor::FindReadyTask(const std::string &uuid,
+    std::deque<TaskItem> &lane)
+{
+    auto running = runningTasks_.find(uuid);
+    if (running == runningTasks_.end() || running->second.empty()) {
+        return lane.begin();
+    }
+    // the running task may wait for its children, so they run inside it instead of queueing behind it
+    const std::string &runningId = running->second.back();
+    return std::find_if(lane.begin(), lane.end(), [&runningId](const TaskItem &item) {
+        std::shared_ptr<Task> father = item.task->GetFatherTask().lock();
+        return father != nullptr && father->GetId() == runningId;
+    });
+}
+
+bool TaskExecutor::PopReadyTask(TaskItem &item)
+{
+    auto readyLane = deviceLanes_.end();
+    std::deque<TaskItem>::iterator readyTask;
+    for (auto lane = deviceLanes_.begin(); lane != deviceLanes_.end(); lane++) {
+        auto iter = FindReadyTask(lane->first, lane->second);
+        if (iter == lane->second.end()) {
+            continue;
+        }
+        if (readyLane == deviceLanes_.end() || IsAheadOf(*iter, *readyTask)) {
+            readyLane = lane;
+            readyTask = iter;
+        }
+    }
+    if (readyLane == deviceLanes_.end()) {
+        return false;
+    }
+    item = *readyTask;
+    readyLane->second.erase(readyTask);
+    if (readyLane->second.empty()) {
+        deviceLanes_.erase(readyLane);
+    }
+    return true;
 }
 
 std::shared_ptr<Task> TaskExecutor::PopTask()
 {
-    std::shared_ptr<Task> task = nullptr;
+    TaskItem item = { nullptr, TaskPriority::LOW, 0, 0 };
 
     std::unique_lock<std::mutex> lock(taskQueueMtx_);
-    condVar_.wait(lock, [this] {
-        return !(this->taskQueue_.empty());
+    condVar_.wait(lock, [this, &item] {
+        return !taskThreadFlag_ || PopReadyTask(item);
     });
-
-    if (!taskQueue_.empty()) {
-        task = taskQueue_.front();
-        taskQueue_.pop();
-        DHLOGI("Pop task: %{public}s", task->GetId().c_str());
+    if (item.task == nullptr) {
+        return nullptr;
     }
 
-    return task;
+    queueDepth_--;
+    runningTasks_[item.task->GetUUID()].push_back(item.task->GetId());
+    int64_t waitTime = GetCurrentTime() - item.enqueueTime;
+    stats_.totalWaitTimeMs += waitTime;
+    stats_.maxWaitTimeMs = std::max(stats_.maxWaitTimeMs, waitTime);
+    DHLOGI("Pop task: %{public}s, wait time: %{public}" PRId64 " ms", item.task->GetId().c_str(), waitTime);
+    return item.task;
+}
+
+void TaskExecutor::FinishTask(const std::shared_ptr<Task> &task)
+{
+    {
+        std::lock_guard<std::mutex> lock(taskQueueMtx_);
+        auto running = runningTasks_.find(task->GetUUID());
+        if (running != runningTasks_.end()) {
+            auto &taskIds = running->second;
+            taskIds.erase(std::remove(taskIds.begin(), taskIds.end(), task->GetId()), taskIds.end());
+            if (taskIds.empty()) {
+                runningTasks_.erase(running);
+            }
+        }
+        stats_.executedCount++;
+    }
+    condVar_.notify_all();
 }
 
 void TaskExecutor::TriggerTask()
@@ -90,16 +216,15 @@ void TaskExecutor::TriggerTask()
     while (taskThreadFlag_) {
         std::shared_ptr<Task> task = PopTask();
         if (task == nullptr) {
-            DHLOGE("Pop a null task, error");
-            continue;
+            // only returned when the executor is stopping
+            break;
         }
 
-        auto taskFunc = [task]() {
-            task->DoTask();
-        };
-
-        DHLOGI("Post task to EventBus: %{public}s", task->GetId().c_str());
-        DHContext::GetInstance().GetEventHandler()->PostTask(taskFunc, task->GetId());
+        DHLOGI("Execute task: %{public}s, uuid: %{public}s", task->GetId().c_str(),
+            GetAnonyString(task->GetUUID()).c_str());
+        // most tasks run their body on ffrt, the device stays busy until the body reports back
+        task->SetFinishCallback([this, task]() { this->FinishTask(task); });
+        task->DoTask();
     }
 }
 } // namespace DistributedHardware
@@ -20,12 +20,14 @@
 #include "anonymous_string.h"
 #include "capability_info_manager.h"
 #include "component_manager.h"
+#include "constants.h"
 #include "dh_context.h"
 #include "dh_transport_obj.h"
 #include "dh_utils_tool.h"
 #include "distributed_hardware_errno.h"
 #include "distributed_hardware_log.h"
 #include "local_capability_info_manager.h"
+#include "task_board.h"
 #include "task_executor.h"
 
 namespace OHOS {
@@ -79,7 +81,27 @@ void DHCommTool::TriggerReqFullDHCaps(const std::string &remoteNetworkId)
         DHLOGE("Start socket error");
         return;
     }
-    CommMsg commMsg(DH_COMM_REQ_FULL_CAPS, localNetworkId);
+    // carry the digest of the caps already saved, so the remote only send back the changed ones
+    std::string capsDigest;
+    std::unordered_set<std::string> digestKeys;
+    std::string uuid = DHContext::GetInstance().GetUUIDByNetworkId(remoteNetworkId);
+    if (!uuid.empty()) {
+        std::vector<std::shared_ptr<CapabilityInfo>> savedCaps;
+        LocalCapabilityInfoManager::GetInstance()->GetCapabilitiesByDeviceId(GetDeviceIdByUUID(uuid), savedCaps);
+        if (!savedCaps.empty()) {
+            capsDigest = GetCapsDigestString(savedCaps);
+        }
+        for (auto const &cap : savedCaps) {
+            if (cap != nullptr) {
+                digestKeys.insert(cap->GetKey());
+            }
+        }
+    }
+    {
+        std::lock_guard<std::mutex> lock(reqDigestMtx_);
+        reqDigestKeys_[remoteNetworkId] = digestKeys;
+    }
+    CommMsg commMsg(DH_COMM_REQ_FULL_CAPS, localNetworkId, capsDigest);
     std::string payload = GetCommMsgString(commMsg);
 
     int32_t ret = dhTransportPtr_->Send(remoteNetworkId, payload);
@@ -90,7 +112,7 @@ void DHCommTool::TriggerReqFullDHCaps(const std::string &remoteNetworkId)
     DHLOGI("Trigger req remote full attrs success.");
 }
 
-void DHCommTool::GetAndSendLocalFullCaps(const std::string &reqNetworkId)
+void DHCommTool::GetAndSendLocalFullCaps(const std::string &reqNetworkId, const std::string &capsDigest)
 {
     DHLOGI("GetAndSendLocalFullCaps, reqNetworkId: %{public}s", GetAnonyString(reqNetworkId).c_str());
     if (dhTransportPtr_ == nullptr) {
@@ -102,7 +124,17 @@ void DHCommTool::GetAndSendLocalFullCaps(const std::string &reqNetworkId)
     CapabilityInfoManager::GetInstance()->GetCapabilitiesByDeviceId(localDeviceId, resInfos);
     FullCapsRsp capsRsp;
     capsRsp.networkId = GetLocalNetworkId();
-    capsRsp.caps = resInfos;
+    cJSON *digestJson = capsDigest.empty() ? nullptr : cJSON_Parse(capsDigest.c_str());
+    if (digestJson != nullptr) {
+        CapsDigest reqDigest;
+        FromJson(digestJson, reqDigest);
+        cJSON_Delete(digestJson);
+        GetDeltaCaps(reqDigest, resInfos, capsRsp);
+        DHLOGI("Send delta caps, total: %{public}zu, changed: %{public}zu, removed: %{public}zu",
+            resInfos.size(), capsRsp.caps.size(), capsRsp.removedKeys.size());
+    } else {
+        capsRsp.caps = resInfos;
+    }
     cJSON *root = cJSON_CreateObject();
     if (root == nullptr) {
         DHLOGE("Create cJSON object failed.");
@@ -141,6 +173,11 @@ FullCapsRsp DHCommTool::ParseAndSaveRemoteDHCaps(const std::string &remoteCaps)
 
     FromJson(root, capsRsp);
     cJSON_Delete(root);
+    RemoveRemoteDHCaps(capsRsp);
+    if (capsRsp.isDelta && capsRsp.caps.empty()) {
+        DHLOGI("Remote caps unchanged, removed size: %{public}zu", capsRsp.removedKeys.size());
+        return capsRsp;
+    }
     int32_t ret = LocalCapabilityInfoManager::GetInstance()->AddCapability(capsRsp.caps);
     if (ret != DH_FWK_SUCCESS) {
         DHLOGE("Save local capabilities error, ret: %{public}d", ret);
@@ -150,6 +187,54 @@ FullCapsRsp DHCommTool::ParseAndSaveRemoteDHCaps(const std::string &remoteCaps)
     return capsRsp;
 }
 
+void DHCommTool::RemoveRemoteDHCaps(FullCapsRsp &capsRsp)
+{
+    std::unordered_set<std::string> digestKeys;
+    {
+        std::lock_guard<std::mutex> lock(reqDigestMtx_);
+        auto iter = reqDigestKeys_.find(capsRsp.networkId);
+        if (iter != reqDigestKeys_.end()) {
+            digestKeys.swap(iter->second);
+            reqDigestKeys_.erase(iter);
+        }
+    }
+    if (capsRsp.removedKeys.empty()) {
+        return;
+    }
+    std::string uuid = capsRsp.networkId.empty() ? "" : DHContext::GetInstance().GetUUIDByNetworkId(capsRsp.networkId);
+    if (uuid.empty()) {
+        DHLOGE("Can not find remote device uuid, ignore removed keys, size: %{public}zu", capsRsp.removedKeys.size());
+        capsRsp.removedKeys.clear();
+        return;
+    }
+    std::string keyPrefix = GetDeviceIdByUUID(uuid) + RESOURCE_SEPARATOR;
+    std::vector<std::string> removedKeys;
+    for (auto const &key : capsRsp.removedKeys) {
+        if (key.compare(0, keyPrefix.size(), keyPrefix) != 0 || digestKeys.count(key) == 0) {
+            DHLOGW("Ignore removed key not owned by remote or not requested: %{public}s", GetAnonyString(key).c_str());
+            continue;
+        }
+        std::shared_ptr<CapabilityInfo> capInfo = nullptr;
+        if (TaskBoard::GetInstance().IsEnabledDevice(key) &&
+            LocalCapabilityInfoManager::GetInstance()->GetDataByKey(key, capInfo) == DH_FWK_SUCCESS &&
+            capInfo != nullptr) {
+            TaskParam taskParam = {
+                .networkId = capsRsp.networkId,
+                .uuid = uuid,
+                .dhId = capInfo->GetDHId(),
+                .dhType = capInfo->GetDHType()
+            };
+            auto task = TaskFactory::GetInstance().CreateTask(TaskType::DISABLE, taskParam, nullptr);
+            TaskExecutor::GetInstance().PushTask(task);
+        }
+        LocalCapabilityInfoManager::GetInstance()->RemoveCapabilityInfoByKey(key);
+        removedKeys.push_back(key);
+    }
+    DHLOGI("Remove remote caps, accepted: %{public}zu, received: %{public}zu", removedKeys.size(),
+        capsRsp.removedKeys.size());
+    capsRsp.removedKeys.swap(removedKeys);
+}
+
 DHCommTool::DHCommToolEventHandler::DHCommToolEventHandler(const std::shared_ptr<AppExecFwk::EventRunner> runner,
     std::shared_ptr<DHCommTool> dhCommToolPtr) : AppExecFwk::EventHandler(runner), dhCommToolWPtr_(dhCommToolPtr)
 {
@@ -176,7 +261,7 @@ void DHCommTool::DHCommToolEventHandler::ProcessEvent(
     }
     switch (eventId) {
         case DH_COMM_REQ_FULL_CAPS: {
-            dhCommToolPtr->GetAndSendLocalFullCaps(commMsg->msg);
+            dhCommToolPtr->GetAndSendLocalFullCaps(commMsg->msg, commMsg->capsDigest);
             break;
         }
         case DH_COMM_RSP_FULL_CAPS: {
@@ -196,7 +281,7 @@ void DHCommTool::DHCommToolEventHandler::ProcessEvent(
 void DHCommTool::DHCommToolEventHandler::ProcessFullCapsRsp(const FullCapsRsp &capsRsp,
     const std::shared_ptr<DHCommTool> dhCommToolPtr)
 {
-    if (capsRsp.networkId.empty() || capsRsp.caps.empty()) {
+    if (capsRsp.networkId.empty() || (!capsRsp.isDelta && capsRsp.caps.empty())) {
         DHLOGE("Receive remote caps info invalid!");
         return;
     }
@@ -204,6 +289,10 @@ void DHCommTool::DHCommToolEventHandler::ProcessFullCapsRsp(const FullCapsRsp &c
     DHLOGI("we receive full remote capabilities, close channel, remote networkId: %{public}s",
         GetAnonyString(capsRsp.networkId).c_str());
     dhCommToolPtr->GetDHTransportPtr()->StopSocket(capsRsp.networkId);
+    if (capsRsp.caps.empty()) {
+        DHLOGI("No changed remote caps, no need refresh");
+        return;
+    }
 
     // trigger register dh by full attrs
     std::string uuid = DHContext::GetInstance().GetUUIDByNetworkId(capsRsp.networkId);
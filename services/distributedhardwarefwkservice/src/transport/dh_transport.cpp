@@ -18,7 +18,6 @@
 #include <cinttypes>
 
 #include "cJSON.h"
-#include <securec.h>
 
 #include "anonymous_string.h"
 #include "constants.h"
@@ -37,6 +36,7 @@ namespace {
 // Dsoftbus sendBytes max message length: 4MB
 const uint32_t MAX_SEND_MSG_LENGTH = 4 * 1024 * 1024;
 const uint32_t INTERCEPT_STRING_LENGTH = 20;
+const char *COMPRESS_DICT_PARAM = "sys.dhfwk.transport.compress_dict.enable";
 static QosTV g_qosInfo[] = {
     { .qos = QOS_TYPE_MIN_BW, .value = 256 * 1024},
     { .qos = QOS_TYPE_MAX_LATENCY, .value = 8000 },
@@ -47,7 +47,7 @@ static std::weak_ptr<DHCommTool> g_dhCommToolWPtr_;
 }
 
 DHTransport::DHTransport(std::shared_ptr<DHCommTool> dhCommToolPtr) : remoteDevSocketIds_({}), localServerSocket_(-1),
-    localSocketName_(""), isSocketSvrCreateFlag_(false), dhCommToolWPtr_(dhCommToolPtr)
+    localSocketName_(""), isSocketSvrCreateFlag_(false), dhCommToolWPtr_(dhCommToolPtr), compressDictEnable_(false)
 {
     DHLOGI("Ctor DHTransport");
     g_dhCommToolWPtr_ = dhCommToolPtr;
@@ -65,6 +65,7 @@ int32_t DHTransport::OnSocketOpened(int32_t socketId, const PeerSocketInfo &info
 void DHTransport::OnSocketClosed(int32_t socketId, ShutdownReason reason)
 {
     DHLOGI("OnSocketClosed, socket: %{public}d, reason: %{public}d", socketId, (int32_t)reason);
+    RemoveSocketCompressor(socketId);
     std::lock_guard<std::mutex> lock(rmtSocketIdMtx_);
     for (auto iter = remoteDevSocketIds_.begin(); iter != remoteDevSocketIds_.end(); ++iter) {
         if (iter->second == socketId) {
@@ -87,31 +88,18 @@ void DHTransport::OnBytesReceived(int32_t socketId, const void *data, uint32_t d
         return;
     }
 
-    uint8_t *buf = reinterpret_cast<uint8_t *>(calloc(dataLen + 1, sizeof(uint8_t)));
-    if (buf == nullptr) {
-        DHLOGE("OnBytesReceived: malloc memory failed");
-        return;
-    }
-
-    if (memcpy_s(buf, dataLen + 1,  reinterpret_cast<const uint8_t *>(data), dataLen) != EOK) {
-        DHLOGE("OnBytesReceived: memcpy memory failed");
-        free(buf);
-        return;
-    }
-
-    std::string message(buf, buf + dataLen);
     DHLOGI("Receive message size: %{public}" PRIu32, dataLen);
-    HandleReceiveMessage(message);
-    free(buf);
+    // inflate straight from the softbus buffer
+    std::string rawPayload = GetSocketCompressor(socketId)->Decompress(reinterpret_cast<const char *>(data), dataLen);
+    HandleReceiveMessage(rawPayload);
     return;
 }
 
-void DHTransport::HandleReceiveMessage(const std::string &payload)
+void DHTransport::HandleReceiveMessage(const std::string &rawPayload)
 {
-    if (!IsMessageLengthValid(payload)) {
+    if (!IsMessageLengthValid(rawPayload)) {
         return;
     }
-    std::string rawPayload = Decompress(payload);
 
     cJSON *root = cJSON_Parse(rawPayload.c_str());
     if (root == NULL) {
@@ -286,6 +274,10 @@ int32_t DHTransport::Init()
     }
     isSocketSvrCreateFlag_.store(true);
     localServerSocket_ = socket;
+    bool dictEnable = false;
+    if (GetSysPara(COMPRESS_DICT_PARAM, dictEnable)) {
+        compressDictEnable_.store(dictEnable);
+    }
     DHLOGI("Finish Init DSoftBus Server Socket, socket: %{public}d", socket);
     return DH_FWK_SUCCESS;
 }
@@ -301,6 +293,10 @@ int32_t DHTransport::UnInit()
         }
         remoteDevSocketIds_.clear();
     }
+    {
+        std::lock_guard<std::mutex> lock(compressorMtx_);
+        socketCompressors_.clear();
+    }
 
     if (!isSocketSvrCreateFlag_.load()) {
         DHLOGI("DSoftBus Server Socket already remove success.");
@@ -403,9 +399,28 @@ int32_t DHTransport::StopSocket(const std::string &remoteNetworkId)
         GetAnonyString(remoteNetworkId).c_str(), socketId);
     Shutdown(socketId);
     ClearDeviceSocketOpened(remoteNetworkId);
+    RemoveSocketCompressor(socketId);
     return DH_FWK_SUCCESS;
 }
 
+std::shared_ptr<DHCompressor> DHTransport::GetSocketCompressor(int32_t socketId)
+{
+    std::lock_guard<std::mutex> lock(compressorMtx_);
+    auto iter = socketCompressors_.find(socketId);
+    if (iter != socketCompressors_.end()) {
+        return iter->second;
+    }
+    auto compressor = std::make_shared<DHCompressor>(compressDictEnable_.load());
+    socketCompressors_[socketId] = compressor;
+    return compressor;
+}
+
+void DHTransport::RemoveSocketCompressor(int32_t socketId)
+{
+    std::lock_guard<std::mutex> lock(compressorMtx_);
+    socketCompressors_.erase(socketId);
+}
+
 int32_t DHTransport::Send(const std::string &remoteNetworkId, const std::string &payload)
 {
     if (!IsIdLengthValid(remoteNetworkId) || !IsMessageLengthValid(payload)) {
@@ -416,31 +431,18 @@ int32_t DHTransport::Send(const std::string &remoteNetworkId, const std::string
         DHLOGI("The session is not open, target networkId: %{public}s", GetAnonyString(remoteNetworkId).c_str());
         return ERR_DH_FWK_COMPONENT_TRANSPORT_OPT_FAILED;
     }
-    std::string compressedPayLoad = Compress(payload);
+    std::string compressedPayLoad = GetSocketCompressor(socketId)->Compress(payload);
     uint32_t compressedPayLoadSize = compressedPayLoad.size();
     DHLOGI("Send payload size: %{public}" PRIu32 ", after compressed size: %{public}" PRIu32
         ", target networkId: %{public}s, socketId: %{public}d", static_cast<uint32_t>(payload.size()),
         compressedPayLoadSize, GetAnonyString(remoteNetworkId).c_str(), socketId);
 
-    if (compressedPayLoadSize > MAX_SEND_MSG_LENGTH) {
-        DHLOGE("Send error: msg size: %{public}" PRIu32 " too long", compressedPayLoadSize);
-        return ERR_DH_FWK_COMPONENT_TRANSPORT_OPT_FAILED;
-    }
-    uint8_t *buf = reinterpret_cast<uint8_t *>(calloc((compressedPayLoadSize), sizeof(uint8_t)));
-    if (buf == nullptr) {
-        DHLOGE("Send: malloc memory failed");
-        return ERR_DH_FWK_COMPONENT_TRANSPORT_OPT_FAILED;
-    }
-
-    if (memcpy_s(buf, compressedPayLoadSize, reinterpret_cast<const uint8_t *>(compressedPayLoad.c_str()),
-                 compressedPayLoadSize) != EOK) {
-        DHLOGE("Send: memcpy memory failed");
-        free(buf);
+    if (compressedPayLoadSize == 0 || compressedPayLoadSize > MAX_SEND_MSG_LENGTH) {
+        DHLOGE("Send error: msg size: %{public}" PRIu32 " invalid", compressedPayLoadSize);
         return ERR_DH_FWK_COMPONENT_TRANSPORT_OPT_FAILED;
     }
 
-    int32_t ret = SendBytes(socketId, buf, compressedPayLoadSize);
-    free(buf);
+    int32_t ret = SendBytes(socketId, compressedPayLoad.data(), compressedPayLoadSize);
     if (ret != DH_FWK_SUCCESS) {
         DHLOGE("dsoftbus send error, ret: %{public}d", ret);
         return ERR_DH_FWK_COMPONENT_TRANSPORT_OPT_FAILED;
@@ -43,6 +43,18 @@ void ToJson(cJSON *jsonObject, const FullCapsRsp &capsRsp)
         cJSON_AddItemToArray(capArr, capValJson);
     }
     cJSON_AddItemToObject(jsonObject, CAPS_RSP_CAPS_KEY, capArr);
+    if (!capsRsp.isDelta) {
+        return;
+    }
+    cJSON_AddBoolToObject(jsonObject, CAPS_RSP_IS_DELTA_KEY, true);
+    cJSON *removedArr = cJSON_CreateArray();
+    if (removedArr == nullptr) {
+        return;
+    }
+    for (auto const &key : capsRsp.removedKeys) {
+        cJSON_AddItemToArray(removedArr, cJSON_CreateString(key.c_str()));
+    }
+    cJSON_AddItemToObject(jsonObject, CAPS_RSP_REMOVED_KEYS_KEY, removedArr);
 }
 
 void FromJson(const cJSON *jsonObject, FullCapsRsp &capsRsp)
@@ -66,6 +78,103 @@ void FromJson(const cJSON *jsonObject, FullCapsRsp &capsRsp)
             capsRsp.caps.push_back(capPtr);
         }
     }
+    std::string keyIsDelta(CAPS_RSP_IS_DELTA_KEY);
+    if (IsBool(jsonObject, keyIsDelta)) {
+        capsRsp.isDelta = cJSON_IsTrue(cJSON_GetObjectItem(jsonObject, CAPS_RSP_IS_DELTA_KEY));
+    }
+    std::string keyRemoved(CAPS_RSP_REMOVED_KEYS_KEY);
+    if (IsArray(jsonObject, keyRemoved)) {
+        cJSON *removedArr = cJSON_GetObjectItem(jsonObject, CAPS_RSP_REMOVED_KEYS_KEY);
+        cJSON *keyItem = nullptr;
+        cJSON_ArrayForEach(keyItem, removedArr) {
+            if (cJSON_IsString(keyItem)) {
+                capsRsp.removedKeys.push_back(keyItem->valuestring);
+            }
+        }
+    }
+}
+
+void ToJson(cJSON *jsonObject, const CapsDigest &capsDigest)
+{
+    if (jsonObject == nullptr) {
+        DHLOGE("Json pointer is nullptr!");
+        return;
+    }
+    for (auto const &item : capsDigest.hashes) {
+        cJSON_AddStringToObject(jsonObject, item.first.c_str(), item.second.c_str());
+    }
+}
+
+void FromJson(const cJSON *jsonObject, CapsDigest &capsDigest)
+{
+    if (jsonObject == nullptr || !cJSON_IsObject(jsonObject)) {
+        DHLOGE("Json pointer is nullptr or not object!");
+        return;
+    }
+    cJSON *item = nullptr;
+    cJSON_ArrayForEach(item, jsonObject) {
+        if (item->string != nullptr && cJSON_IsString(item)) {
+            capsDigest.hashes[item->string] = item->valuestring;
+        }
+    }
+}
+
+std::string GetCapabilityHash(const std::shared_ptr<CapabilityInfo> &cap)
+{
+    if (cap == nullptr) {
+        return "";
+    }
+    return Sha256(cap->ToJsonString());
+}
+
+std::string GetCapsDigestString(const std::vector<std::shared_ptr<CapabilityInfo>> &caps)
+{
+    CapsDigest capsDigest;
+    for (auto const &cap : caps) {
+        if (cap == nullptr) {
+            continue;
+        }
+        capsDigest.hashes[cap->GetKey()] = GetCapabilityHash(cap);
+    }
+    cJSON *root = cJSON_CreateObject();
+    if (root == nullptr) {
+        DHLOGE("Create cJSON object failed.");
+        return "";
+    }
+    ToJson(root, capsDigest);
+    char *msg = cJSON_PrintUnformatted(root);
+    if (msg == nullptr) {
+        cJSON_Delete(root);
+        return "";
+    }
+    std::string digestStr(msg);
+    cJSON_free(msg);
+    cJSON_Delete(root);
+    return digestStr;
+}
+
+void GetDeltaCaps(const CapsDigest &capsDigest, const std::vector<std::shared_ptr<CapabilityInfo>> &localCaps,
+    FullCapsRsp &capsRsp)
+{
+    capsRsp.isDelta = true;
+    std::unordered_map<std::string, bool> localKeys;
+    for (auto const &cap : localCaps) {
+        if (cap == nullptr) {
+            continue;
+        }
+        std::string key = cap->GetKey();
+        localKeys[key] = true;
+        auto iter = capsDigest.hashes.find(key);
+        if (iter != capsDigest.hashes.end() && iter->second == GetCapabilityHash(cap)) {
+            continue;
+        }
+        capsRsp.caps.push_back(cap);
+    }
+    for (auto const &item : capsDigest.hashes) {
+        if (localKeys.find(item.first) == localKeys.end()) {
+            capsRsp.removedKeys.push_back(item.first);
+        }
+    }
 }
 
 void ToJson(cJSON *jsonObject, const CommMsg &commMsg)
@@ -77,6 +186,9 @@ void ToJson(cJSON *jsonObject, const CommMsg &commMsg)
     cJSON_AddNumberToObject(jsonObject, COMM_MSG_CODE_KEY, commMsg.code);
     const char *msg = commMsg.msg.c_str();
     cJSON_AddStringToObject(jsonObject, COMM_MSG_MSG_KEY, msg);
+    if (!commMsg.capsDigest.empty()) {
+        cJSON_AddStringToObject(jsonObject, COMM_MSG_CAPS_DIGEST_KEY, commMsg.capsDigest.c_str());
+    }
 }
 
 void FromJson(const cJSON *jsonObject, CommMsg &commMsg)
@@ -93,6 +205,10 @@ void FromJson(const cJSON *jsonObject, CommMsg &commMsg)
     if (IsString(jsonObject, keyMsg)) {
         commMsg.msg = cJSON_GetObjectItem(jsonObject, COMM_MSG_MSG_KEY)->valuestring;
     }
+    std::string keyCapsDigest(COMM_MSG_CAPS_DIGEST_KEY);
+    if (IsString(jsonObject, keyCapsDigest)) {
+        commMsg.capsDigest = cJSON_GetObjectItem(jsonObject, COMM_MSG_CAPS_DIGEST_KEY)->valuestring;
+    }
 }
 
 std::string GetCommMsgString(const CommMsg &commMsg)
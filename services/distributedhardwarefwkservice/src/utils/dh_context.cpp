@@ -118,14 +118,44 @@ const DeviceInfo& DHContext::GetDeviceInfo()
     return devInfo_;
 }
 
+std::shared_ptr<const DeviceIdTable> DHContext::GetDeviceIdTable() const
+{
+    return std::atomic_load(&devIdTable_);
+}
+
+void DHContext::UpdateDeviceIdTable(std::set<DeviceIdEntry> &&entries)
+{
+    auto table = std::make_shared<DeviceIdTable>();
+    table->entries = std::move(entries);
+    for (const auto &entry : table->entries) {
+        table->networkIdIndex.emplace(entry.networkId, &entry);
+        table->uuidIndex.emplace(entry.uuid, &entry);
+        table->udidIndex.emplace(entry.udid, &entry);
+        table->udidHashIndex.emplace(entry.udidHash, &entry);
+        table->deviceIdIndex.emplace(entry.deviceId, &entry);
+    }
+    std::atomic_store(&devIdTable_, std::shared_ptr<const DeviceIdTable>(table));
+}
+
+const DeviceIdEntry *DHContext::FindDeviceIdEntry(
+    const std::unordered_map<std::string, const DeviceIdEntry *> &index, const std::string &key)
+{
+    auto iter = index.find(key);
+    if (iter == index.end()) {
+        return nullptr;
+    }
+    return iter->second;
+}
+
 void DHContext::AddOnlineDevice(const std::string &udid, const std::string &uuid, const std::string &networkId)
 {
     if (!IsIdLengthValid(udid) || !IsIdLengthValid(uuid) || !IsIdLengthValid(networkId)) {
         return;
     }
-    std::unique_lock<std::shared_mutex> lock(onlineDevMutex_);
-    if (devIdEntrySet_.size() > MAX_ONLINE_DEVICE_SIZE) {
-        DHLOGE("devIdEntrySet_ is over size!");
+    std::lock_guard<std::mutex> lock(onlineDevMutex_);
+    auto table = GetDeviceIdTable();
+    if (table->entries.size() > MAX_ONLINE_DEVICE_SIZE) {
+        DHLOGE("devIdEntrySet is over size!");
         return;
     }
     std::string deviceId = Sha256(uuid);
@@ -137,7 +167,47 @@ void DHContext::AddOnlineDevice(const std::string &udid, const std::string &uuid
         .udid = udid,
         .udidHash = udidHash
     };
-    devIdEntrySet_.insert(idEntry);
+    if (table->entries.count(idEntry) != 0) {
+        return;
+    }
+    std::set<DeviceIdEntry> entries = table->entries;
+    entries.insert(idEntry);
+    UpdateDeviceIdTable(std::move(entries));
+}
+
+size_t DHContext::AddOnlineDevices(const std::vector<DeviceIdEntry> &idEntries)
+{
+    std::lock_guard<std::mutex> lock(onlineDevMutex_);
+    auto table = GetDeviceIdTable();
+    std::set<DeviceIdEntry> entries = table->entries;
+    std::vector<std::string> addedNetworkIds;
+    for (const auto &item : idEntries) {
+        if (!IsIdLengthValid(item.udid) || !IsIdLengthValid(item.uuid) || !IsIdLengthValid(item.networkId)) {
+            continue;
+        }
+        if (entries.size() > MAX_ONLINE_DEVICE_SIZE) {
+            DHLOGE("devIdEntrySet is over size!");
+            break;
+        }
+        DeviceIdEntry idEntry = {
+            .networkId = item.networkId,
+            .uuid = item.uuid,
+            .deviceId = Sha256(item.uuid),
+            .udid = item.udid,
+            .udidHash = Sha256(item.udid)
+        };
+        if (entries.insert(idEntry).second) {
+            addedNetworkIds.push_back(item.networkId);
+        }
+    }
+    if (addedNetworkIds.empty()) {
+        return 0;
+    }
+    // seed the real time online set in the same step, an offline in between must not see the device half online
+    std::unique_lock<std::shared_mutex> realTimeLock(realTimeNetworkIdMutex_);
+    UpdateDeviceIdTable(std::move(entries));
+    realTimeOnLineNetworkIdSet_.insert(addedNetworkIds.begin(), addedNetworkIds.end());
+    return addedNetworkIds.size();
 }
 
 void DHContext::RemoveOnlineDeviceIdEntryByNetworkId(const std::string &networkId)
@@ -145,13 +215,15 @@ void DHContext::RemoveOnlineDeviceIdEntryByNetworkId(const std::string &networkI
     if (!IsIdLengthValid(networkId)) {
         return;
     }
-    std::unique_lock<std::shared_mutex> lock(onlineDevMutex_);
-    for (auto iter = devIdEntrySet_.begin(); iter != devIdEntrySet_.end(); iter++) {
-        if (iter->networkId == networkId) {
-            devIdEntrySet_.erase(iter);
-            break;
-        }
+    std::lock_guard<std::mutex> lock(onlineDevMutex_);
+    auto table = GetDeviceIdTable();
+    const DeviceIdEntry *entry = FindDeviceIdEntry(table->networkIdIndex, networkId);
+    if (entry == nullptr) {
+        return;
     }
+    std::set<DeviceIdEntry> entries = table->entries;
+    entries.erase(*entry);
+    UpdateDeviceIdTable(std::move(entries));
 }
 
 bool DHContext::IsDeviceOnline(const std::string &uuid)
@@ -159,21 +231,13 @@ bool DHContext::IsDeviceOnline(const std::string &uuid)
     if (!IsIdLengthValid(uuid)) {
         return false;
     }
-    std::shared_lock<std::shared_mutex> lock(onlineDevMutex_);
-    bool flag = false;
-    for (auto iter = devIdEntrySet_.begin(); iter != devIdEntrySet_.end(); iter++) {
-        if (iter->uuid == uuid) {
-            flag = true;
-            break;
-        }
-    }
-    return flag;
+    auto table = GetDeviceIdTable();
+    return FindDeviceIdEntry(table->uuidIndex, uuid) != nullptr;
 }
 
 size_t DHContext::GetOnlineCount()
 {
-    std::shared_lock<std::shared_mutex> lock(onlineDevMutex_);
-    return devIdEntrySet_.size();
+    return GetDeviceIdTable()->entries.size();
 }
 
 std::string DHContext::GetNetworkIdByUUID(const std::string &uuid)
@@ -181,15 +245,9 @@ std::string DHContext::GetNetworkIdByUUID(const std::string &uuid)
     if (!IsIdLengthValid(uuid)) {
         return "";
     }
-    std::unique_lock<std::shared_mutex> lock(onlineDevMutex_);
-    std::string networkId = "";
-    for (auto iter = devIdEntrySet_.begin(); iter != devIdEntrySet_.end(); iter++) {
-        if (iter->uuid == uuid) {
-            networkId = iter->networkId;
-            break;
-        }
-    }
-    return networkId;
+    auto table = GetDeviceIdTable();
+    const DeviceIdEntry *entry = FindDeviceIdEntry(table->uuidIndex, uuid);
+    return (entry == nullptr) ? "" : entry->networkId;
 }
 
 std::string DHContext::GetNetworkIdByUDID(const std::string &udid)
@@ -197,15 +255,9 @@ std::string DHContext::GetNetworkIdByUDID(const std::string &udid)
     if (!IsIdLengthValid(udid)) {
         return "";
     }
-    std::unique_lock<std::shared_mutex> lock(onlineDevMutex_);
-    std::string networkId = "";
-    for (auto iter = devIdEntrySet_.begin(); iter != devIdEntrySet_.end(); iter++) {
-        if (iter->udid == udid) {
-            networkId = iter->networkId;
-            break;
-        }
-    }
-    return networkId;
+    auto table = GetDeviceIdTable();
+    const DeviceIdEntry *entry = FindDeviceIdEntry(table->udidIndex, udid);
+    return (entry == nullptr) ? "" : entry->networkId;
 }
 
 std::string DHContext::GetUdidHashIdByUUID(const std::string &uuid)
@@ -213,15 +265,9 @@ std::string DHContext::GetUdidHashIdByUUID(const std::string &uuid)
     if (!IsIdLengthValid(uuid)) {
         return "";
     }
-    std::unique_lock<std::shared_mutex> lock(onlineDevMutex_);
-    std::string udidHash = "";
-    for (auto iter = devIdEntrySet_.begin(); iter != devIdEntrySet_.end(); iter++) {
-        if (iter->uuid == uuid) {
-            udidHash = iter->udidHash;
-            break;
-        }
-    }
-    return udidHash;
+    auto table = GetDeviceIdTable();
+    const DeviceIdEntry *entry = FindDeviceIdEntry(table->uuidIndex, uuid);
+    return (entry == nullptr) ? "" : entry->udidHash;
 }
 
 std::string DHContext::GetUUIDByNetworkId(const std::string &networkId)
@@ -229,15 +275,9 @@ std::string DHContext::GetUUIDByNetworkId(const std::string &networkId)
     if (!IsIdLengthValid(networkId)) {
         return "";
     }
-    std::unique_lock<std::shared_mutex> lock(onlineDevMutex_);
-    std::string uuid = "";
-    for (auto iter = devIdEntrySet_.begin(); iter != devIdEntrySet_.end(); iter++) {
-        if (iter->networkId == networkId) {
-            uuid = iter->uuid;
-            break;
-        }
-    }
-    return uuid;
+    auto table = GetDeviceIdTable();
+    const DeviceIdEntry *entry = FindDeviceIdEntry(table->networkIdIndex, networkId);
+    return (entry == nullptr) ? "" : entry->uuid;
 }
 
 std::string DHContext::GetUDIDByNetworkId(const std::string &networkId)
@@ -245,15 +285,9 @@ std::string DHContext::GetUDIDByNetworkId(const std::string &networkId)
     if (!IsIdLengthValid(networkId)) {
         return "";
     }
-    std::unique_lock<std::shared_mutex> lock(onlineDevMutex_);
-    std::string udid = "";
-    for (auto iter = devIdEntrySet_.begin(); iter != devIdEntrySet_.end(); iter++) {
-        if (iter->networkId == networkId) {
-            udid = iter->udid;
-            break;
-        }
-    }
-    return udid;
+    auto table = GetDeviceIdTable();
+    const DeviceIdEntry *entry = FindDeviceIdEntry(table->networkIdIndex, networkId);
+    return (entry == nullptr) ? "" : entry->udid;
 }
 
 std::string DHContext::GetUUIDByDeviceId(const std::string &deviceId)
@@ -261,15 +295,12 @@ std::string DHContext::GetUUIDByDeviceId(const std::string &deviceId)
     if (!IsIdLengthValid(deviceId)) {
         return "";
     }
-    std::unique_lock<std::shared_mutex> lock(onlineDevMutex_);
-    std::string uuid = "";
-    for (auto iter = devIdEntrySet_.begin(); iter != devIdEntrySet_.end(); iter++) {
-        if (iter->deviceId == deviceId || iter->udidHash == deviceId) {
-            uuid = iter->uuid;
-            break;
-        }
+    auto table = GetDeviceIdTable();
+    const DeviceIdEntry *entry = FindDeviceIdEntry(table->deviceIdIndex, deviceId);
+    if (entry == nullptr) {
+        entry = FindDeviceIdEntry(table->udidHashIndex, deviceId);
     }
-    return uuid;
+    return (entry == nullptr) ? "" : entry->uuid;
 }
 
 std::string DHContext::GetNetworkIdByDeviceId(const std::string &deviceId)
@@ -277,30 +308,24 @@ std::string DHContext::GetNetworkIdByDeviceId(const std::string &deviceId)
     if (!IsIdLengthValid(deviceId)) {
         return "";
     }
-    std::unique_lock<std::shared_mutex> lock(onlineDevMutex_);
-    std::string networkId = "";
-    for (auto iter = devIdEntrySet_.begin(); iter != devIdEntrySet_.end(); iter++) {
-        if (iter->deviceId == deviceId) {
-            networkId = iter->networkId;
-            break;
-        }
-    }
-    return networkId;
+    auto table = GetDeviceIdTable();
+    const DeviceIdEntry *entry = FindDeviceIdEntry(table->deviceIdIndex, deviceId);
+    return (entry == nullptr) ? "" : entry->networkId;
 }
 
 void DHContext::GetOnlineDeviceUdidHash(std::vector<std::string> &udidHashVec)
 {
-    std::unique_lock<std::shared_mutex> lock(onlineDevMutex_);
-    for (auto iter = devIdEntrySet_.begin(); iter != devIdEntrySet_.end(); iter++) {
-        udidHashVec.push_back(iter->udidHash);
+    auto table = GetDeviceIdTable();
+    for (const auto &entry : table->entries) {
+        udidHashVec.push_back(entry.udidHash);
     }
 }
 
 void DHContext::GetOnlineDeviceDeviceId(std::vector<std::string> &deviceIdVec)
 {
-    std::unique_lock<std::shared_mutex> lock(onlineDevMutex_);
-    for (auto iter = devIdEntrySet_.begin(); iter != devIdEntrySet_.end(); iter++) {
-        deviceIdVec.push_back(iter->deviceId);
+    auto table = GetDeviceIdTable();
+    for (const auto &entry : table->entries) {
+        deviceIdVec.push_back(entry.deviceId);
     }
 }
 
@@ -326,14 +351,14 @@ std::string DHContext::GetDeviceIdByDBGetPrefix(const std::string &prefix)
 void DHContext::AddRealTimeOnlineDeviceNetworkId(const std::string &networkId)
 {
     DHLOGI("AddRealTimeOnlineDeviceNetworkId: %{public}s", GetAnonyString(networkId).c_str());
-    std::shared_lock<std::shared_mutex> lock(realTimeNetworkIdMutex_);
+    std::unique_lock<std::shared_mutex> lock(realTimeNetworkIdMutex_);
     realTimeOnLineNetworkIdSet_.insert(networkId);
 }
 
 void DHContext::DeleteRealTimeOnlineDeviceNetworkId(const std::string &networkId)
 {
     DHLOGI("DeleteRealTimeOnlineDeviceNetworkId: %{public}s", GetAnonyString(networkId).c_str());
-    std::shared_lock<std::shared_mutex> lock(realTimeNetworkIdMutex_);
+    std::unique_lock<std::shared_mutex> lock(realTimeNetworkIdMutex_);
     realTimeOnLineNetworkIdSet_.erase(networkId);
 }
 
@@ -68,7 +68,7 @@ HWTEST_F(AccessManagerTest, SendOnLineEvent_001, TestSize.Level1)
         TEST_DEV_TYPE_PAD);
     EXPECT_EQ(ERR_DH_FWK_HARDWARE_MANAGER_DEVICE_REPEAT_ONLINE, ret);
 
-    DHContext::GetInstance().devIdEntrySet_.clear();
+    DHContext::GetInstance().UpdateDeviceIdTable({});
     ret = DistributedHardwareManagerFactory::GetInstance().SendOnLineEvent(TEST_NETWORKID, TEST_UUID, TEST_UDID,
         TEST_DEV_TYPE_PAD);
     EXPECT_EQ(DH_FWK_SUCCESS, ret);
@@ -82,7 +82,7 @@ HWTEST_F(AccessManagerTest, SendOnLineEvent_001, TestSize.Level1)
  */
 HWTEST_F(AccessManagerTest, SendOffLineEvent_001, TestSize.Level1)
 {
-    DHContext::GetInstance().devIdEntrySet_.clear();
+    DHContext::GetInstance().UpdateDeviceIdTable({});
     auto ret = DistributedHardwareManagerFactory::GetInstance().SendOffLineEvent("", TEST_UUID, TEST_UDID,
         TEST_DEV_TYPE_PAD);
     EXPECT_EQ(ERR_DH_FWK_PARA_INVALID, ret);
@@ -97,7 +97,7 @@ HWTEST_F(AccessManagerTest, SendOffLineEvent_001, TestSize.Level1)
     ret = DistributedHardwareManagerFactory::GetInstance().SendOffLineEvent(TEST_NETWORKID, TEST_UUID, TEST_UDID,
         TEST_DEV_TYPE_PAD);
     EXPECT_EQ(DH_FWK_SUCCESS, ret);
-    DHContext::GetInstance().devIdEntrySet_.clear();
+    DHContext::GetInstance().UpdateDeviceIdTable({});
 }
 
 /**
@@ -202,6 +202,30 @@ HWTEST_F(AccessManagerTest, OnDeviceOffline_003, TestSize.Level0)
     EXPECT_EQ(DH_FWK_SUCCESS, AccessManager::GetInstance()->Init());
 }
 
+/**
+ * @tc.name: OnDeviceOffline_004
+ * @tc.desc: Verify an offline drops a seeded device whose online task has not run yet
+ * @tc.type: FUNC
+ * @tc.require: AR000GHSJM
+ */
+HWTEST_F(AccessManagerTest, OnDeviceOffline_004, TestSize.Level0)
+{
+    std::vector<DeviceIdEntry> idEntries;
+    idEntries.push_back(DeviceIdEntry { .networkId = TEST_NETWORKID, .uuid = TEST_UUID, .udid = TEST_UDID });
+    size_t realTimeCount = DHContext::GetInstance().GetRealTimeOnlineDeviceCount();
+    ASSERT_EQ(1U, DHContext::GetInstance().AddOnlineDevices(idEntries));
+    AccessManager::GetInstance()->pendingSeededUuids_.insert(TEST_UUID);
+
+    DmDeviceInfo deviceInfo;
+    int32_t ret = memcpy_s(deviceInfo.networkId, DM_MAX_DEVICE_ID_LEN, TEST_NETWORKID.c_str(),
+        TEST_NETWORKID.length());
+    ASSERT_EQ(EOK, ret);
+    AccessManager::GetInstance()->OnDeviceOffline(deviceInfo);
+    EXPECT_FALSE(DHContext::GetInstance().IsDeviceOnline(TEST_UUID));
+    EXPECT_EQ(realTimeCount, DHContext::GetInstance().GetRealTimeOnlineDeviceCount());
+    EXPECT_FALSE(AccessManager::GetInstance()->TakePendingSeededDevice(TEST_UUID));
+}
+
 /**
  * @tc.name: OnDeviceReady_001
  * @tc.desc: Verify the OnDeviceReady function
@@ -183,6 +183,35 @@ HWTEST_F(ComponentLoaderTest, GetSink_002, TestSize.Level0)
     ComponentLoader::GetInstance().UnInit();
 }
 
+/**
+ * @tc.name: LazyLoad_001
+ * @tc.desc: Verify the source and sink are loaded on demand in lazy load mode.
+ * @tc.type: FUNC
+ * @tc.require: AR000GHSK3
+ */
+HWTEST_F(ComponentLoaderTest, LazyLoad_001, TestSize.Level0)
+{
+    ComponentLoader::GetInstance().isLazyLoad_.store(true);
+    CompHandler comHandler;
+    comHandler.sourceHandler = nullptr;
+    comHandler.sourceLoc = "libdistributed_hardware_not_exist_source.z.so";
+    comHandler.sinkHandler = nullptr;
+    comHandler.sinkLoc = "libdistributed_hardware_not_exist_sink.z.so";
+    ComponentLoader::GetInstance().compHandlerMap_[DHType::AUDIO] = comHandler;
+    EXPECT_EQ(DH_FWK_SUCCESS, ComponentLoader::GetInstance().ReleaseSource(DHType::AUDIO));
+    EXPECT_EQ(DH_FWK_SUCCESS, ComponentLoader::GetInstance().ReleaseSink(DHType::AUDIO));
+
+    IDistributedHardwareSource *sourcePtr = nullptr;
+    auto ret = ComponentLoader::GetInstance().GetSource(DHType::AUDIO, sourcePtr);
+    EXPECT_EQ(ERR_DH_FWK_LOADER_HANDLER_IS_NULL, ret);
+    IDistributedHardwareSink *sinkPtr = nullptr;
+    ret = ComponentLoader::GetInstance().GetSink(DHType::AUDIO, sinkPtr);
+    EXPECT_EQ(ERR_DH_FWK_LOADER_HANDLER_IS_NULL, ret);
+    EXPECT_TRUE(ComponentLoader::GetInstance().GetSoLoadCosts().empty());
+    ComponentLoader::GetInstance().compHandlerMap_.clear();
+    ComponentLoader::GetInstance().isLazyLoad_.store(false);
+}
+
 /**
  * @tc.name: Readfile_001
  * @tc.desc: Verify the Readfile function.
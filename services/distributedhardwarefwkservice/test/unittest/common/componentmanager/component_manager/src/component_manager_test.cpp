@@ -403,6 +403,39 @@ HWTEST_F(ComponentManagerTest, WaitForResult_001, TestSize.Level0)
     EXPECT_EQ(true, ret);
 }
 
+/**
+ * @tc.name: WaitForResult_002
+ * @tc.desc: Verify the WaitForResult function with submitted and timed out actions
+ * @tc.type: FUNC
+ * @tc.require: AR000GHSJM
+ */
+HWTEST_F(ComponentManagerTest, WaitForResult_002, TestSize.Level0)
+{
+    ComponentManager::Action action = ComponentManager::Action::STOP_SOURCE;
+    ActionResult actionsResult;
+    actionsResult.emplace(DHType::AUDIO, ComponentManager::GetInstance().SubmitAction(action, DHType::AUDIO,
+        []() { return DH_FWK_SUCCESS; }));
+    EXPECT_EQ(true, ComponentManager::GetInstance().WaitForResult(action, actionsResult));
+
+    actionsResult.emplace(DHType::CAMERA, ComponentManager::GetInstance().SubmitAction(action, DHType::CAMERA,
+        []() { return ERR_DH_FWK_PARA_INVALID; }));
+    EXPECT_EQ(false, ComponentManager::GetInstance().WaitForResult(action, actionsResult));
+
+    std::promise<int32_t> promise;
+    ActionTask pendingTask { promise.get_future().share(), std::make_shared<std::atomic<bool>>(false) };
+    ActionResult pendingResult;
+    pendingResult.emplace(DHType::SCREEN, pendingTask);
+    ComponentManager::GetInstance().isUnInitTimeOut_ = false;
+    ComponentManager::GetInstance().WaitForResult(action, pendingResult);
+    EXPECT_EQ(false, pendingTask.isCancelled->load());
+    EXPECT_EQ(true, ComponentManager::GetInstance().isUnInitTimeOut_);
+    ComponentManager::GetInstance().isUnInitTimeOut_ = false;
+
+    ComponentManager::GetInstance().WaitForResult(ComponentManager::Action::START_SOURCE, pendingResult);
+    EXPECT_EQ(true, pendingTask.isCancelled->load());
+    EXPECT_EQ(false, ComponentManager::GetInstance().isUnInitTimeOut_);
+}
+
 /**
  * @tc.name: InitCompSource_001
  * @tc.desc: Verify the InitCompSource function
@@ -743,7 +776,7 @@ HWTEST_F(ComponentManagerTest, RetryGetEnableParam_001, TestSize.Level0)
 {
     DHType dhType = DHType::CAMERA;
     EnableParam param;
-    DHContext::GetInstance().devIdEntrySet_.clear();
+    DHContext::GetInstance().UpdateDeviceIdTable({});
     auto ret = ComponentManager::GetInstance().RetryGetEnableParam(NETWORK_TEST, UUID_TEST, DH_ID_1, dhType, param);
     EXPECT_EQ(ret, ERR_DH_FWK_COMPONENT_ENABLE_FAILED);
 }
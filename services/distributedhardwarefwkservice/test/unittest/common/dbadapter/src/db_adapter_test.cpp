@@ -497,5 +497,37 @@ HWTEST_F(DbAdapterTest, PutData_05, TestSize.Level0)
     g_dbAdapterPtr->kvStoragePtr_ = nullptr;
     EXPECT_EQ(ERR_DH_FWK_RESOURCE_KV_STORAGE_POINTER_NULL, g_dbAdapterPtr->PutData(key, value));
 }
+
+/**
+ * @tc.name: PutDataDeferred_001
+ * @tc.desc: Verify the PutDataDeferred and FlushDirtyData function.
+ * @tc.type: FUNC
+ * @tc.require: AR000GHSCV
+ */
+HWTEST_F(DbAdapterTest, PutDataDeferred_001, TestSize.Level0)
+{
+    if (g_dbAdapterPtr == nullptr) {
+        return;
+    }
+    std::string key = "key";
+    std::string value = "value";
+    g_dbAdapterPtr->kvStoragePtr_ = nullptr;
+    EXPECT_EQ(ERR_DH_FWK_PARA_INVALID, g_dbAdapterPtr->PutDataDeferred("", value));
+    EXPECT_EQ(DH_FWK_SUCCESS, g_dbAdapterPtr->PutDataDeferred(key, value));
+    EXPECT_EQ(DH_FWK_SUCCESS, g_dbAdapterPtr->PutDataDeferred(key, value));
+    EXPECT_EQ(1U, g_dbAdapterPtr->dirtyEntries_.size());
+
+    std::string data;
+    EXPECT_EQ(DH_FWK_SUCCESS, g_dbAdapterPtr->GetDataByKey(key, data));
+    EXPECT_EQ(value, data);
+
+    EXPECT_EQ(ERR_DH_FWK_RESOURCE_KV_STORAGE_POINTER_NULL, g_dbAdapterPtr->FlushDirtyData());
+    EXPECT_EQ(1U, g_dbAdapterPtr->dirtyEntries_.size());
+    EXPECT_TRUE(g_dbAdapterPtr->valueDigests_.empty());
+
+    g_dbAdapterPtr->RemoveDataByKey(key);
+    EXPECT_TRUE(g_dbAdapterPtr->dirtyEntries_.empty());
+    EXPECT_EQ(DH_FWK_SUCCESS, g_dbAdapterPtr->FlushDirtyData());
+}
 } // namespace DistributedHardware
 } // namespace OHOS
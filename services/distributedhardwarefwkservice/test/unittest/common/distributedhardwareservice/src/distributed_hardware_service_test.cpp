@@ -19,6 +19,7 @@
 #include <thread>
 #include <vector>
 
+#include "capability_info_manager.h"
 #include "constants.h"
 #include "cJSON.h"
 #include "dh_context.h"
@@ -196,6 +197,45 @@ HWTEST_F(DistributedHardwareServiceTest, QueryLocalSysSpec_001, TestSize.Level0)
     EXPECT_EQ(ret.empty(), true);
 }
 
+/**
+ * @tc.name: QueryLocalSysSpec_002
+ * @tc.desc: Verify the QueryLocalSysSpec answer is cached and refreshed when local capabilities change
+ * @tc.type: FUNC
+ * @tc.require: AR000GHSJM
+ */
+HWTEST_F(DistributedHardwareServiceTest, QueryLocalSysSpec_002, TestSize.Level0)
+{
+    DistributedHardwareService service(ASID, true);
+    std::string localDevId = "sys_spec_test_device_id";
+    DHContext::GetInstance().devInfo_.deviceId = localDevId;
+    auto capMgr = CapabilityInfoManager::GetInstance();
+    std::string attrs = "{\"" + KEY_HISTREAMER_AUDIO_ENCODER + "\":\"aac\"}";
+    auto capInfo = std::make_shared<CapabilityInfo>("dhId_audio", localDevId, "devName", 0, DHType::AUDIO, attrs, "");
+    {
+        std::lock_guard<std::mutex> lock(capMgr->capInfoMgrMutex_);
+        capMgr->PutCapabilityInMem(capInfo);
+    }
+    EXPECT_EQ("aac", service.QueryLocalSysSpec(QueryLocalSysSpecType::HISTREAMER_AUDIO_ENCODER));
+    uint64_t capVersion = capMgr->GetDeviceCapabilityVersion(localDevId);
+    EXPECT_EQ(capVersion, service.sysSpecCache_[
+        static_cast<uint32_t>(QueryLocalSysSpecType::HISTREAMER_AUDIO_ENCODER)].capVersion);
+
+    attrs = "{\"" + KEY_HISTREAMER_AUDIO_ENCODER + "\":\"opus\"}";
+    capInfo = std::make_shared<CapabilityInfo>("dhId_audio", localDevId, "devName", 0, DHType::AUDIO, attrs, "");
+    {
+        std::lock_guard<std::mutex> lock(capMgr->capInfoMgrMutex_);
+        capMgr->PutCapabilityInMem(capInfo);
+    }
+    EXPECT_EQ("opus", service.QueryLocalSysSpec(QueryLocalSysSpecType::HISTREAMER_AUDIO_ENCODER));
+
+    {
+        std::lock_guard<std::mutex> lock(capMgr->capInfoMgrMutex_);
+        capMgr->EraseDeviceCapabilitiesInMem(localDevId);
+    }
+    EXPECT_TRUE(service.QueryLocalSysSpec(QueryLocalSysSpecType::HISTREAMER_AUDIO_ENCODER).empty());
+    DHContext::GetInstance().devInfo_.deviceId = "";
+}
+
 /**
  * @tc.name: PauseDistributedHardware_001
  * @tc.desc: Verify the PauseDistributedHardware function
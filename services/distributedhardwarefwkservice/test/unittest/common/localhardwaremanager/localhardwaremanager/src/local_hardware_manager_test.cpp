@@ -44,31 +44,53 @@ HWTEST_F(LocalHardwareManagerTest, Init_001, TestSize.Level0)
 }
 
 /**
- * @tc.name: CheckNonExistCapabilityInfo_001
- * @tc.desc: Verify the CheckNonExistCapabilityInfo function.
+ * @tc.name: ReconcileCapabilityInfo_001
+ * @tc.desc: Verify the ReconcileCapabilityInfo function.
  * @tc.type: FUNC
  * @tc.require: AR000GHSK3
  */
-HWTEST_F(LocalHardwareManagerTest, CheckNonExistCapabilityInfo_001, TestSize.Level0)
+HWTEST_F(LocalHardwareManagerTest, ReconcileCapabilityInfo_001, TestSize.Level0)
 {
     std::vector<DHItem> dhItems;
     DHType dhType =  DHType::INPUT;
-    LocalHardwareManager::GetInstance().CheckNonExistCapabilityInfo(dhItems, dhType);
+    LocalHardwareManager::GetInstance().ReconcileCapabilityInfo(dhItems, dhType);
     EXPECT_EQ(true, LocalHardwareManager::GetInstance().pluginListenerMap_.empty());
 }
 
 /**
- * @tc.name: CheckNonExistCapabilityInfo_002
- * @tc.desc: Verify the CheckNonExistCapabilityInfo function.
+ * @tc.name: DiffCapabilityInfo_001
+ * @tc.desc: Verify the DiffCapabilityInfo function.
  * @tc.type: FUNC
  * @tc.require: AR000GHSK3
  */
-HWTEST_F(LocalHardwareManagerTest, CheckNonExistCapabilityInfo_002, TestSize.Level0)
+HWTEST_F(LocalHardwareManagerTest, DiffCapabilityInfo_001, TestSize.Level0)
 {
-    std::vector<DHItem> dhItems;
-    DHType dhType =  DHType::AUDIO;
-    LocalHardwareManager::GetInstance().CheckNonExistCapabilityInfo(dhItems, dhType);
-    EXPECT_EQ(true, LocalHardwareManager::GetInstance().pluginListenerMap_.empty());
+    std::string deviceId = "deviceId";
+    auto unchangedCap = std::make_shared<CapabilityInfo>("dhId_1", deviceId, "devName", 0, DHType::AUDIO,
+        "attrs", "mic");
+    auto changedCap = std::make_shared<CapabilityInfo>("dhId_2", deviceId, "devName", 0, DHType::AUDIO,
+        "attrs", "mic");
+    auto removedCap = std::make_shared<CapabilityInfo>("dhId_3", deviceId, "devName", 0, DHType::AUDIO,
+        "attrs", "mic");
+    auto addedCap = std::make_shared<CapabilityInfo>("dhId_4", deviceId, "devName", 0, DHType::AUDIO,
+        "attrs", "mic");
+    CapabilityInfoMap storedCapInfos;
+    storedCapInfos[unchangedCap->GetKey()] = unchangedCap;
+    storedCapInfos[changedCap->GetKey()] = std::make_shared<CapabilityInfo>("dhId_2", deviceId, "devName", 0,
+        DHType::AUDIO, "old_attrs", "mic");
+    storedCapInfos[removedCap->GetKey()] = removedCap;
+
+    std::vector<std::shared_ptr<CapabilityInfo>> capabilityInfos = { unchangedCap, changedCap, addedCap };
+    CapabilityInfoDiff diff;
+    LocalHardwareManager::GetInstance().DiffCapabilityInfo(capabilityInfos, storedCapInfos, diff);
+    ASSERT_EQ(1U, diff.added.size());
+    EXPECT_EQ(addedCap->GetKey(), diff.added[0]->GetKey());
+    ASSERT_EQ(1U, diff.changed.size());
+    EXPECT_EQ(changedCap->GetKey(), diff.changed[0]->GetKey());
+    ASSERT_EQ(1U, diff.unchanged.size());
+    EXPECT_EQ(unchangedCap->GetKey(), diff.unchanged[0]->GetKey());
+    ASSERT_EQ(1U, diff.removedKeys.size());
+    EXPECT_EQ(removedCap->GetKey(), diff.removedKeys[0]);
 }
 
 /**
@@ -100,5 +122,40 @@ HWTEST_F(LocalHardwareManagerTest, GetLocalCapabilityMapByPrefix_002, TestSize.L
     EXPECT_EQ(true, LocalHardwareManager::GetInstance().pluginListenerMap_.empty());
 }
 
+/**
+ * @tc.name: QueryLocalHardware_001
+ * @tc.desc: Verify the QueryLocalHardware and PublishLocalHardware function.
+ * @tc.type: FUNC
+ * @tc.require: AR000GHSK3
+ */
+HWTEST_F(LocalHardwareManagerTest, QueryLocalHardware_001, TestSize.Level0)
+{
+    DHType dhType = DHType::AUDIO;
+    LocalHardwareManager::GetInstance().localDHItemsMap_.clear();
+    LocalHardwareManager::GetInstance().PublishLocalHardware(dhType);
+    LocalHardwareManager::GetInstance().QueryLocalHardware(dhType, nullptr, 1);
+    EXPECT_EQ(true, LocalHardwareManager::GetInstance().localDHItemsMap_.empty());
+
+    MockHardwareHandler hardwareHandler;
+    LocalHardwareManager::GetInstance().QueryLocalHardware(dhType, &hardwareHandler, 1);
+    EXPECT_EQ(1U, LocalHardwareManager::GetInstance().localDHItemsMap_[dhType].size());
+    LocalHardwareManager::GetInstance().localDHItemsMap_.clear();
+}
+
+/**
+ * @tc.name: UnInit_002
+ * @tc.desc: Verify UnInit stops the discovery tasks started before it
+ * @tc.type: FUNC
+ * @tc.require: AR000GHSK3
+ */
+HWTEST_F(LocalHardwareManagerTest, UnInit_002, TestSize.Level0)
+{
+    uint64_t generation = LocalHardwareManager::GetInstance().discoveryGeneration_.load();
+    EXPECT_FALSE(LocalHardwareManager::GetInstance().IsDiscoveryStopped(generation));
+    LocalHardwareManager::GetInstance().UnInit();
+    EXPECT_TRUE(LocalHardwareManager::GetInstance().IsDiscoveryStopped(generation));
+    EXPECT_EQ(0U, LocalHardwareManager::GetInstance().runningDiscoveryCount_);
+}
+
 } // namespace DistributedHardware
 } // namespace OHOS
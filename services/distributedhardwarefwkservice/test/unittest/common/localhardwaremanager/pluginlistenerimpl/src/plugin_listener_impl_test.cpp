@@ -151,5 +151,34 @@ HWTEST_F(PluginListenerImplTest, UnPluginHardware_002, TestSize.Level0)
     listener->UnPluginHardware(dhId3);
     EXPECT_EQ(true, dhId1.empty());
 }
+
+/**
+ * @tc.name: FlushPendingEvents_001
+ * @tc.desc: Verify the plug events of one dhId are coalesced and flushed in one batch.
+ * @tc.type: FUNC
+ * @tc.require: AR000GHSK3
+ */
+HWTEST_F(PluginListenerImplTest, FlushPendingEvents_001, TestSize.Level0)
+{
+    DHType type = DHType::INPUT;
+    std::shared_ptr<PluginListenerImpl> listener = std::make_shared<PluginListenerImpl>(type);
+    listener->coalesceWindowMs_ = 1000;
+    listener->PluginHardware("dhId_1", attrs, subtype);
+    listener->PluginHardware("dhId_2", attrs, subtype);
+    listener->UnPluginHardware("dhId_1");
+    {
+        std::lock_guard<std::mutex> lock(listener->eventMutex_);
+        ASSERT_EQ(2U, listener->pendingEvents_.size());
+        EXPECT_EQ(false, listener->pendingEvents_["dhId_1"].isPlugin);
+        EXPECT_EQ(true, listener->pendingEvents_["dhId_2"].isPlugin);
+    }
+
+    listener->FlushPendingEvents();
+    PluginBatchStats stats = listener->GetBatchStats();
+    EXPECT_EQ(true, listener->pendingEvents_.empty());
+    EXPECT_EQ(1U, stats.batchCount);
+    EXPECT_EQ(2U, stats.eventCount);
+    EXPECT_EQ(2U, stats.maxBatchSize);
+}
 } // namespace DistributedHardware
 } // namespace OHOS
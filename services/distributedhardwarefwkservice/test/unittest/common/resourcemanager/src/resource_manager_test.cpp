@@ -63,6 +63,7 @@ constexpr uint32_t TEST_DH_TYPE_GPS = 0x10;
 constexpr uint32_t TEST_DH_TYPE_DISPLAY = 0x08;
 constexpr uint32_t TEST_DH_TYPE_BUTTON = 0x20;
 constexpr uint32_t TEST_SIZE_0 = 0;
+constexpr uint32_t TEST_SIZE_1 = 1;
 constexpr uint32_t TEST_SIZE_2 = 2;
 constexpr uint32_t TEST_SIZE_5 = 5;
 constexpr uint32_t TEST_SIZE_10 = 10;
@@ -1232,5 +1233,42 @@ HWTEST_F(ResourceManagerTest, ClearDataWhenPeerLogout_001, TestSize.Level0)
     ret = MetaInfoManager::GetInstance()->ClearDataWhenPeerLogout(peerudid, peeruuid);
     EXPECT_EQ(ERR_DH_FWK_RESOURCE_DB_ADAPTER_POINTER_NULL, ret);
 }
+
+/**
+ * @tc.name: CapabilityIndex_001
+ * @tc.desc: Verify the deviceId and dhType indexes follow add and remove of capabilities.
+ * @tc.type: FUNC
+ * @tc.require: AR000GHSJE
+ */
+HWTEST_F(ResourceManagerTest, CapabilityIndex_001, TestSize.Level0)
+{
+    auto capInfoMgr = CapabilityInfoManager::GetInstance();
+    capInfoMgr->globalCapInfoMap_.clear();
+    capInfoMgr->deviceIdIndex_.clear();
+    capInfoMgr->dhTypeIndex_.clear();
+    vector<shared_ptr<CapabilityInfo>> resInfos { CAP_INFO_0, CAP_INFO_1, CAP_INFO_2, CAP_INFO_3, CAP_INFO_4,
+        CAP_INFO_5, CAP_INFO_6, CAP_INFO_7, CAP_INFO_8, CAP_INFO_9 };
+    EXPECT_EQ(DH_FWK_SUCCESS, capInfoMgr->AddCapabilityInMem(resInfos));
+
+    map<CapabilityInfoFilter, string> queryMap { { CapabilityInfoFilter::FILTER_DEVICE_ID, DEV_ID_0 },
+        { CapabilityInfoFilter::FILTER_DH_TYPE, to_string(TEST_DH_TYPE_CAMERA) } };
+    auto capMap = capInfoMgr->QueryCapabilityByFilters(queryMap);
+    ASSERT_EQ(capMap.size(), TEST_SIZE_1);
+    EXPECT_EQ(capMap.begin()->first, CAP_INFO_0->GetKey());
+
+    CapabilityInfoMap typeMap;
+    EXPECT_EQ(DH_FWK_SUCCESS, capInfoMgr->GetDataByDHType(DHType::CAMERA, typeMap));
+    EXPECT_EQ(typeMap.size(), TEST_SIZE_2);
+
+    EXPECT_EQ(DH_FWK_SUCCESS, capInfoMgr->RemoveCapabilityInfoInMem(DEV_ID_0));
+    vector<shared_ptr<CapabilityInfo>> devInfos;
+    capInfoMgr->GetCapabilitiesByDeviceId(DEV_ID_0, devInfos);
+    EXPECT_TRUE(devInfos.empty());
+    EXPECT_EQ(capInfoMgr->deviceIdIndex_.count(DEV_ID_0), TEST_SIZE_0);
+    typeMap.clear();
+    EXPECT_EQ(DH_FWK_SUCCESS, capInfoMgr->GetDataByDHType(DHType::CAMERA, typeMap));
+    EXPECT_EQ(typeMap.size(), TEST_SIZE_1);
+    EXPECT_EQ(capInfoMgr->globalCapInfoMap_.size(), TEST_SIZE_5);
+}
 } // namespace DistributedHardware
 } // namespace OHOS
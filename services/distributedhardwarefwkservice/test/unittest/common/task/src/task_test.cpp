@@ -157,8 +157,8 @@ HWTEST_F(TaskTest, task_test_004, TestSize.Level0)
 HWTEST_F(TaskTest, task_test_005, TestSize.Level0)
 {
     std::shared_ptr<Task> task = nullptr;
-    TaskExecutor::GetInstance().PushTask(task);
-    ASSERT_EQ(true, TaskExecutor::GetInstance().taskQueue_.empty());
+    ASSERT_EQ(ERR_DH_FWK_PARA_INVALID, TaskExecutor::GetInstance().PushTask(task));
+    ASSERT_EQ(0, TaskExecutor::GetInstance().GetStats().queueDepth);
 }
 
 /**
@@ -384,7 +384,101 @@ HWTEST_F(TaskTest, task_test_021, TestSize.Level0)
 {
     TaskExecutor::GetInstance().taskThreadFlag_ = false;
     TaskExecutor::GetInstance().TriggerTask();
-    ASSERT_EQ(true, TaskExecutor::GetInstance().taskQueue_.empty());
+    ASSERT_EQ(0, TaskExecutor::GetInstance().GetStats().queueDepth);
+}
+
+/**
+ * @tc.name: GetTaskPriority_001
+ * @tc.desc: Verify offline and disable tasks are dispatched ahead of online and enable tasks
+ * @tc.type: FUNC
+ * @tc.require: AR000GHSJE
+ */
+HWTEST_F(TaskTest, GetTaskPriority_001, TestSize.Level0)
+{
+    TaskParam taskParam;
+    auto offlineTask = TaskFactory::GetInstance().CreateTask(TaskType::OFF_LINE, taskParam, nullptr);
+    auto disableTask = TaskFactory::GetInstance().CreateTask(TaskType::DISABLE, taskParam, nullptr);
+    auto onlineTask = TaskFactory::GetInstance().CreateTask(TaskType::ON_LINE, taskParam, nullptr);
+    auto enableTask = TaskFactory::GetInstance().CreateTask(TaskType::ENABLE, taskParam, nullptr);
+    EXPECT_EQ(TaskPriority::HIGH, TaskExecutor::GetTaskPriority(offlineTask));
+    EXPECT_EQ(TaskPriority::HIGH, TaskExecutor::GetTaskPriority(disableTask));
+    EXPECT_EQ(TaskPriority::NORMAL, TaskExecutor::GetTaskPriority(onlineTask));
+    EXPECT_EQ(TaskPriority::LOW, TaskExecutor::GetTaskPriority(enableTask));
+    TaskBoard::GetInstance().RemoveTask(offlineTask->GetId());
+    TaskBoard::GetInstance().RemoveTask(disableTask->GetId());
+    TaskBoard::GetInstance().RemoveTask(onlineTask->GetId());
+    TaskBoard::GetInstance().RemoveTask(enableTask->GetId());
+}
+
+/**
+ * @tc.name: PopReadyTask_001
+ * @tc.desc: Verify tasks of one device keep push order and priority only applies between devices
+ * @tc.type: FUNC
+ * @tc.require: AR000GHSJE
+ */
+HWTEST_F(TaskTest, PopReadyTask_001, TestSize.Level0)
+{
+    TaskParam taskParam1;
+    taskParam1.uuid = "uuid_1";
+    TaskParam taskParam2;
+    taskParam2.uuid = "uuid_2";
+    auto enableTask1 = TaskFactory::GetInstance().CreateTask(TaskType::ENABLE, taskParam1, nullptr);
+    auto offlineTask1 = TaskFactory::GetInstance().CreateTask(TaskType::OFF_LINE, taskParam1, nullptr);
+    auto onlineTask2 = TaskFactory::GetInstance().CreateTask(TaskType::ON_LINE, taskParam2, nullptr);
+
+    auto &executor = TaskExecutor::GetInstance();
+    {
+        std::lock_guard<std::mutex> lock(executor.taskQueueMtx_);
+        executor.deviceLanes_["uuid_1"].push_back({ enableTask1, TaskPriority::LOW, 0, 0 });
+        executor.deviceLanes_["uuid_1"].push_back({ offlineTask1, TaskPriority::HIGH, 1, 0 });
+        executor.deviceLanes_["uuid_2"].push_back({ onlineTask2, TaskPriority::NORMAL, 2, 0 });
+
+        TaskExecutor::TaskItem item = { nullptr, TaskPriority::LOW, 0, 0 };
+        ASSERT_TRUE(executor.PopReadyTask(item));
+        EXPECT_EQ(onlineTask2, item.task);
+        ASSERT_TRUE(executor.PopReadyTask(item));
+        EXPECT_EQ(enableTask1, item.task);
+        ASSERT_TRUE(executor.PopReadyTask(item));
+        EXPECT_EQ(offlineTask1, item.task);
+        EXPECT_FALSE(executor.PopReadyTask(item));
+    }
+    TaskBoard::GetInstance().RemoveTask(enableTask1->GetId());
+    TaskBoard::GetInstance().RemoveTask(offlineTask1->GetId());
+    TaskBoard::GetInstance().RemoveTask(onlineTask2->GetId());
+}
+
+/**
+ * @tc.name: PopReadyTask_002
+ * @tc.desc: Verify a running task keeps its device busy until it finishes, except for its own children
+ * @tc.type: FUNC
+ * @tc.require: AR000GHSJE
+ */
+HWTEST_F(TaskTest, PopReadyTask_002, TestSize.Level0)
+{
+    TaskParam taskParam;
+    taskParam.uuid = "uuid_3";
+    auto offlineTask = TaskFactory::GetInstance().CreateTask(TaskType::OFF_LINE, taskParam, nullptr);
+    auto onlineTask = TaskFactory::GetInstance().CreateTask(TaskType::ON_LINE, taskParam, nullptr);
+    auto disableTask = TaskFactory::GetInstance().CreateTask(TaskType::DISABLE, taskParam, offlineTask);
+
+    auto &executor = TaskExecutor::GetInstance();
+    {
+        std::lock_guard<std::mutex> lock(executor.taskQueueMtx_);
+        executor.runningTasks_["uuid_3"].push_back(offlineTask->GetId());
+        executor.deviceLanes_["uuid_3"].push_back({ onlineTask, TaskPriority::NORMAL, 0, 0 });
+        executor.deviceLanes_["uuid_3"].push_back({ disableTask, TaskPriority::HIGH, 1, 0 });
+
+        TaskExecutor::TaskItem item = { nullptr, TaskPriority::LOW, 0, 0 };
+        ASSERT_TRUE(executor.PopReadyTask(item));
+        EXPECT_EQ(disableTask, item.task);
+        EXPECT_FALSE(executor.PopReadyTask(item));
+        executor.runningTasks_.erase("uuid_3");
+        ASSERT_TRUE(executor.PopReadyTask(item));
+        EXPECT_EQ(onlineTask, item.task);
+    }
+    TaskBoard::GetInstance().RemoveTask(offlineTask->GetId());
+    TaskBoard::GetInstance().RemoveTask(onlineTask->GetId());
+    TaskBoard::GetInstance().RemoveTask(disableTask->GetId());
 }
 
 HWTEST_F(TaskTest, task_test_022, TestSize.Level0)
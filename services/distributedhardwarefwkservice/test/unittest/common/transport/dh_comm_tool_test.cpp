@@ -18,6 +18,7 @@
 #include <gtest/gtest.h>
 #include <string>
 
+#include "constants.h"
 #include "dh_context.h"
 #include "dh_transport_obj.h"
 #include "dh_utils_tool.h"
@@ -101,6 +102,28 @@ HWTEST_F(DhCommToolTest, ParseAndSaveRemoteDHCaps_001, TestSize.Level0)
     EXPECT_EQ("", ret.networkId);
 }
 
+HWTEST_F(DhCommToolTest, RemoveRemoteDHCaps_001, TestSize.Level0)
+{
+    std::string networkId = "networkId_test";
+    std::string uuid = "uuid_test";
+    DHContext::GetInstance().AddOnlineDevice("udid_test", uuid, networkId);
+    std::string keyPrefix = GetDeviceIdByUUID(uuid) + RESOURCE_SEPARATOR;
+    dhCommToolTest_->reqDigestKeys_[networkId] = { keyPrefix + "dhId_1", "otherDevId###dhId_2" };
+
+    std::vector<std::shared_ptr<CapabilityInfo>> caps;
+    FullCapsRsp capsRsp(networkId, caps);
+    capsRsp.removedKeys = { keyPrefix + "dhId_1", keyPrefix + "dhId_3", "otherDevId###dhId_2" };
+    dhCommToolTest_->RemoveRemoteDHCaps(capsRsp);
+    ASSERT_EQ(1U, capsRsp.removedKeys.size());
+    EXPECT_EQ(keyPrefix + "dhId_1", capsRsp.removedKeys[0]);
+    EXPECT_TRUE(dhCommToolTest_->reqDigestKeys_.empty());
+
+    capsRsp.removedKeys = { keyPrefix + "dhId_1" };
+    dhCommToolTest_->RemoveRemoteDHCaps(capsRsp);
+    EXPECT_TRUE(capsRsp.removedKeys.empty());
+    DHContext::GetInstance().RemoveOnlineDeviceIdEntryByNetworkId(networkId);
+}
+
 HWTEST_F(DhCommToolTest, ProcessEvent_001, TestSize.Level0)
 {
     std::shared_ptr<CommMsg> commMsg = std::make_shared<CommMsg>();
@@ -120,5 +143,61 @@ HWTEST_F(DhCommToolTest, ProcessEvent_001, TestSize.Level0)
     eventHandler.ProcessFullCapsRsp(capsRsp1, dhCommToolTest_);
     EXPECT_EQ("networkId_test", capsRsp1.networkId);
 }
+
+HWTEST_F(DhCommToolTest, GetDeltaCaps_001, TestSize.Level0)
+{
+    std::shared_ptr<CapabilityInfo> cap1 = std::make_shared<CapabilityInfo>("dhId_1", "devId_test", "devName_test",
+        0, DHType::CAMERA, "attrs_1", "subtype");
+    std::shared_ptr<CapabilityInfo> cap2 = std::make_shared<CapabilityInfo>("dhId_2", "devId_test", "devName_test",
+        0, DHType::CAMERA, "attrs_2", "subtype");
+    std::shared_ptr<CapabilityInfo> cap3 = std::make_shared<CapabilityInfo>("dhId_3", "devId_test", "devName_test",
+        0, DHType::CAMERA, "attrs_3", "subtype");
+    std::string digestStr = GetCapsDigestString({ cap1, cap2, cap3 });
+    cJSON *digestJson = cJSON_Parse(digestStr.c_str());
+    ASSERT_NE(nullptr, digestJson);
+    CapsDigest capsDigest;
+    FromJson(digestJson, capsDigest);
+    cJSON_Delete(digestJson);
+    EXPECT_EQ(3, static_cast<int32_t>(capsDigest.hashes.size()));
+
+    cap2->SetDHAttrs("attrs_2_changed");
+    FullCapsRsp capsRsp;
+    GetDeltaCaps(capsDigest, { cap1, cap2 }, capsRsp);
+    EXPECT_TRUE(capsRsp.isDelta);
+    ASSERT_EQ(1, static_cast<int32_t>(capsRsp.caps.size()));
+    EXPECT_EQ("dhId_2", capsRsp.caps[0]->GetDHId());
+    ASSERT_EQ(1, static_cast<int32_t>(capsRsp.removedKeys.size()));
+    EXPECT_EQ(cap3->GetKey(), capsRsp.removedKeys[0]);
+
+    cJSON *root = cJSON_CreateObject();
+    ASSERT_NE(nullptr, root);
+    ToJson(root, capsRsp);
+    FullCapsRsp parsedRsp;
+    FromJson(root, parsedRsp);
+    cJSON_Delete(root);
+    EXPECT_TRUE(parsedRsp.isDelta);
+    EXPECT_EQ(1, static_cast<int32_t>(parsedRsp.caps.size()));
+    EXPECT_EQ(1, static_cast<int32_t>(parsedRsp.removedKeys.size()));
+}
+
+HWTEST_F(DhCommToolTest, ProcessFullCapsRsp_Delta_001, TestSize.Level0)
+{
+    std::shared_ptr<AppExecFwk::EventRunner> runner = AppExecFwk::EventRunner::Create(true);
+    DHCommTool::DHCommToolEventHandler eventHandler(runner, dhCommToolTest_);
+    std::vector<std::shared_ptr<CapabilityInfo>> caps;
+    FullCapsRsp capsRsp("networkId_test", caps);
+    capsRsp.isDelta = true;
+    eventHandler.ProcessFullCapsRsp(capsRsp, dhCommToolTest_);
+    EXPECT_TRUE(capsRsp.caps.empty());
+
+    CommMsg commMsg(DH_COMM_REQ_FULL_CAPS, "networkId_test", "{}");
+    std::string payload = GetCommMsgString(commMsg);
+    cJSON *root = cJSON_Parse(payload.c_str());
+    ASSERT_NE(nullptr, root);
+    CommMsg parsedMsg;
+    FromJson(root, parsedMsg);
+    cJSON_Delete(root);
+    EXPECT_EQ("{}", parsedMsg.capsDigest);
+}
 }
 }
\ No newline at end of file
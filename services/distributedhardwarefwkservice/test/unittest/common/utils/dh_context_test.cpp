@@ -49,40 +49,57 @@ void DhContextTest::TearDownTestCase() {}
 HWTEST_F(DhContextTest, AddOnlineDevice_001, TestSize.Level1)
 {
     DHContext::GetInstance().AddOnlineDevice("", "", "");
-    EXPECT_EQ(true, DHContext::GetInstance().devIdEntrySet_.empty());
+    EXPECT_EQ(true, DHContext::GetInstance().GetDeviceIdTable()->entries.empty());
 
     DHContext::GetInstance().AddOnlineDevice(TEST_UDID, "", "");
-    EXPECT_EQ(true, DHContext::GetInstance().devIdEntrySet_.empty());
+    EXPECT_EQ(true, DHContext::GetInstance().GetDeviceIdTable()->entries.empty());
 
     DHContext::GetInstance().AddOnlineDevice("", TEST_UUID, "");
-    EXPECT_EQ(true, DHContext::GetInstance().devIdEntrySet_.empty());
+    EXPECT_EQ(true, DHContext::GetInstance().GetDeviceIdTable()->entries.empty());
 
     DHContext::GetInstance().AddOnlineDevice("", "", TEST_NETWORKID);
-    EXPECT_EQ(true, DHContext::GetInstance().devIdEntrySet_.empty());
+    EXPECT_EQ(true, DHContext::GetInstance().GetDeviceIdTable()->entries.empty());
 
     DHContext::GetInstance().AddOnlineDevice(TEST_UDID, TEST_UUID, "");
-    EXPECT_EQ(true, DHContext::GetInstance().devIdEntrySet_.empty());
+    EXPECT_EQ(true, DHContext::GetInstance().GetDeviceIdTable()->entries.empty());
 
     DHContext::GetInstance().AddOnlineDevice(TEST_UDID, "", TEST_NETWORKID);
-    EXPECT_EQ(true, DHContext::GetInstance().devIdEntrySet_.empty());
+    EXPECT_EQ(true, DHContext::GetInstance().GetDeviceIdTable()->entries.empty());
 
     DHContext::GetInstance().AddOnlineDevice("", TEST_UUID, TEST_NETWORKID);
-    EXPECT_EQ(true, DHContext::GetInstance().devIdEntrySet_.empty());
+    EXPECT_EQ(true, DHContext::GetInstance().GetDeviceIdTable()->entries.empty());
 }
 
 HWTEST_F(DhContextTest, AddOnlineDevice_002, TestSize.Level1)
 {
     DHContext::GetInstance().AddOnlineDevice(TEST_UDID, TEST_UUID, TEST_NETWORKID);
-    EXPECT_EQ(false, DHContext::GetInstance().devIdEntrySet_.empty());
+    EXPECT_EQ(false, DHContext::GetInstance().GetDeviceIdTable()->entries.empty());
 }
 
 HWTEST_F(DhContextTest, RemoveOnlineDeviceIdEntryByNetworkId_001, TestSize.Level1)
 {
     DHContext::GetInstance().RemoveOnlineDeviceIdEntryByNetworkId("123");
-    EXPECT_EQ(false, DHContext::GetInstance().devIdEntrySet_.empty());
+    EXPECT_EQ(false, DHContext::GetInstance().GetDeviceIdTable()->entries.empty());
 
     DHContext::GetInstance().RemoveOnlineDeviceIdEntryByNetworkId(TEST_NETWORKID);
-    EXPECT_EQ(true, DHContext::GetInstance().devIdEntrySet_.empty());
+    EXPECT_EQ(true, DHContext::GetInstance().GetDeviceIdTable()->entries.empty());
+}
+
+HWTEST_F(DhContextTest, AddOnlineDevices_001, TestSize.Level1)
+{
+    std::vector<DeviceIdEntry> idEntries;
+    idEntries.push_back(DeviceIdEntry { .networkId = TEST_NETWORKID, .uuid = TEST_UUID, .udid = TEST_UDID });
+    idEntries.push_back(DeviceIdEntry { .networkId = "", .uuid = "444444", .udid = "555555" });
+    idEntries.push_back(DeviceIdEntry { .networkId = TEST_NETWORKID, .uuid = TEST_UUID, .udid = TEST_UDID });
+    size_t realTimeCount = DHContext::GetInstance().GetRealTimeOnlineDeviceCount();
+    EXPECT_EQ(1U, DHContext::GetInstance().AddOnlineDevices(idEntries));
+    EXPECT_EQ(true, DHContext::GetInstance().IsDeviceOnline(TEST_UUID));
+    EXPECT_EQ(TEST_UDID, DHContext::GetInstance().GetUDIDByNetworkId(TEST_NETWORKID));
+    EXPECT_EQ(realTimeCount + 1, DHContext::GetInstance().GetRealTimeOnlineDeviceCount());
+
+    DHContext::GetInstance().DeleteRealTimeOnlineDeviceNetworkId(TEST_NETWORKID);
+    DHContext::GetInstance().RemoveOnlineDeviceIdEntryByNetworkId(TEST_NETWORKID);
+    EXPECT_EQ(true, DHContext::GetInstance().GetDeviceIdTable()->entries.empty());
 }
 
 HWTEST_F(DhContextTest, IsDeviceOnline_001, TestSize.Level1)
@@ -100,7 +117,7 @@ HWTEST_F(DhContextTest, GetNetworkIdByUUID_001, TestSize.Level1)
     auto ret = DHContext::GetInstance().GetNetworkIdByUUID(TEST_UUID);
     EXPECT_EQ(TEST_NETWORKID, ret);
 
-    DHContext::GetInstance().devIdEntrySet_.clear();
+    DHContext::GetInstance().UpdateDeviceIdTable({});
     ret = DHContext::GetInstance().GetNetworkIdByUUID(TEST_UUID);
     EXPECT_EQ("", ret);
 }
@@ -120,7 +137,7 @@ HWTEST_F(DhContextTest, GetUUIDByNetworkId_001, TestSize.Level1)
     auto ret = DHContext::GetInstance().GetUUIDByNetworkId(TEST_NETWORKID);
     EXPECT_EQ(TEST_UUID, ret);
 
-    DHContext::GetInstance().devIdEntrySet_.clear();
+    DHContext::GetInstance().UpdateDeviceIdTable({});
     ret = DHContext::GetInstance().GetUUIDByNetworkId(TEST_NETWORKID);
     EXPECT_EQ("", ret);
 }
@@ -141,7 +158,7 @@ HWTEST_F(DhContextTest, GetUUIDByDeviceId_001, TestSize.Level1)
     auto ret = DHContext::GetInstance().GetUUIDByDeviceId(deviceId);
     EXPECT_EQ(TEST_UUID, ret);
 
-    DHContext::GetInstance().devIdEntrySet_.clear();
+    DHContext::GetInstance().UpdateDeviceIdTable({});
     ret = DHContext::GetInstance().GetUUIDByDeviceId(deviceId);
     EXPECT_EQ("", ret);
 }
@@ -157,6 +174,20 @@ HWTEST_F(DhContextTest, GetNetworkIdByDeviceId_001, TestSize.Level1)
     EXPECT_EQ(TEST_NETWORKID, ret);
 }
 
+HWTEST_F(DhContextTest, GetDeviceIdTable_001, TestSize.Level1)
+{
+    DHContext::GetInstance().UpdateDeviceIdTable({});
+    DHContext::GetInstance().AddOnlineDevice(TEST_UDID, TEST_UUID, TEST_NETWORKID);
+    auto snapshot = DHContext::GetInstance().GetDeviceIdTable();
+    EXPECT_EQ(TEST_UUID, DHContext::GetInstance().GetUUIDByDeviceId(Sha256(TEST_UDID)));
+
+    DHContext::GetInstance().RemoveOnlineDeviceIdEntryByNetworkId(TEST_NETWORKID);
+    EXPECT_EQ("", DHContext::GetInstance().GetUUIDByNetworkId(TEST_NETWORKID));
+    ASSERT_NE(nullptr, snapshot);
+    EXPECT_EQ(1, snapshot->entries.size());
+    EXPECT_NE(snapshot->networkIdIndex.end(), snapshot->networkIdIndex.find(TEST_NETWORKID));
+}
+
 HWTEST_F(DhContextTest, GetDeviceIdByDBGetPrefix_001, TestSize.Level1)
 {
     std::string prefix = "";
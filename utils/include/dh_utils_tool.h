@@ -17,11 +17,17 @@
 #define OHOS_DISTRIBUTED_HARDWARE_DHUTILS_TOOL_H
 
 #include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
 
 #include "cJSON.h"
 
 #include "device_type.h"
 
+struct z_stream_s;
+
 namespace OHOS {
 namespace DistributedHardware {
 /**
@@ -64,8 +70,40 @@ bool IsArray(const cJSON* jsonObj, const std::string& key);
 std::string Compress(const std::string& data);
 std::string Decompress(const std::string& data);
 
+/**
+ * Keep the zlib streams alive and reset them between messages, instead of
+ * init and end per message. Each message is still an independent zlib stream.
+ * If useDict, the sender presets a dictionary of the common capability json
+ * fields; the receiver always accepts both kinds of stream.
+ */
+class DHCompressor {
+public:
+    explicit DHCompressor(bool useDict = false);
+    ~DHCompressor();
+    DHCompressor(const DHCompressor &) = delete;
+    DHCompressor &operator = (const DHCompressor &) = delete;
+
+    std::string Compress(const std::string &data);
+    std::string Decompress(const char *data, size_t dataLen);
+    std::string Decompress(const std::string &data);
+
+private:
+    bool InitDeflate();
+    bool InitInflate();
+
+private:
+    bool useDict_;
+    std::mutex deflateMtx_;
+    std::unique_ptr<z_stream_s> deflateStrm_;
+    std::mutex inflateMtx_;
+    std::unique_ptr<z_stream_s> inflateStrm_;
+    std::vector<unsigned char> inflateSlice_;
+};
+
 bool GetSysPara(const char *key, bool &value);
 
+bool GetSysPara(const char *key, int32_t &value);
+
 bool IsIdLengthValid(const std::string &input);
 
 bool IsMessageLengthValid(const std::string &input);
@@ -45,6 +45,12 @@ namespace {
     constexpr unsigned char MASK = 0x0F;
     constexpr int32_t DOUBLE_TIMES = 2;
     constexpr int32_t COMPRESS_SLICE_SIZE = 1024;
+    // fragments of the CommMsg/FullCapsRsp/CapabilityInfo json, the most frequent at the end
+    const char COMPRESS_DICT[] =
+        R"({"code":1,"msg":"","capsDigest":"{\"###\":\"\"}"})"
+        R"(,\"isDelta\":true,\"removedKeys\":[\"###\"])"
+        R"({"code":2,"msg":"{\"networkId\":\"\",\"caps\":[{\"dh_id\":\"\",\"dev_id\":\"\",\"dev_name\":\"\",)"
+        R"(\"dev_type\":14,\"dh_type\":1,\"dh_attrs\":\"{\\\"\\\":\\\"\\\"}\",\"dh_subtype\":\"\"},{)";
 }
 
 int64_t GetCurrentTime()
@@ -224,51 +230,137 @@ bool IsArray(const cJSON* jsonObj, const std::string& key)
 
 std::string Compress(const std::string& data)
 {
-    z_stream strm;
-    strm.zalloc = Z_NULL;
-    strm.zfree = Z_NULL;
-    strm.opaque = Z_NULL;
-    deflateInit(&strm, Z_DEFAULT_COMPRESSION);
- 
-    strm.next_in = reinterpret_cast<Bytef*>(const_cast<char *>(data.data()));
-    strm.avail_in = data.size();
-    std::string out;
-    std::vector<Bytef> temp_out(COMPRESS_SLICE_SIZE, 0);
- 
+    DHCompressor compressor;
+    return compressor.Compress(data);
+}
+
+std::string Decompress(const std::string& data)
+{
+    DHCompressor compressor;
+    return compressor.Decompress(data);
+}
+
+DHCompressor::DHCompressor(bool useDict) : useDict_(useDict), deflateStrm_(nullptr), inflateStrm_(nullptr),
+    inflateSlice_(COMPRESS_SLICE_SIZE, 0)
+{
+}
+
+DHCompressor::~DHCompressor()
+{
+    if (deflateStrm_ != nullptr) {
+        deflateEnd(deflateStrm_.get());
+    }
+    if (inflateStrm_ != nullptr) {
+        inflateEnd(inflateStrm_.get());
+    }
+}
+
+bool DHCompressor::InitDeflate()
+{
+    if (deflateStrm_ != nullptr) {
+        return deflateReset(deflateStrm_.get()) == Z_OK;
+    }
+    auto strm = std::make_unique<z_stream>();
+    strm->zalloc = Z_NULL;
+    strm->zfree = Z_NULL;
+    strm->opaque = Z_NULL;
+    if (deflateInit(strm.get(), Z_DEFAULT_COMPRESSION) != Z_OK) {
+        DHLOGE("deflateInit failed");
+        return false;
+    }
+    deflateStrm_ = std::move(strm);
+    return true;
+}
+
+bool DHCompressor::InitInflate()
+{
+    if (inflateStrm_ != nullptr) {
+        return inflateReset(inflateStrm_.get()) == Z_OK;
+    }
+    auto strm = std::make_unique<z_stream>();
+    strm->zalloc = Z_NULL;
+    strm->zfree = Z_NULL;
+    strm->opaque = Z_NULL;
+    strm->avail_in = 0;
+    strm->next_in = Z_NULL;
+    if (inflateInit(strm.get()) != Z_OK) {
+        DHLOGE("inflateInit failed");
+        return false;
+    }
+    inflateStrm_ = std::move(strm);
+    return true;
+}
+
+std::string DHCompressor::Compress(const std::string &data)
+{
+    std::lock_guard<std::mutex> lock(deflateMtx_);
+    if (!InitDeflate()) {
+        return "";
+    }
+    z_stream *strm = deflateStrm_.get();
+    if (useDict_ && deflateSetDictionary(strm, reinterpret_cast<const Bytef *>(COMPRESS_DICT),
+        sizeof(COMPRESS_DICT) - 1) != Z_OK) {
+        DHLOGE("deflateSetDictionary failed");
+        return "";
+    }
+    strm->next_in = reinterpret_cast<Bytef *>(const_cast<char *>(data.data()));
+    strm->avail_in = data.size();
+    // deflate straight into the result, sized by the worst case bound
+    std::string out(deflateBound(strm, data.size()), '\0');
+    int32_t ret = Z_OK;
     do {
-        strm.next_out = temp_out.data();
-        strm.avail_out = COMPRESS_SLICE_SIZE;
-        deflate(&strm, Z_FINISH);
-        out.append(reinterpret_cast<char*>(temp_out.data()), COMPRESS_SLICE_SIZE - strm.avail_out);
-    } while (strm.avail_out == 0);
- 
-    deflateEnd(&strm);
+        if (strm->total_out == out.size()) {
+            out.resize(out.size() + COMPRESS_SLICE_SIZE);
+        }
+        strm->next_out = reinterpret_cast<Bytef *>(&out[strm->total_out]);
+        strm->avail_out = out.size() - strm->total_out;
+        ret = deflate(strm, Z_FINISH);
+    } while (ret == Z_OK);
+    if (ret != Z_STREAM_END) {
+        DHLOGE("deflate failed, ret: %{public}d", ret);
+        return "";
+    }
+    out.resize(strm->total_out);
     return out;
 }
- 
-std::string Decompress(const std::string& data)
+
+std::string DHCompressor::Decompress(const std::string &data)
+{
+    return Decompress(data.data(), data.size());
+}
+
+std::string DHCompressor::Decompress(const char *data, size_t dataLen)
 {
-    z_stream strm;
-    strm.zalloc = Z_NULL;
-    strm.zfree = Z_NULL;
-    strm.opaque = Z_NULL;
-    strm.avail_in = 0;
-    strm.next_in = Z_NULL;
-    inflateInit(&strm);
- 
-    strm.next_in = reinterpret_cast<Bytef*>(const_cast<char *>(data.data()));
-    strm.avail_in = data.size();
+    if (data == nullptr || dataLen == 0) {
+        return "";
+    }
+    std::lock_guard<std::mutex> lock(inflateMtx_);
+    if (!InitInflate()) {
+        return "";
+    }
+    z_stream *strm = inflateStrm_.get();
+    strm->next_in = reinterpret_cast<Bytef *>(const_cast<char *>(data));
+    strm->avail_in = dataLen;
     std::string out;
-    std::vector<Bytef> temp_out(COMPRESS_SLICE_SIZE, 0);
- 
-    do {
-        strm.next_out = temp_out.data();
-        strm.avail_out = COMPRESS_SLICE_SIZE;
-        inflate(&strm, Z_NO_FLUSH);
-        out.append(reinterpret_cast<char*>(temp_out.data()), COMPRESS_SLICE_SIZE - strm.avail_out);
-    } while (strm.avail_out == 0);
- 
-    inflateEnd(&strm);
+    out.reserve(dataLen * DOUBLE_TIMES);
+    while (true) {
+        strm->next_out = inflateSlice_.data();
+        strm->avail_out = COMPRESS_SLICE_SIZE;
+        int32_t ret = inflate(strm, Z_NO_FLUSH);
+        if (ret == Z_NEED_DICT) {
+            if (strm->adler != adler32(adler32(0L, Z_NULL, 0), reinterpret_cast<const Bytef *>(COMPRESS_DICT),
+                sizeof(COMPRESS_DICT) - 1) || inflateSetDictionary(strm,
+                reinterpret_cast<const Bytef *>(COMPRESS_DICT), sizeof(COMPRESS_DICT) - 1) != Z_OK) {
+                DHLOGE("Unknown compress dictionary");
+                return "";
+            }
+            continue;
+        }
+        out.append(reinterpret_cast<char *>(inflateSlice_.data()), COMPRESS_SLICE_SIZE - strm->avail_out);
+        if (ret != Z_OK || strm->avail_out != 0) {
+            break;
+        }
+    }
     return out;
 }
 
@@ -291,6 +383,30 @@ bool GetSysPara(const char *key, bool &value)
     return true;
 }
 
+bool GetSysPara(const char *key, int32_t &value)
+{
+    if (key == nullptr) {
+        DHLOGE("GetSysPara: key is nullptr");
+        return false;
+    }
+    char paraValue[20] = {0}; // 20 for system parameter
+    auto res = GetParameter(key, "", paraValue, sizeof(paraValue));
+    if (res <= 0) {
+        DHLOGD("GetSysPara fail, key:%{public}s res:%{public}d", key, res);
+        return false;
+    }
+    DHLOGI("GetSysPara: key:%{public}s value:%{public}s", key, paraValue);
+    std::stringstream valueStr;
+    valueStr << paraValue;
+    int32_t result = 0;
+    if (!(valueStr >> result)) {
+        DHLOGE("GetSysPara: value of key:%{public}s is not a number", key);
+        return false;
+    }
+    value = result;
+    return true;
+}
+
 bool IsIdLengthValid(const std::string &inputID)
 {
     if (inputID.empty() || inputID.length() > MAX_ID_LEN) {
@@ -132,5 +132,31 @@ HWTEST_F(UtilsToolTest, GetDeviceIdByUUID_002, TestSize.Level0)
     std::string ret = GetDeviceIdByUUID(uuid);
     EXPECT_NE(0, ret.size());
 }
+
+/**
+ * @tc.name: DHCompressor_001
+ * @tc.desc: Verify the reused compress streams, with and without the preset dictionary
+ * @tc.type: FUNC
+ * @tc.require: AR000GHSK0
+ */
+HWTEST_F(UtilsToolTest, DHCompressor_001, TestSize.Level0)
+{
+    std::string data;
+    for (int32_t i = 0; i < UUID_LENGTH; i++) {
+        data += "{\"dh_id\":\"dhId_" + std::to_string(i) + "\",\"dev_id\":\"devId_test\",\"dh_attrs\":\"{}\"},";
+    }
+    DHCompressor dictCompressor(true);
+    DHCompressor compressor;
+    for (int32_t i = 0; i < 2; i++) {
+        std::string dictCompressed = dictCompressor.Compress(data);
+        std::string compressed = compressor.Compress(data);
+        EXPECT_LT(dictCompressed.size(), data.size());
+        EXPECT_EQ(data, compressor.Decompress(dictCompressed));
+        EXPECT_EQ(data, dictCompressor.Decompress(compressed));
+        EXPECT_EQ(data, Decompress(compressed));
+    }
+    EXPECT_EQ(data, Decompress(Compress(data)));
+    EXPECT_EQ("", compressor.Decompress(""));
+}
 } // namespace DistributedHardware
 } // namespace OHOS